@@ -11,5 +11,6 @@
 #include <pkmn-c/database/lists.h>
 #include <pkmn-c/database/move_entry.h>
 #include <pkmn-c/database/pokemon_entry.h>
+#include <pkmn-c/database/query_instrumentation.h>
 
 #endif /* PKMN_C_DATABASE_H */
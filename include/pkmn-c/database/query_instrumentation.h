@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_C_DATABASE_QUERY_INSTRUMENTATION_H
+#define PKMN_C_DATABASE_QUERY_INSTRUMENTATION_H
+
+#include <pkmn-c/config.h>
+#include <pkmn-c/error.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+//! A single query made to LibPKMN's database.
+struct pkmn_database_query_event
+{
+    //! The query's SQL text.
+    const char* p_query;
+    //! The outermost LibPKMN call that led to this query, or an empty string.
+    const char* p_entry_point;
+    //! How long the query's statement was in use, in nanoseconds.
+    uint64_t duration_ns;
+};
+
+//! Statistics for every time a query was made from the same entry point.
+struct pkmn_database_query_stats
+{
+    //! The query's SQL text.
+    char* p_query;
+    //! The outermost LibPKMN call that led to the query, or an empty string.
+    char* p_entry_point;
+    //! How many times the query was made.
+    uint64_t num_queries;
+    //! The total time spent on the query, in nanoseconds.
+    uint64_t total_duration_ns;
+    //! The median time spent on the query, in nanoseconds.
+    uint64_t median_duration_ns;
+    //! The 90th percentile time spent on the query, in nanoseconds.
+    uint64_t p90_duration_ns;
+    //! The 99th percentile time spent on the query, in nanoseconds.
+    uint64_t p99_duration_ns;
+    //! The longest time spent on the query, in nanoseconds.
+    uint64_t max_duration_ns;
+};
+
+//! A list of query statistics.
+struct pkmn_database_query_stats_list
+{
+    //! The statistics, dynamically allocated.
+    struct pkmn_database_query_stats* p_query_stats;
+    //! The number of statistics in the list.
+    size_t length;
+};
+
+/*!
+ * @brief A function called after every recorded query.
+ *
+ * The event's strings are only valid for the duration of the call.
+ */
+typedef void (*pkmn_database_query_callback_t)(
+    const struct pkmn_database_query_event* p_query_event,
+    void* p_user_data
+);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets whether queries to LibPKMN's database are recorded.
+ *
+ * This is disabled by default. It can also be enabled by setting the
+ * PKMN_DATABASE_INSTRUMENTATION environment variable.
+ *
+ * \param enabled Whether to record queries
+ * \returns ::PKMN_ERROR_NONE upon success
+ */
+PKMN_C_API enum pkmn_error pkmn_database_set_query_instrumentation_enabled(
+    bool enabled
+);
+
+/*!
+ * @brief Returns whether queries to LibPKMN's database are being recorded.
+ *
+ * \param p_enabled_out Where to return the result
+ * \returns ::PKMN_ERROR_NONE upon success
+ * \returns ::PKMN_ERROR_NULL_POINTER if p_enabled_out is NULL
+ */
+PKMN_C_API enum pkmn_error pkmn_database_is_query_instrumentation_enabled(
+    bool* p_enabled_out
+);
+
+/*!
+ * @brief Returns statistics for every recorded query, longest total time first.
+ *
+ * \param p_query_stats_list_out Where to return the statistics
+ * \returns ::PKMN_ERROR_NONE upon success
+ * \returns ::PKMN_ERROR_NULL_POINTER if p_query_stats_list_out is NULL
+ */
+PKMN_C_API enum pkmn_error pkmn_database_get_query_stats(
+    struct pkmn_database_query_stats_list* p_query_stats_list_out
+);
+
+/*!
+ * @brief Clears every recorded query statistic.
+ *
+ * \returns ::PKMN_ERROR_NONE upon success
+ */
+PKMN_C_API enum pkmn_error pkmn_database_reset_query_stats();
+
+/*!
+ * @brief Sets a function to be called after every recorded query.
+ *
+ * The callback is called on the thread that made the query. Passing NULL
+ * removes the callback.
+ *
+ * \param query_callback The function to call
+ * \param p_user_data A pointer passed into every call
+ * \returns ::PKMN_ERROR_NONE upon success
+ */
+PKMN_C_API enum pkmn_error pkmn_database_set_query_callback(
+    pkmn_database_query_callback_t query_callback,
+    void* p_user_data
+);
+
+/*!
+ * @brief Frees the dynamically-allocated memory in the given query statistics list.
+ *
+ * \param p_query_stats_list A pointer to the list to free
+ * \returns ::PKMN_ERROR_NONE upon success
+ * \returns ::PKMN_ERROR_NULL_POINTER if p_query_stats_list is NULL
+ */
+PKMN_C_API enum pkmn_error pkmn_database_query_stats_list_free(
+    struct pkmn_database_query_stats_list* p_query_stats_list
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKMN_C_DATABASE_QUERY_INSTRUMENTATION_H */
@@ -63,6 +63,10 @@ extern "C" {
  *
  * The string returned from this function is guaranteed to be non-NULL and will
  * contain the string "None." if the previous call succeeded.
+ *
+ * Errors are stored per thread, so this describes the last call made on the
+ * calling thread, and the returned string is valid until that thread makes
+ * another LibPKMN call.
  */
 PKMN_C_API const char* pkmn_strerror();
 
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_C_UTILS_RANDOM_H
+#define PKMN_C_UTILS_RANDOM_H
+
+#include <pkmn-c/config.h>
+#include <pkmn-c/error.h>
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Seeds the random number generator for the calling thread.
+ *
+ * Everything LibPKMN generates randomly, such as new Pokémon's
+ * personalities and IVs, comes from a per-thread generator. After this
+ * call, the same sequence of calls on this thread produces the same
+ * values, which is useful for reproducible test data.
+ *
+ * Threads that never call this function are seeded automatically.
+ *
+ * \param seed The seed to use
+ * \returns ::PKMN_ERROR_NONE upon successful completion
+ */
+PKMN_C_API enum pkmn_error pkmn_seed_rng(
+    uint64_t seed
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKMN_C_UTILS_RANDOM_H */
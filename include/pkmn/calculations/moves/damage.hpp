@@ -9,8 +9,56 @@
 
 #include <pkmn/config.hpp>
 
+#include <pkmn/enums/type.hpp>
+
+#include <array>
+#include <vector>
+
 namespace pkmn { namespace calculations {
 
+    /*!
+     * @brief The number of random damage rolls, from 85% to 100% damage.
+     */
+    PKMN_CONSTEXPR_OR_CONST int NUM_DAMAGE_ROLLS = 16;
+
+    /*!
+     * @brief One attacker using one move against one defender.
+     *
+     * A Pokémon with a single type should have pkmn::e_type::NONE as its
+     * second type.
+     */
+    struct damage_matchup
+    {
+        //! Attacker level (valid values: [1-255])
+        int attacker_level;
+        pkmn::type_pair_t attacker_types;
+        //! The stat being used for attack (Attack or Special Attack)
+        int attack_stat;
+
+        pkmn::type_pair_t defender_types;
+        //! The stat being used for defense (Defense or Special Defense)
+        int defense_stat;
+
+        pkmn::e_type move_type;
+        int move_base_power;
+    };
+
+    /*!
+     * @brief Every possible amount of damage for one pkmn::calculations::damage_matchup.
+     */
+    struct damage_range
+    {
+        //! The move's effectiveness against the defender's type(s)
+        float type_modifier;
+        //! Whether the move's type matches one of the attacker's types
+        bool has_STAB;
+
+        //! The damage for each random roll, from 85% to 100%
+        std::array<int, NUM_DAMAGE_ROLLS> rolls;
+        //! The damage for each random roll if the move is a critical hit
+        std::array<int, NUM_DAMAGE_ROLLS> critical_hit_rolls;
+    };
+
     /*!
      * @brief Damage calculation.
      *
@@ -30,5 +78,28 @@ namespace pkmn { namespace calculations {
         float modifier
     );
 
+    /*!
+     * @brief Damage calculation for many matchups at once.
+     *
+     * Type effectiveness comes from an in-memory copy of the given
+     * generation's type chart, so this is much faster than calling
+     * pkmn::calculations::type_damage_modifier and pkmn::calculations::damage
+     * for each matchup.
+     *
+     * \param generation The generation whose type chart and critical hit
+     *                   modifier to use
+     * \param matchups The attackers, defenders, and moves to calculate
+     * \throws std::out_of_range if the given generation is not in the range [1-6]
+     * \throws std::out_of_range if any attacker level is not in the range [1-255]
+     * \throws std::out_of_range if any base power or stat is negative
+     * \throws std::invalid_argument if any type is invalid or not present in
+     *                               the given generation
+     * \returns The damage range for each matchup, in order
+     */
+    PKMN_API std::vector<pkmn::calculations::damage_range> damage_ranges(
+        int generation,
+        const std::vector<pkmn::calculations::damage_matchup>& matchups
+    );
+
 }}
 #endif /* PKMN_CALCULATIONS_MOVES_DAMAGE_HPP */
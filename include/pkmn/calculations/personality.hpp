@@ -16,13 +16,14 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace pkmn { namespace calculations {
 
     //! Generate a personality based on the given species and values.
     /*!
-     * This function is RNG-based and takes an average of 30 milliseconds
-     * to generate a valid value.
+     * The personality is built directly from the given values, so this takes
+     * the same small amount of time regardless of the inputs.
      *
      * \param species The Pokémon species
      * \param trainer_id The trainer ID to use in the shininess calculation
@@ -42,5 +43,30 @@ namespace pkmn { namespace calculations {
         pkmn::e_nature nature
     );
 
+    //! Generate multiple personalities based on the given species and values.
+    /*!
+     * This is equivalent to calling pkmn::calculations::generate_personality()
+     * the given number of times, but the inputs are only validated once.
+     *
+     * \param species The Pokémon species
+     * \param trainer_id The trainer ID to use in the shininess calculation
+     * \param shiny Whether or not the Pokémon should be shiny
+     * \param ability Which ability the Pokémon should have
+     * \param gender What gender the Pokémon should be
+     * \param nature What nature the Pokémon should have
+     * \param num_personalities How many personalities to generate
+     * \throws std::invalid_argument If the given ability or gender is invalid for the species
+     * \throws std::invalid_argument If the given nature is invalid
+     */
+    PKMN_API std::vector<uint32_t> generate_personalities(
+        pkmn::e_species species,
+        uint32_t trainer_id,
+        bool shiny,
+        pkmn::e_ability ability,
+        pkmn::e_gender gender,
+        pkmn::e_nature nature,
+        size_t num_personalities
+    );
+
 }}
 #endif /* PKMN_CALCULATIONS_PERSONALITY_HPP */
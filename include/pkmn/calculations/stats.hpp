@@ -13,6 +13,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace pkmn { namespace calculations {
 
@@ -38,6 +39,31 @@ namespace pkmn { namespace calculations {
         int IV
     );
 
+    /*!
+     * @brief Calculates a Generation I-II stat for many Pokémon at once.
+     *
+     * Each vector holds one value per Pokémon, so this is much faster than
+     * calling pkmn::calculations::get_gb_stat for each Pokémon in a box.
+     *
+     * \param stat Stat name (HP, Attack, Defense, Speed, Special, Special
+     *             Attack, Special Defense)
+     * \param levels Each Pokémon's level (0-100)
+     * \param base_stats Each Pokémon's base stat value
+     * \param EVs Each Pokémon's EV for this stat (0-65535)
+     * \param IVs Each Pokémon's IV for this stat (0-15)
+     * \throws std::invalid_argument If the given vectors are different sizes
+     * \throws std::runtime_error If the given stat string is invalid
+     * \throws std::out_of_range If any numeric parameter is out of the given range
+     * \returns Calculated stat for each Pokémon
+     */
+    PKMN_API std::vector<int> get_gb_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const std::vector<int>& base_stats,
+        const std::vector<int>& EVs,
+        const std::vector<int>& IVs
+    );
+
     /*!
      * @brief Calculates the minimum and maximum values of the given stat for a
      *        Generation I-II Pokémon.
@@ -84,6 +110,34 @@ namespace pkmn { namespace calculations {
         int IV
     );
 
+    /*!
+     * @brief Calculates a Generation III+ stat for many Pokémon at once.
+     *
+     * Each vector holds one value per Pokémon, so this is much faster than
+     * calling pkmn::calculations::get_modern_stat for each Pokémon in a box.
+     *
+     * \param stat Stat name (HP, Attack, Defense, Speed, Special Attack,
+     *             Special Defense)
+     * \param levels Each Pokémon's level (0-100)
+     * \param nature_modifiers The effect of each Pokémon's nature on the stat (0.9, 1.0, 1.1)
+     * \param base_stats Each Pokémon's base stat value
+     * \param EVs Each Pokémon's EV for this stat (0-255)
+     * \param IVs Each Pokémon's IV for this stat (0-31)
+     * \throws std::invalid_argument If the given vectors are different sizes
+     * \throws std::runtime_error If the given stat string is invalid
+     * \throws std::domain_error If any nature modifier is not in (0.9, 1.0, 1.1)
+     * \throws std::out_of_range If any numeric parameter is out of the given range
+     * \returns Calculated stat for each Pokémon
+     */
+    PKMN_API std::vector<int> get_modern_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const std::vector<float>& nature_modifiers,
+        const std::vector<int>& base_stats,
+        const std::vector<int>& EVs,
+        const std::vector<int>& IVs
+    );
+
     /*!
      * @brief Calculates the minimum and maximum values of the given stat for a
      *        Generation III+ Pokémon.
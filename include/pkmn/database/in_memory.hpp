@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_DATABASE_IN_MEMORY_HPP
+#define PKMN_DATABASE_IN_MEMORY_HPP
+
+#include <pkmn/config.hpp>
+
+namespace pkmn { namespace database {
+
+    /*!
+     * @brief Loads LibPKMN's database into memory.
+     *
+     * The on-disk database at pkmn::get_database_path() is copied into a
+     * read-only in-memory snapshot, and all further lookups are served from
+     * it with no disk access. This is meant for long-running processes that
+     * can afford the extra memory in exchange for faster lookups.
+     *
+     * There is only one copy of the snapshot, no matter how many threads
+     * use it. Each thread reads it through its own connection.
+     *
+     * The same behavior can be enabled without code changes by setting the
+     * PKMN_DATABASE_IN_MEMORY environment variable before the database is
+     * first used.
+     *
+     * This function must not be called while other threads are using
+     * LibPKMN. Calling it after the database is already in memory does
+     * nothing.
+     *
+     * \throws std::runtime_error If no valid database was found or the copy fails
+     */
+    PKMN_API void load_into_memory();
+
+    /*!
+     * @brief Returns whether LibPKMN's database has been loaded into memory.
+     */
+    PKMN_API bool is_loaded_into_memory();
+
+}}
+
+#endif /* PKMN_DATABASE_IN_MEMORY_HPP */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_DATABASE_LIST_SNAPSHOTS_HPP
+#define PKMN_DATABASE_LIST_SNAPSHOTS_HPP
+
+#include <pkmn/config.hpp>
+
+#include <pkmn/enums/ability.hpp>
+#include <pkmn/enums/game.hpp>
+#include <pkmn/enums/item.hpp>
+#include <pkmn/enums/move.hpp>
+#include <pkmn/enums/nature.hpp>
+#include <pkmn/enums/species.hpp>
+#include <pkmn/enums/type.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * These functions return the same lists as their counterparts in
+ * <pkmn/database/lists.hpp>, but each list is only queried once per process.
+ * Every later call returns the same immutable snapshot, so callers that ask
+ * for the same list repeatedly (such as UI widgets) don't pay for a query and
+ * a copy each time.
+ *
+ * Reading a snapshot that has already been created takes no locks, so once
+ * warm_list_snapshots() has been called, any number of threads can read
+ * snapshots concurrently without contention.
+ */
+
+namespace pkmn { namespace database {
+
+    /*!
+     * @brief A shared, immutable list.
+     *
+     * Each snapshot is created once per process and never changes, so it
+     * stays valid for as long as any caller holds it, even after LibPKMN's
+     * own copy is destroyed at exit. Any number of threads can read the same
+     * snapshot at once.
+     */
+    template <typename T>
+    using list_snapshot = std::shared_ptr<const std::vector<T>>;
+
+    /*!
+     * @brief Creates every list snapshot up front.
+     *
+     * This is meant to be called at startup so that no later caller waits
+     * on a query.
+     */
+    PKMN_API void warm_list_snapshots();
+
+    /*!
+     * @brief Returns a snapshot of pkmn::database::get_ability_list for the given generation.
+     *
+     * \param generation Which generation (3-6)
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [3-6]
+     */
+    PKMN_API list_snapshot<pkmn::e_ability> get_ability_list_snapshot(
+        int generation
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of every ability in the given generation.
+     *
+     * \param generation Which generation (3-6)
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [3-6]
+     */
+    PKMN_API list_snapshot<std::string> get_ability_name_list_snapshot(
+        int generation
+    );
+
+    /*!
+     * @brief Returns a snapshot of the games in the given generation.
+     *
+     * \param generation Which generation (1-6)
+     * \param include_previous Whether to include games from earlier generations
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [1-6]
+     */
+    PKMN_API list_snapshot<pkmn::e_game> get_game_list_snapshot(
+        int generation,
+        bool include_previous
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the games in the given generation.
+     *
+     * \param generation Which generation (1-6)
+     * \param include_previous Whether to include games from earlier generations
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [1-6]
+     */
+    PKMN_API list_snapshot<std::string> get_game_name_list_snapshot(
+        int generation,
+        bool include_previous
+    );
+
+    /*!
+     * @brief Returns a snapshot of the Shadow Pokémon in Colosseum or XD.
+     *
+     * \param colosseum Whether to list Colosseum's Shadow Pokémon instead of XD's
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<pkmn::e_species> get_gamecube_shadow_pokemon_list_snapshot(
+        bool colosseum
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the Shadow Pokémon in Colosseum or XD.
+     *
+     * \param colosseum Whether to list Colosseum's Shadow Pokémon instead of XD's
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<std::string> get_gamecube_shadow_pokemon_name_list_snapshot(
+        bool colosseum
+    );
+
+    /*!
+     * @brief Returns a snapshot of the moves taught by HMs in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     * \throws pkmn::feature_not_in_game_error If the game has no HMs
+     */
+    PKMN_API list_snapshot<pkmn::e_move> get_hm_move_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the moves taught by HMs in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     * \throws pkmn::feature_not_in_game_error If the game has no HMs
+     */
+    PKMN_API list_snapshot<std::string> get_hm_move_name_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the items in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<pkmn::e_item> get_item_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the items in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<std::string> get_item_name_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of pkmn::database::get_location_name_list.
+     *
+     * As with that function, Game Boy Advance and Gamecube locations are
+     * never mixed, even for a whole generation.
+     *
+     * \param game Which game
+     * \param whole_generation Whether to include locations from every game in this generation
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<std::string> get_location_name_list_snapshot(
+        pkmn::e_game game,
+        bool whole_generation
+    );
+
+    /*!
+     * @brief Returns a snapshot of the moves in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<pkmn::e_move> get_move_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the moves in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<std::string> get_move_name_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of every nature.
+     *
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<pkmn::e_nature> get_nature_list_snapshot();
+
+    /*!
+     * @brief Returns a snapshot of the name of every nature.
+     *
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<std::string> get_nature_name_list_snapshot();
+
+    /*!
+     * @brief Returns a snapshot of the Pokémon species in the given generation.
+     *
+     * \param generation Which generation (1-6)
+     * \param include_previous Whether to include species from earlier generations
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [1-6]
+     */
+    PKMN_API list_snapshot<pkmn::e_species> get_pokemon_list_snapshot(
+        int generation,
+        bool include_previous
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the Pokémon species in the given generation.
+     *
+     * \param generation Which generation (1-6)
+     * \param include_previous Whether to include species from earlier generations
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [1-6]
+     */
+    PKMN_API list_snapshot<std::string> get_pokemon_name_list_snapshot(
+        int generation,
+        bool include_previous
+    );
+
+    /*!
+     * @brief Returns a snapshot of the name of every region.
+     *
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<std::string> get_region_name_list_snapshot();
+
+    /*!
+     * @brief Returns a snapshot of the names of the ribbons in the given generation.
+     *
+     * \param generation Which generation (3-6)
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::out_of_range If generation is not in the range [3-6]
+     * \throws pkmn::unimplemented_error If ribbons aren't implemented for the generation
+     */
+    PKMN_API list_snapshot<std::string> get_ribbon_name_list_snapshot(
+        int generation
+    );
+
+    /*!
+     * @brief Returns a snapshot of the name of every Super Training medal.
+     *
+     * \returns The shared snapshot, which later calls return again
+     */
+    PKMN_API list_snapshot<std::string> get_super_training_medal_name_list_snapshot();
+
+    /*!
+     * @brief Returns a snapshot of the moves taught by TMs in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<pkmn::e_move> get_tm_move_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the moves taught by TMs in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<std::string> get_tm_move_name_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the types in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<pkmn::e_type> get_type_list_snapshot(
+        pkmn::e_game game
+    );
+
+    /*!
+     * @brief Returns a snapshot of the names of the types in the given game.
+     *
+     * \param game Which game
+     * \returns The shared snapshot, which later calls return again
+     * \throws std::invalid_argument If the game is invalid
+     */
+    PKMN_API list_snapshot<std::string> get_type_name_list_snapshot(
+        pkmn::e_game game
+    );
+}}
+
+#endif /* PKMN_DATABASE_LIST_SNAPSHOTS_HPP */
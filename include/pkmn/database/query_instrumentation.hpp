@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP
+#define PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP
+
+#include <pkmn/config.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace pkmn { namespace database {
+
+    /*!
+     * @brief A single query made to LibPKMN's database.
+     */
+    struct query_event
+    {
+        //! The query's SQL text.
+        std::string query;
+
+        /*!
+         * @brief The outermost LibPKMN call that led to this query.
+         *
+         * This is empty if the query was made outside of any call LibPKMN
+         * tracks.
+         */
+        std::string entry_point;
+
+        /*!
+         * @brief How long the query's statement was in use, in nanoseconds.
+         *
+         * This includes preparing the statement, if it wasn't cached, and
+         * stepping through every row the caller read.
+         */
+        uint64_t duration_ns;
+    };
+
+    /*!
+     * @brief Statistics for every time a query was made from the same entry point.
+     *
+     * Percentiles are approximated with a logarithmic histogram, so they are
+     * accurate to within about 20%.
+     */
+    struct query_stats
+    {
+        //! The query's SQL text.
+        std::string query;
+        //! The outermost LibPKMN call that led to the query (see query_event).
+        std::string entry_point;
+        //! How many times the query was made.
+        uint64_t num_queries;
+        //! The total time spent on the query, in nanoseconds.
+        uint64_t total_duration_ns;
+        //! The median time spent on the query, in nanoseconds.
+        uint64_t median_duration_ns;
+        //! The 90th percentile time spent on the query, in nanoseconds.
+        uint64_t p90_duration_ns;
+        //! The 99th percentile time spent on the query, in nanoseconds.
+        uint64_t p99_duration_ns;
+        //! The longest time spent on the query, in nanoseconds.
+        uint64_t max_duration_ns;
+    };
+
+    typedef std::function<void(const pkmn::database::query_event&)> query_callback_t;
+
+    /*!
+     * @brief Sets whether queries to LibPKMN's database are recorded.
+     *
+     * This is disabled by default, as timing every query has a cost. It can
+     * also be enabled without code changes by setting the
+     * PKMN_DATABASE_INSTRUMENTATION environment variable before the database
+     * is first used.
+     *
+     * Disabling instrumentation keeps any statistics already recorded.
+     */
+    PKMN_API void set_query_instrumentation_enabled(
+        bool enabled
+    );
+
+    /*!
+     * @brief Returns whether queries to LibPKMN's database are being recorded.
+     */
+    PKMN_API bool is_query_instrumentation_enabled();
+
+    /*!
+     * @brief Returns statistics for every recorded query.
+     *
+     * Each SQL text and entry point pair has its own entry, ordered by the
+     * total time spent on it, longest first.
+     */
+    PKMN_API std::vector<pkmn::database::query_stats> get_query_stats();
+
+    /*!
+     * @brief Clears every recorded query statistic.
+     */
+    PKMN_API void reset_query_stats();
+
+    /*!
+     * @brief Sets a function to be called after every recorded query.
+     *
+     * The callback is called on the thread that made the query, so it must
+     * be thread-safe. Queries made from inside the callback are not
+     * recorded, and exceptions thrown from it are ignored.
+     *
+     * Passing an empty function removes the callback.
+     */
+    PKMN_API void set_query_callback(
+        const pkmn::database::query_callback_t& callback
+    );
+
+}}
+
+#endif /* PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP */
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKMN_ENUMS_LOAD_STATUS_HPP
+#define PKMN_ENUMS_LOAD_STATUS_HPP
+
+namespace pkmn
+{
+    /*!
+     * @brief The result of a try_from_file() call.
+     */
+    enum class e_load_status
+    {
+        //! The file was loaded.
+        SUCCESS = 0,
+        //! The given filepath does not exist.
+        FILE_NOT_FOUND = 1,
+        //! The file is not in any supported format.
+        INVALID_FILE = 2,
+        //! The file's format is recognized but not yet supported.
+        UNIMPLEMENTED = 3,
+        //! The file looked valid, but loading it failed.
+        LOAD_ERROR = 4,
+    };
+}
+
+#endif /* PKMN_ENUMS_LOAD_STATUS_HPP */
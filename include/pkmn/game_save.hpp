@@ -8,6 +8,9 @@
 #define PKMN_GAME_SAVE_HPP
 
 #include <pkmn/config.hpp>
+#include <pkmn/game_save_detection.hpp>
+#include <pkmn/game_save_load_result.hpp>
+#include <pkmn/game_save_summary.hpp>
 #include <pkmn/item_bag.hpp>
 #include <pkmn/item_list.hpp>
 #include <pkmn/pokedex.hpp>
@@ -17,6 +20,7 @@
 #include <pkmn/enums/game.hpp>
 #include <pkmn/enums/game_save_type.hpp>
 #include <pkmn/enums/gender.hpp>
+#include <pkmn/enums/load_status.hpp>
 
 #include <pkmn/types/class_with_attributes.hpp>
 #include <pkmn/types/time_duration.hpp>
@@ -57,6 +61,21 @@ namespace pkmn {
                 const std::string& filepath
             );
 
+            /*!
+             * @brief Returns what type of game save is at the given filepath,
+             *        along with how confident the detection is.
+             *
+             * Files whose size and signature bytes match no supported save format
+             * are rejected without any checksum validation, so this is suitable
+             * for cheaply filtering out files that are not saves.
+             *
+             * \param filepath The filepath to check
+             * \throws std::invalid_argument if the given filepath does not exist
+             */
+            static pkmn::game_save_detection detect_type_with_confidence(
+                const std::string& filepath
+            );
+
             /*!
              * @brief Imports the save from the game save at the given file.
              *
@@ -67,6 +86,53 @@ namespace pkmn {
                 const std::string& filepath
             );
 
+            /*!
+             * @brief Imports the save from the given file without throwing.
+             *
+             * This behaves like from_file(), but it reports failure through its
+             * return value, which is much cheaper when most files are expected
+             * to be invalid.
+             *
+             * \param filepath The filepath from which to import the save
+             * \param game_save_out Where to return the save, only set on success
+             * \returns Whether the save was loaded, and if not, why
+             */
+            static pkmn::e_load_status try_from_file(
+                const std::string& filepath,
+                sptr& game_save_out
+            ) noexcept;
+
+            /*!
+             * @brief Imports the saves at the given files, several at a time.
+             *
+             * Each file is loaded as by from_file() on one of a number of worker
+             * threads, which each take the next file not yet loaded. Nothing is
+             * thrown for individual files. Instead, the result for each file
+             * holds either its save or the reason it couldn't be loaded.
+             *
+             * \param filepaths The filepaths from which to import saves
+             * \param options How to load the files
+             * \returns The result for each file, in the same order as filepaths
+             */
+            static std::vector<pkmn::game_save_load_result> from_files(
+                const std::vector<std::string>& filepaths,
+                const pkmn::game_save_load_options& options = pkmn::game_save_load_options()
+            );
+
+            /*!
+             * @brief Reads commonly needed fields from the save at the given file.
+             *
+             * This is much faster than from_file(), as it reads the fields directly
+             * from the save instead of creating the full game_save, so it should be
+             * used when nothing else is needed.
+             *
+             * \param filepath The filepath of the save to read
+             * \throws std::invalid_argument if the given filepath is invalid
+             */
+            static pkmn::game_save_summary peek(
+                const std::string& filepath
+            );
+
             /*!
              * @brief Returns the path from which the given save was imported.
              */
@@ -75,8 +141,9 @@ namespace pkmn {
             /*!
              * @brief Saves the game save at its current filepath.
              *
-             * If the save operation fails, the save file will be in an unknown
-             * state.
+             * The save is written to a temporary file and then renamed over the
+             * existing file, so if the save operation fails, the existing file is
+             * left unchanged.
              *
              * \throws std::runtime_error if the save operation failed
              */
@@ -88,8 +155,9 @@ namespace pkmn {
              * No changes will be made to the file at the original path, and the
              * new filepath will be considered the current one.
              *
-             * If the save operation fails, the save file will be in an unknown
-             * state.
+             * The save is written to a temporary file and then renamed over the
+             * existing file, so if the save operation fails, the existing file is
+             * left unchanged.
              *
              * \param filepath The new filepath for the game save
              * \throws std::runtime_error if the save operation failed
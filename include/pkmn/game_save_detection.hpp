@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_GAME_SAVE_DETECTION_HPP
+#define PKMN_GAME_SAVE_DETECTION_HPP
+
+#include <pkmn/config.hpp>
+
+#include <pkmn/enums/game_save_type.hpp>
+
+namespace pkmn {
+
+    /*!
+     * @brief How far a file got through game save detection.
+     */
+    enum class e_game_save_detection_confidence
+    {
+        //! The file's size and signature bytes match no supported save format.
+        NONE = 0,
+        //! The file looks like a supported save format but failed validation.
+        SIGNATURE_MATCH,
+        //! The file passed the save format's full validation.
+        VALIDATED
+    };
+
+    /*!
+     * @brief The result of pkmn::game_save::detect_type_with_confidence().
+     *
+     * A save type other than pkmn::e_game_save_type::NONE is only given when
+     * the confidence is pkmn::e_game_save_detection_confidence::VALIDATED.
+     */
+    struct game_save_detection
+    {
+        pkmn::e_game_save_type save_type;
+        pkmn::e_game_save_detection_confidence confidence;
+
+        game_save_detection():
+            save_type(pkmn::e_game_save_type::NONE),
+            confidence(pkmn::e_game_save_detection_confidence::NONE)
+        {}
+    };
+
+}
+
+#endif /* PKMN_GAME_SAVE_DETECTION_HPP */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_GAME_SAVE_LOAD_RESULT_HPP
+#define PKMN_GAME_SAVE_LOAD_RESULT_HPP
+
+#include <pkmn/config.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace pkmn {
+
+    class game_save;
+
+    /*!
+     * @brief Options for pkmn::game_save::from_files().
+     */
+    struct game_save_load_options
+    {
+        //! How many files to load at once. If 0, one per hardware thread is used.
+        size_t num_workers;
+
+        game_save_load_options():
+            num_workers(0)
+        {}
+    };
+
+    /*!
+     * @brief The result of loading a single file in pkmn::game_save::from_files().
+     *
+     * If the file was loaded, save is set and error is empty. Otherwise, save
+     * is null and error holds the message from the exception that would have
+     * been thrown by pkmn::game_save::from_file().
+     */
+    struct game_save_load_result
+    {
+        std::string filepath;
+        std::shared_ptr<pkmn::game_save> save;
+        std::string error;
+
+        game_save_load_result():
+            filepath(),
+            save(),
+            error()
+        {}
+    };
+
+}
+
+#endif /* PKMN_GAME_SAVE_LOAD_RESULT_HPP */
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_GAME_SAVE_SUMMARY_HPP
+#define PKMN_GAME_SAVE_SUMMARY_HPP
+
+#include <pkmn/config.hpp>
+
+#include <pkmn/enums/game.hpp>
+#include <pkmn/enums/game_save_type.hpp>
+#include <pkmn/enums/species.hpp>
+
+#include <pkmn/types/time_duration.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pkmn {
+
+    /*!
+     * @brief The most commonly needed fields of a game save.
+     *
+     * This is returned by pkmn::game_save::peek(), which reads these values
+     * directly from the save without creating any Pokémon, item list, or
+     * Pokédex objects.
+     *
+     * Fields that a given game does not store are left at their default
+     * values.
+     */
+    struct game_save_summary
+    {
+        pkmn::e_game_save_type save_type;
+        pkmn::e_game game;
+
+        std::string trainer_name;
+        uint32_t trainer_id;
+
+        pkmn::time_duration time_played;
+        int money;
+
+        //! The species of each Pokémon in the party, in order.
+        std::vector<pkmn::e_species> party_species;
+        //! The level of each Pokémon in the party, in order.
+        std::vector<int> party_levels;
+
+        int num_pokedex_seen;
+        int num_pokedex_caught;
+
+        game_save_summary():
+            save_type(pkmn::e_game_save_type::NONE),
+            game(pkmn::e_game::NONE),
+            trainer_name(),
+            trainer_id(0),
+            time_played(),
+            money(0),
+            party_species(),
+            party_levels(),
+            num_pokedex_seen(0),
+            num_pokedex_caught(0)
+        {}
+    };
+
+}
+
+#endif /* PKMN_GAME_SAVE_SUMMARY_HPP */
@@ -12,6 +12,8 @@
 #include <pkmn/enums/game.hpp>
 #include <pkmn/enums/species.hpp>
 
+#include <pkmn/types/species_set.hpp>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -68,6 +70,16 @@ namespace pkmn
              */
             virtual const std::vector<pkmn::e_species>& get_all_seen() = 0;
 
+            /*!
+             * @brief Returns the set of all Pokémon registered as seen.
+             *
+             * This is the fastest way to compare what has been seen between
+             * Pokédexes. The default implementation builds the set from
+             * get_all_seen(), so existing subclasses still compile, although
+             * they must be recompiled against this version.
+             */
+            virtual pkmn::species_set get_seen_set();
+
             /*!
              * @brief Returns the number of Pokémon registered as seen.
              */
@@ -103,6 +115,16 @@ namespace pkmn
              */
             virtual const std::vector<pkmn::e_species>& get_all_caught() = 0;
 
+            /*!
+             * @brief Returns the set of all Pokémon registered as caught.
+             *
+             * This is the fastest way to compare what has been caught between
+             * Pokédexes. The default implementation builds the set from
+             * get_all_caught(), so existing subclasses still compile, although
+             * they must be recompiled against this version.
+             */
+            virtual pkmn::species_set get_caught_set();
+
             /*!
              * @brief Returns the number of Pokémon registered as caught.
              */
@@ -21,6 +21,7 @@
 #include <pkmn/enums/gender.hpp>
 #include <pkmn/enums/item.hpp>
 #include <pkmn/enums/language.hpp>
+#include <pkmn/enums/load_status.hpp>
 #include <pkmn/enums/marking.hpp>
 #include <pkmn/enums/move.hpp>
 #include <pkmn/enums/nature.hpp>
@@ -55,12 +56,49 @@ namespace pkmn {
                 const std::string& filepath
             );
 
+            /*!
+             * @brief Imports a Pokémon from the given file without throwing.
+             *
+             * This behaves like from_file(), but it reports failure through its
+             * return value, which is much cheaper when most files are expected
+             * to be invalid.
+             *
+             * \param filepath The filepath from which to import the Pokémon
+             * \param pokemon_out Where to return the Pokémon, only set on success
+             * \returns Whether the Pokémon was loaded, and if not, why
+             */
+            static pkmn::e_load_status try_from_file(
+                const std::string& filepath,
+                sptr& pokemon_out
+            ) noexcept;
+
             static const uint32_t DEFAULT_TRAINER_ID;
 
             static const std::string DEFAULT_TRAINER_NAME;
 
             virtual sptr to_game(pkmn::e_game game) = 0;
 
+            /*!
+             * @brief Returns a read-only copy of this Pokémon.
+             *
+             * The copy's getters take no locks, so it can be read from many
+             * threads at once, and its setters throw.
+             *
+             * Every Pokémon returned by LibPKMN implements this. The default
+             * implementation is only there so that existing subclasses still
+             * compile, although they must be recompiled against this version.
+             *
+             * 	hrows pkmn::unimplemented_error If a subclass doesn't implement it
+             */
+            virtual sptr snapshot();
+
+            /*!
+             * @brief Returns whether this Pokémon is a read-only snapshot.
+             *
+             * The default implementation returns false.
+             */
+            virtual bool is_snapshot();
+
             virtual void export_to_file(
                 const std::string& filepath
             ) = 0;
@@ -12,6 +12,7 @@
 
 #include <pkmn/enums/game.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -82,6 +83,47 @@ namespace pkmn
              */
             virtual const std::vector<std::string>& get_box_names() = 0;
 
+            /*!
+             * @brief Copies every box in the given PC into the box at the same
+             *        position in this PC.
+             *
+             * See the overload below for how Pokémon are copied.
+             *
+             * \param source_pc The PC whose Pokémon to copy
+             * \throws std::invalid_argument If the given PC has more boxes than this one
+             * \throws std::invalid_argument If the given PC's Pokémon can't be converted to this PC's game
+             */
+            virtual void transfer_from(
+                const pkmn::pokemon_pc::sptr& source_pc
+            ) = 0;
+
+            /*!
+             * @brief Copies boxes from the given PC into this PC.
+             *
+             * Every Pokémon in each source box replaces the Pokémon in the same
+             * position of the corresponding box in this PC, and empty positions
+             * are emptied. Box names and wallpapers are not copied.
+             *
+             * Pokémon are converted to this PC's game in bulk, working directly on
+             * the games' native representations where possible, and if this PC is
+             * part of a save, its Pokédex is updated once per box. This is much
+             * faster than copying each Pokémon with pkmn::pokemon_box::set_pokemon.
+             *
+             * Boxes are copied in order. If a box's Pokémon can't be converted,
+             * that box is left unchanged, but boxes before it have already been
+             * copied, and their Pokémon have already been added to the Pokédex.
+             *
+             * \param source_pc The PC whose Pokémon to copy
+             * \param box_mapping Each source box index mapped to the index of the box to replace in this PC
+             * \throws std::out_of_range If any box index is invalid
+             * \throws std::invalid_argument If two source boxes are mapped to the same box
+             * \throws std::invalid_argument If the given PC's Pokémon can't be converted to this PC's game
+             */
+            virtual void transfer_from(
+                const pkmn::pokemon_pc::sptr& source_pc,
+                const std::map<int, int>& box_mapping
+            ) = 0;
+
             #ifndef __DOXYGEN__
             pokemon_pc() {}
             virtual ~pokemon_pc() {}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 Nicholas Corgan (n.corgan@gmail.com)
+ * Copyright (c) 2017-2018 Nicholas Corgan (n.corgan@gmail.com)
  *
  * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
  * or copy at http://opensource.org/licenses/MIT)
@@ -11,51 +11,164 @@
 #include <pkmn/config.hpp>
 
 #include <algorithm>
-#include <exception>
-#include <functional>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace pkmn
 {
+    class class_with_attributes;
+
     template <typename T>
-    using getter_fcn = std::function<T(void)>;
+    class attribute_registry;
 
+    #ifndef __DOXYGEN__
     template <typename T>
-    using setter_fcn = std::function<void(T)>;
+    struct attribute_setter_arg
+    {
+        typedef T type;
+    };
 
+    template <>
+    struct attribute_setter_arg<std::string>
+    {
+        typedef const std::string& type;
+    };
+    #endif
+
+    /*!
+     * @brief A pre-resolved reference to a single attribute.
+     *
+     * A handle is resolved once by name, after which the attribute can be
+     * read or written without looking up its name again. All instances of the
+     * same implementation share a registry, so a handle resolved from one
+     * instance can be used with any other instance of the same type.
+     */
     template <typename T>
-    class attribute_engine
+    class attribute_handle
     {
         public:
-            attribute_engine() {}
-            ~attribute_engine() {};
+            attribute_handle():
+                _p_registry(nullptr),
+                _index(0)
+            {}
+
+            /*!
+             * @brief Returns whether this handle refers to an attribute.
+             */
+            inline bool is_valid() const
+            {
+                return (_p_registry != nullptr);
+            }
 
-            attribute_engine(const attribute_engine&) = default;
-            attribute_engine(attribute_engine&&) = default;
+            /*!
+             * @brief Returns the name of the attribute this handle refers to.
+             *
+             * \throws std::runtime_error If the handle is not valid
+             */
+            inline const std::string& get_name() const
+            {
+                if(!is_valid())
+                {
+                    throw std::runtime_error("This attribute handle is not valid.");
+                }
 
-            attribute_engine& operator=(const attribute_engine&) = default;
-            attribute_engine& operator=(attribute_engine&&) = default;
+                return _p_registry->get_attribute_name(_index);
+            }
 
-            T get_attribute(
-                const std::string& attribute_name
+        private:
+            friend class attribute_registry<T>;
+
+            attribute_handle(
+                const attribute_registry<T>* p_registry,
+                size_t index
+            ): _p_registry(p_registry),
+               _index(index)
+            {}
+
+            const attribute_registry<T>* _p_registry;
+            size_t _index;
+    };
+
+    /*!
+     * @brief A table of attribute getters and setters for one implementation.
+     *
+     * A registry is meant to be built once per implementation type and shared
+     * by all of its instances. It stores member function pointers rather than
+     * bound functions, so each instance only needs to keep a pointer to it.
+     */
+    template <typename T>
+    class attribute_registry
+    {
+        public:
+            typedef typename attribute_setter_arg<T>::type setter_arg_t;
+
+            attribute_registry() {}
+            ~attribute_registry() {}
+
+            attribute_registry(const attribute_registry&) = default;
+            attribute_registry(attribute_registry&&) = default;
+
+            attribute_registry& operator=(const attribute_registry&) = default;
+            attribute_registry& operator=(attribute_registry&&) = default;
+
+            /*!
+             * @brief Adds an attribute with the given getter and setter.
+             *
+             * Either function may be nullptr to make the attribute write-only
+             * or read-only, in which case the class must be given explicitly.
+             */
+            template <typename Class>
+            void register_attribute_fcns(
+                const std::string& attribute_name,
+                T (Class::*getter)(),
+                void (Class::*setter)(setter_arg_t)
             )
             {
-                if(_attribute_fcn_map.count(attribute_name) == 0)
+                attribute_fcn_pair_t attribute_fcn_pair =
+                {
+                    static_cast<getter_t>(getter),
+                    static_cast<setter_t>(setter)
+                };
+
+                if(_attribute_index_map.emplace(attribute_name, _attribute_fcn_pairs.size()).second)
+                {
+                    _attribute_names.emplace_back(attribute_name);
+                    _attribute_fcn_pairs.emplace_back(attribute_fcn_pair);
+                }
+            }
+
+            attribute_handle<T> get_attribute_handle(
+                const std::string& attribute_name
+            ) const
+            {
+                auto attribute_iter = _attribute_index_map.find(attribute_name);
+                if(attribute_iter == _attribute_index_map.end())
                 {
                     throw std::invalid_argument("Invalid attribute.");
                 }
 
-                const attribute_fcn_pair_t& attribute_fcn_pair = _attribute_fcn_map.at(attribute_name);
+                return attribute_handle<T>(this, attribute_iter->second);
+            }
+
+            T get_attribute(
+                class_with_attributes* p_object,
+                const attribute_handle<T>& handle
+            ) const
+            {
+                _check_handle(handle);
+
+                const attribute_fcn_pair_t& attribute_fcn_pair = _attribute_fcn_pairs[handle._index];
                 if(attribute_fcn_pair.getter)
                 {
-                    return attribute_fcn_pair.getter();
+                    return (p_object->*attribute_fcn_pair.getter)();
                 }
                 else
                 {
                     std::string error_message = "The attribute \"";
-                    error_message += attribute_name;
+                    error_message += _attribute_names[handle._index];
                     error_message += "\" is write-only.";
 
                     throw std::invalid_argument(error_message);
@@ -63,65 +176,62 @@ namespace pkmn
             }
 
             void set_attribute(
-                const std::string& attribute_name,
-                const T& value
-            )
+                class_with_attributes* p_object,
+                const attribute_handle<T>& handle,
+                setter_arg_t value
+            ) const
             {
-                if(_attribute_fcn_map.count(attribute_name) == 0)
-                {
-                    throw std::invalid_argument("Invalid attribute.");
-                }
+                _check_handle(handle);
 
-                const attribute_fcn_pair_t& attribute_fcn_pair = _attribute_fcn_map.at(attribute_name);
+                const attribute_fcn_pair_t& attribute_fcn_pair = _attribute_fcn_pairs[handle._index];
                 if(attribute_fcn_pair.setter)
                 {
-                    attribute_fcn_pair.setter(value);
+                    (p_object->*attribute_fcn_pair.setter)(value);
                 }
                 else
                 {
                     std::string error_message = "The attribute \"";
-                    error_message += attribute_name;
+                    error_message += _attribute_names[handle._index];
                     error_message += "\" is read-only.";
 
                     throw std::invalid_argument(error_message);
                 }
             }
 
-            void register_attribute_fcns(
-                const std::string& attribute_name,
-                const getter_fcn<T>& getter,
-                const setter_fcn<T>& setter
-            )
+            inline const std::string& get_attribute_name(size_t index) const
             {
-                attribute_fcn_pair_t attribute_fcn_pair = {getter, setter};
-
-                _attribute_fcn_map.emplace(
-                    attribute_name,
-                    attribute_fcn_pair
-                );
+                return _attribute_names.at(index);
             }
 
-            std::vector<std::string> get_attribute_names()
+            std::vector<std::string> get_attribute_names() const
             {
-                std::vector<std::string> ret;
-                for(const auto& attribute_iter: _attribute_fcn_map)
-                {
-                    ret.emplace_back(attribute_iter.first);
-                }
+                std::vector<std::string> ret = _attribute_names;
                 std::sort(ret.begin(), ret.end());
 
                 return ret;
             }
 
         private:
+            typedef T (class_with_attributes::*getter_t)();
+            typedef void (class_with_attributes::*setter_t)(setter_arg_t);
+
             struct attribute_fcn_pair_t
             {
-                getter_fcn<T> getter;
-                setter_fcn<T> setter;
+                getter_t getter;
+                setter_t setter;
             };
-            using attribute_fcn_map_t = std::unordered_map<std::string, attribute_fcn_pair_t>;
 
-            attribute_fcn_map_t _attribute_fcn_map;
+            inline void _check_handle(const attribute_handle<T>& handle) const
+            {
+                if(handle._p_registry != this)
+                {
+                    throw std::invalid_argument("This attribute handle does not belong to this class.");
+                }
+            }
+
+            std::vector<std::string> _attribute_names;
+            std::vector<attribute_fcn_pair_t> _attribute_fcn_pairs;
+            std::unordered_map<std::string, size_t> _attribute_index_map;
     };
 }
 
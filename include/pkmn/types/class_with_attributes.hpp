@@ -11,6 +11,12 @@
 
 namespace pkmn {
 
+    #ifndef SWIG
+    typedef attribute_handle<int> numeric_attribute_handle;
+    typedef attribute_handle<std::string> string_attribute_handle;
+    typedef attribute_handle<bool> boolean_attribute_handle;
+    #endif
+
     /*!
      * @brief A base class that gives derived classes the ability to get and
      *        set numeric, string, and boolean attributes.
@@ -21,7 +27,11 @@ namespace pkmn {
     {
         public:
             #ifndef __DOXYGEN__
-            class_with_attributes() {}
+            class_with_attributes():
+                _p_numeric_attribute_registry(nullptr),
+                _p_string_attribute_registry(nullptr),
+                _p_boolean_attribute_registry(nullptr)
+            {}
             ~class_with_attributes () {}
             #endif
 
@@ -35,7 +45,10 @@ namespace pkmn {
                 const std::string& attribute_name
             )
             {
-                return _numeric_attribute_engine.get_attribute(attribute_name);
+                return _get_attribute(
+                           _p_numeric_attribute_registry,
+                           _get_attribute_handle(_p_numeric_attribute_registry, attribute_name)
+                       );
             }
 
             /*!
@@ -55,7 +68,11 @@ namespace pkmn {
                 int value
             )
             {
-                _numeric_attribute_engine.set_attribute(attribute_name, value);
+                _set_attribute(
+                    _p_numeric_attribute_registry,
+                    _get_attribute_handle(_p_numeric_attribute_registry, attribute_name),
+                    value
+                );
             }
 
             /*!
@@ -68,8 +85,57 @@ namespace pkmn {
              */
             inline std::vector<std::string> get_numeric_attribute_names()
             {
-                return _numeric_attribute_engine.get_attribute_names();
+                return _get_attribute_names(_p_numeric_attribute_registry);
+            }
+
+            #ifndef SWIG
+            /*!
+             * @brief Resolves the numeric attribute with the given name into a handle.
+             *
+             * The handle can be passed to get_numeric_attribute() and
+             * set_numeric_attribute() on any instance of the same implementation
+             * to skip looking up the name on each call.
+             *
+             * \param attribute_name The name of the attribute to resolve
+             * \throws std::invalid_argument If the given attribute name doesn't exist
+             */
+            inline numeric_attribute_handle get_numeric_attribute_handle(
+                const std::string& attribute_name
+            )
+            {
+                return _get_attribute_handle(_p_numeric_attribute_registry, attribute_name);
+            }
+
+            /*!
+             * @brief Query the numeric attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_numeric_attribute_handle()
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is write-only
+             */
+            inline int get_numeric_attribute(
+                const numeric_attribute_handle& handle
+            )
+            {
+                return _get_attribute(_p_numeric_attribute_registry, handle);
+            }
+
+            /*!
+             * @brief Sets the numeric attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_numeric_attribute_handle()
+             * \param value The new value for the attribute
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is read-only
+             */
+            inline void set_numeric_attribute(
+                const numeric_attribute_handle& handle,
+                int value
+            )
+            {
+                _set_attribute(_p_numeric_attribute_registry, handle, value);
             }
+            #endif
 
             /*!
              * @brief Query the string attribute with the given name.
@@ -81,7 +147,10 @@ namespace pkmn {
                 const std::string& attribute_name
             )
             {
-                return _string_attribute_engine.get_attribute(attribute_name);
+                return _get_attribute(
+                           _p_string_attribute_registry,
+                           _get_attribute_handle(_p_string_attribute_registry, attribute_name)
+                       );
             }
 
             /*!
@@ -101,7 +170,11 @@ namespace pkmn {
                 const std::string& value
             )
             {
-                _string_attribute_engine.set_attribute(attribute_name, value);
+                _set_attribute(
+                    _p_string_attribute_registry,
+                    _get_attribute_handle(_p_string_attribute_registry, attribute_name),
+                    value
+                );
             }
 
             /*!
@@ -114,8 +187,57 @@ namespace pkmn {
              */
             inline std::vector<std::string> get_string_attribute_names()
             {
-                return _string_attribute_engine.get_attribute_names();
+                return _get_attribute_names(_p_string_attribute_registry);
+            }
+
+            #ifndef SWIG
+            /*!
+             * @brief Resolves the string attribute with the given name into a handle.
+             *
+             * The handle can be passed to get_string_attribute() and
+             * set_string_attribute() on any instance of the same implementation
+             * to skip looking up the name on each call.
+             *
+             * \param attribute_name The name of the attribute to resolve
+             * \throws std::invalid_argument If the given attribute name doesn't exist
+             */
+            inline string_attribute_handle get_string_attribute_handle(
+                const std::string& attribute_name
+            )
+            {
+                return _get_attribute_handle(_p_string_attribute_registry, attribute_name);
+            }
+
+            /*!
+             * @brief Query the string attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_string_attribute_handle()
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is write-only
+             */
+            inline std::string get_string_attribute(
+                const string_attribute_handle& handle
+            )
+            {
+                return _get_attribute(_p_string_attribute_registry, handle);
+            }
+
+            /*!
+             * @brief Sets the string attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_string_attribute_handle()
+             * \param value The new value for the attribute
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is read-only
+             */
+            inline void set_string_attribute(
+                const string_attribute_handle& handle,
+                const std::string& value
+            )
+            {
+                _set_attribute(_p_string_attribute_registry, handle, value);
             }
+            #endif
 
             /*!
              * @brief Query the boolean attribute with the given name.
@@ -127,7 +249,10 @@ namespace pkmn {
                 const std::string& attribute_name
             )
             {
-                return _boolean_attribute_engine.get_attribute(attribute_name);
+                return _get_attribute(
+                           _p_boolean_attribute_registry,
+                           _get_attribute_handle(_p_boolean_attribute_registry, attribute_name)
+                       );
             }
 
             /*!
@@ -147,7 +272,11 @@ namespace pkmn {
                 bool value
             )
             {
-                _boolean_attribute_engine.set_attribute(attribute_name, value);
+                _set_attribute(
+                    _p_boolean_attribute_registry,
+                    _get_attribute_handle(_p_boolean_attribute_registry, attribute_name),
+                    value
+                );
             }
 
             /*!
@@ -160,13 +289,117 @@ namespace pkmn {
              */
             inline std::vector<std::string> get_boolean_attribute_names()
             {
-                return _boolean_attribute_engine.get_attribute_names();
+                return _get_attribute_names(_p_boolean_attribute_registry);
+            }
+
+            #ifndef SWIG
+            /*!
+             * @brief Resolves the boolean attribute with the given name into a handle.
+             *
+             * The handle can be passed to get_boolean_attribute() and
+             * set_boolean_attribute() on any instance of the same implementation
+             * to skip looking up the name on each call.
+             *
+             * \param attribute_name The name of the attribute to resolve
+             * \throws std::invalid_argument If the given attribute name doesn't exist
+             */
+            inline boolean_attribute_handle get_boolean_attribute_handle(
+                const std::string& attribute_name
+            )
+            {
+                return _get_attribute_handle(_p_boolean_attribute_registry, attribute_name);
+            }
+
+            /*!
+             * @brief Query the boolean attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_boolean_attribute_handle()
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is write-only
+             */
+            inline bool get_boolean_attribute(
+                const boolean_attribute_handle& handle
+            )
+            {
+                return _get_attribute(_p_boolean_attribute_registry, handle);
+            }
+
+            /*!
+             * @brief Sets the boolean attribute referred to by the given handle.
+             *
+             * \param handle A handle from get_boolean_attribute_handle()
+             * \param value The new value for the attribute
+             * \throws std::invalid_argument If the handle comes from a different implementation
+             * \throws std::invalid_argument If the given attribute is read-only
+             */
+            inline void set_boolean_attribute(
+                const boolean_attribute_handle& handle,
+                bool value
+            )
+            {
+                _set_attribute(_p_boolean_attribute_registry, handle, value);
             }
+            #endif
 
         protected:
-            pkmn::attribute_engine<int> _numeric_attribute_engine;
-            pkmn::attribute_engine<std::string> _string_attribute_engine;
-            pkmn::attribute_engine<bool> _boolean_attribute_engine;
+            // Implementations point these at registries shared by all of
+            // their instances.
+            const pkmn::attribute_registry<int>* _p_numeric_attribute_registry;
+            const pkmn::attribute_registry<std::string>* _p_string_attribute_registry;
+            const pkmn::attribute_registry<bool>* _p_boolean_attribute_registry;
+
+        private:
+            template <typename T>
+            static attribute_handle<T> _get_attribute_handle(
+                const pkmn::attribute_registry<T>* p_registry,
+                const std::string& attribute_name
+            )
+            {
+                if(!p_registry)
+                {
+                    throw std::invalid_argument("Invalid attribute.");
+                }
+
+                return p_registry->get_attribute_handle(attribute_name);
+            }
+
+            template <typename T>
+            T _get_attribute(
+                const pkmn::attribute_registry<T>* p_registry,
+                const attribute_handle<T>& handle
+            )
+            {
+                if(!p_registry)
+                {
+                    throw std::invalid_argument("This attribute handle does not belong to this class.");
+                }
+
+                return p_registry->get_attribute(this, handle);
+            }
+
+            template <typename T>
+            void _set_attribute(
+                const pkmn::attribute_registry<T>* p_registry,
+                const attribute_handle<T>& handle,
+                typename attribute_setter_arg<T>::type value
+            )
+            {
+                if(!p_registry)
+                {
+                    throw std::invalid_argument("This attribute handle does not belong to this class.");
+                }
+
+                p_registry->set_attribute(this, handle, value);
+            }
+
+            template <typename T>
+            static std::vector<std::string> _get_attribute_names(
+                const pkmn::attribute_registry<T>* p_registry
+            )
+            {
+                return p_registry ? p_registry->get_attribute_names()
+                                  : std::vector<std::string>();
+            }
     };
 }
 
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_TYPES_SPECIES_SET_HPP
+#define PKMN_TYPES_SPECIES_SET_HPP
+
+#include <pkmn/config.hpp>
+
+#include <pkmn/enums/species.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace pkmn
+{
+    /*!
+     * @brief A set of species, stored as one bit per National Pokédex number.
+     *
+     * This is how a Pokédex's seen and caught lists are stored, so counting
+     * and comparing them works on 64 species at a time. For example, the
+     * Pokémon caught in one Pokédex but not another are:
+     *
+     * \code
+     * pkmn::species_set difference = pokedex1->get_caught_set() - pokedex2->get_caught_set();
+     * \endcode
+     *
+     * Iterating over the set gives each species in order of National Pokédex
+     * number.
+     */
+    class PKMN_API species_set
+    {
+        public:
+            #ifndef SWIG
+            class const_iterator
+            {
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef pkmn::e_species value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef const pkmn::e_species* pointer;
+                    typedef pkmn::e_species reference;
+
+                    const_iterator(): _p_set(nullptr), _pokedex_num(0) {}
+
+                    inline pkmn::e_species operator*() const
+                    {
+                        return static_cast<pkmn::e_species>(_pokedex_num);
+                    }
+
+                    inline const_iterator& operator++()
+                    {
+                        _pokedex_num = _p_set->_next_pokedex_num(_pokedex_num);
+                        return *this;
+                    }
+
+                    inline const_iterator operator++(int)
+                    {
+                        const_iterator ret = *this;
+                        ++(*this);
+                        return ret;
+                    }
+
+                    inline bool operator==(const const_iterator& rhs) const
+                    {
+                        return (_p_set == rhs._p_set) && (_pokedex_num == rhs._pokedex_num);
+                    }
+
+                    inline bool operator!=(const const_iterator& rhs) const
+                    {
+                        return !operator==(rhs);
+                    }
+
+                private:
+                    friend class species_set;
+
+                    const_iterator(
+                        const species_set* p_set,
+                        size_t pokedex_num
+                    ): _p_set(p_set), _pokedex_num(pokedex_num)
+                    {}
+
+                    const species_set* _p_set;
+                    size_t _pokedex_num;
+            };
+            #endif
+
+            /*!
+             * @brief Creates an empty set.
+             */
+            species_set(): _words() {}
+
+            #if !defined(__DOXYGEN__) && !defined(SWIG)
+            // Reads a native Pokédex buffer, where the bit for each
+            // National Pokédex number N is bit ((N-1) % 8) of byte
+            // ((N-1) / 8).
+            species_set(
+                const uint8_t* p_native_buffer,
+                size_t num_pokemon
+            );
+            #endif
+
+            /*!
+             * @brief Returns whether the given species is in the set.
+             */
+            bool contains(
+                pkmn::e_species species
+            ) const;
+
+            /*!
+             * @brief Adds the given species to the set, or removes it.
+             *
+             * \param species The species to add or remove
+             * \param value Whether the species should be in the set
+             * \throws std::invalid_argument If the species is invalid
+             */
+            void set(
+                pkmn::e_species species,
+                bool value
+            );
+
+            /*!
+             * @brief Returns the number of species in the set.
+             */
+            size_t size() const;
+
+            /*!
+             * @brief Returns whether the set has no species.
+             */
+            bool empty() const;
+
+            /*!
+             * @brief Returns every species in the set, ordered by National
+             *        Pokédex number.
+             */
+            std::vector<pkmn::e_species> as_vector() const;
+
+            #ifndef SWIG
+            const_iterator begin() const;
+
+            inline const_iterator end() const
+            {
+                return const_iterator(this, 0);
+            }
+            #endif
+
+            //! Species in either set
+            species_set& operator|=(const species_set& rhs);
+            //! Species in both sets
+            species_set& operator&=(const species_set& rhs);
+            //! Species in this set but not the other
+            species_set& operator-=(const species_set& rhs);
+
+            inline species_set operator|(const species_set& rhs) const
+            {
+                species_set ret(*this);
+                ret |= rhs;
+                return ret;
+            }
+
+            inline species_set operator&(const species_set& rhs) const
+            {
+                species_set ret(*this);
+                ret &= rhs;
+                return ret;
+            }
+
+            inline species_set operator-(const species_set& rhs) const
+            {
+                species_set ret(*this);
+                ret -= rhs;
+                return ret;
+            }
+
+            bool operator==(const species_set& rhs) const;
+
+            inline bool operator!=(const species_set& rhs) const
+            {
+                return !operator==(rhs);
+            }
+
+        private:
+            // Bit B of word W is National Pokédex number (W*64)+B+1.
+            std::vector<uint64_t> _words;
+
+            // Returns 0 when there are no more species.
+            size_t _next_pokedex_num(
+                size_t pokedex_num
+            ) const;
+    };
+}
+
+#endif /* PKMN_TYPES_SPECIES_SET_HPP */
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_UTILS_RANDOM_HPP
+#define PKMN_UTILS_RANDOM_HPP
+
+#include <pkmn/config.hpp>
+
+#include <cstdint>
+
+namespace pkmn {
+
+    /*!
+     * @brief Seeds the random number generator for the calling thread.
+     *
+     * Everything LibPKMN generates randomly, such as new Pokémon's
+     * personalities and IVs, comes from a per-thread generator. After this
+     * call, the same sequence of calls on this thread produces the same
+     * values, which is useful for reproducible test data.
+     *
+     * Threads that never call this function are seeded automatically.
+     *
+     * \param seed The seed to use
+     */
+    PKMN_API void seed_rng(
+        uint64_t seed
+    );
+
+}
+
+#endif /* PKMN_UTILS_RANDOM_HPP */
@@ -258,6 +258,16 @@ public:
         return mFilename;
     }
 
+    /**
+     * @brief Return raw pointer to SQLite Database Connection Handle.
+     *
+     * This is often needed to mix this wrapper with other libraries or for advance usage not supported by SQLiteCpp.
+     */
+    inline sqlite3* getHandle() const noexcept // nothrow
+    {
+        return mpSQLite;
+    }
+
     /// @brief Return the numeric result code for the most recent failed API call (if any).
     inline int getErrorCode() const noexcept // nothrow
     {
@@ -48,21 +48,21 @@ namespace pkmn { namespace breeding {
             "(SELECT evolves_from_species_id FROM pokemon_species WHERE id=?)";
 
         int query_species_id = species_id;
-        SQLite::Statement stmt(pkmn::database::get_connection(), evolution_query);
-        stmt.bind(1, generation);
-        stmt.bind(2, query_species_id);
-        while(stmt.executeStep())
+        pkmn::database::cached_statement stmt(evolution_query);
+        stmt->bind(1, generation);
+        stmt->bind(2, query_species_id);
+        while(stmt->executeStep())
         {
             // The final query will be valid but return 0, which we can't use
-            if(int(stmt.getColumn(0)) == 0)
+            if(int(stmt->getColumn(0)) == 0)
             {
                 break;
             }
-            query_species_id = stmt.getColumn(0);
-            stmt.reset();
-            stmt.clearBindings();
-            stmt.bind(1, generation);
-            stmt.bind(2, query_species_id);
+            query_species_id = stmt->getColumn(0);
+            stmt->reset();
+            stmt->clearBindings();
+            stmt->bind(1, generation);
+            stmt->bind(2, query_species_id);
         }
 
         return static_cast<pkmn::e_species>(query_species_id);
@@ -42,6 +42,7 @@ namespace pkmn { namespace c {
 
         p_internal->cpp = libpkmn_sptr;
         p_internal->last_error = "None";
+        p_internal->has_error = false;
         p_internal->generation = pkmn::priv::game_enum_to_generation(
                                      libpkmn_sptr->get_game()
                                  );
@@ -59,6 +59,7 @@
 #include <boost/config.hpp>
 #include <boost/thread/mutex.hpp>
 
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <string>
@@ -92,8 +93,11 @@ template <typename libpkmn_type>
 struct pkmn_c_internal_class_t
 {
     std::shared_ptr<libpkmn_type> cpp;
+
+    // See PKMN_SET_HANDLE_ERROR and PKMN_CLEAR_HANDLE_ERROR.
     boost::mutex error_mutex;
     std::string last_error;
+    std::atomic<bool> has_error;
 
     int generation;
 };
@@ -120,6 +124,24 @@ typedef pkmn_c_internal_class_t<pkmn::pokemon_pc> pkmn_pokemon_pc_internal_t;
 
 namespace pkmn { namespace c {
 
+    // Only locks the handle if it has an error to return.
+    template <typename libpkmn_type>
+    const char* get_handle_error(
+        pkmn_c_internal_class_t<libpkmn_type>* p_internal
+    )
+    {
+        BOOST_ASSERT(p_internal != nullptr);
+
+        const char* ret = "None";
+        if(p_internal->has_error)
+        {
+            boost::mutex::scoped_lock lock(p_internal->error_mutex);
+            ret = p_internal->last_error.c_str();
+        }
+
+        return ret;
+    }
+
     template <typename value_type>
     void set_to_value_for_invalid_enum(
         value_type* p_value
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "cpp_to_c.hpp"
+#include "error_internal.hpp"
+
+#include <pkmn-c/database/query_instrumentation.h>
+
+#include <pkmn/database/query_instrumentation.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+enum pkmn_error pkmn_database_set_query_instrumentation_enabled(
+    bool enabled
+)
+{
+    PKMN_CPP_TO_C(
+        pkmn::database::set_query_instrumentation_enabled(enabled);
+    )
+}
+
+enum pkmn_error pkmn_database_is_query_instrumentation_enabled(
+    bool* p_enabled_out
+)
+{
+    PKMN_CHECK_NULL_PARAM(p_enabled_out);
+
+    PKMN_CPP_TO_C(
+        *p_enabled_out = pkmn::database::is_query_instrumentation_enabled();
+    )
+}
+
+enum pkmn_error pkmn_database_get_query_stats(
+    struct pkmn_database_query_stats_list* p_query_stats_list_out
+)
+{
+    PKMN_CHECK_NULL_PARAM(p_query_stats_list_out);
+
+    PKMN_CPP_TO_C(
+        std::vector<pkmn::database::query_stats> query_stats_cpp =
+            pkmn::database::get_query_stats();
+
+        struct pkmn_database_query_stats_list query_stats_list_c = {nullptr, 0};
+        if(!query_stats_cpp.empty())
+        {
+            query_stats_list_c.p_query_stats =
+                (struct pkmn_database_query_stats*)std::calloc(
+                                                       query_stats_cpp.size(),
+                                                       sizeof(struct pkmn_database_query_stats)
+                                                   );
+            if(!query_stats_list_c.p_query_stats)
+            {
+                throw std::bad_alloc();
+            }
+            query_stats_list_c.length = query_stats_cpp.size();
+
+            for(size_t stats_index = 0; stats_index < query_stats_cpp.size(); ++stats_index)
+            {
+                const pkmn::database::query_stats& query_stats = query_stats_cpp[stats_index];
+                struct pkmn_database_query_stats* p_query_stats_c =
+                    &query_stats_list_c.p_query_stats[stats_index];
+
+                pkmn::c::string_cpp_to_c_alloc(
+                    query_stats.query,
+                    &p_query_stats_c->p_query
+                );
+                pkmn::c::string_cpp_to_c_alloc(
+                    query_stats.entry_point,
+                    &p_query_stats_c->p_entry_point
+                );
+                p_query_stats_c->num_queries = query_stats.num_queries;
+                p_query_stats_c->total_duration_ns = query_stats.total_duration_ns;
+                p_query_stats_c->median_duration_ns = query_stats.median_duration_ns;
+                p_query_stats_c->p90_duration_ns = query_stats.p90_duration_ns;
+                p_query_stats_c->p99_duration_ns = query_stats.p99_duration_ns;
+                p_query_stats_c->max_duration_ns = query_stats.max_duration_ns;
+            }
+        }
+
+        *p_query_stats_list_out = query_stats_list_c;
+    )
+}
+
+enum pkmn_error pkmn_database_reset_query_stats()
+{
+    PKMN_CPP_TO_C(
+        pkmn::database::reset_query_stats();
+    )
+}
+
+enum pkmn_error pkmn_database_set_query_callback(
+    pkmn_database_query_callback_t query_callback,
+    void* p_user_data
+)
+{
+    PKMN_CPP_TO_C(
+        if(query_callback)
+        {
+            pkmn::database::set_query_callback(
+                [query_callback, p_user_data](const pkmn::database::query_event& event)
+                {
+                    struct pkmn_database_query_event event_c =
+                    {
+                        event.query.c_str(),
+                        event.entry_point.c_str(),
+                        event.duration_ns
+                    };
+
+                    query_callback(&event_c, p_user_data);
+                }
+            );
+        }
+        else
+        {
+            pkmn::database::set_query_callback(pkmn::database::query_callback_t());
+        }
+    )
+}
+
+enum pkmn_error pkmn_database_query_stats_list_free(
+    struct pkmn_database_query_stats_list* p_query_stats_list
+)
+{
+    PKMN_CHECK_NULL_PARAM(p_query_stats_list);
+
+    for(size_t stats_index = 0; stats_index < p_query_stats_list->length; ++stats_index)
+    {
+        pkmn::c::free_pointer_and_set_to_null(
+            &p_query_stats_list->p_query_stats[stats_index].p_query
+        );
+        pkmn::c::free_pointer_and_set_to_null(
+            &p_query_stats_list->p_query_stats[stats_index].p_entry_point
+        );
+    }
+    pkmn::c::free_pointer_and_set_to_null(&p_query_stats_list->p_query_stats);
+    p_query_stats_list->length = 0;
+
+    return PKMN_ERROR_NONE;
+}
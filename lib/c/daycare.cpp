@@ -65,8 +65,7 @@ const char* pkmn_daycare_strerror(
             return nullptr;
         }
 
-        boost::mutex::scoped_lock lock(p_internal->error_mutex);
-        return p_internal->last_error.c_str();
+        return pkmn::c::get_handle_error(p_internal);
     }
     catch(...)
     {
@@ -13,34 +13,35 @@
 
 #include <pkmn-c/error.h>
 
-#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 
 #include <string>
 
-struct error_struct
-{
-    std::string error;
-    boost::mutex error_mutex;
-
-    error_struct():
-        error("None")
-    {}
-};
+// Each thread gets its own error, so setting it never contends with other
+// threads, and the pointer returned by pkmn_strerror() can't be overwritten
+// by a call made on another thread.
+static boost::thread_specific_ptr<std::string> thread_error;
 
-static struct error_struct global_error;
+static std::string& get_thread_error()
+{
+    std::string* p_error = thread_error.get();
+    if(!p_error)
+    {
+        p_error = new std::string("None");
+        thread_error.reset(p_error);
+    }
+
+    return *p_error;
+}
 
 void pkmn_set_error(
     const std::string& error
 )
 {
-    boost::mutex::scoped_lock lock(global_error.error_mutex);
-
-    global_error.error = error;
+    get_thread_error() = error;
 }
 
 const char* pkmn_strerror()
 {
-    boost::mutex::scoped_lock lock(global_error.error_mutex);
-
-    return global_error.error.c_str();
+    return get_thread_error().c_str();
 }
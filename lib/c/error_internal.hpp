@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2017 Nicholas Corgan (n.corgan@gmail.com)
+ * Copyright (c) 2016-2018 Nicholas Corgan (n.corgan@gmail.com)
  *
  * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
  * or copy at http://opensource.org/licenses/MIT)
@@ -13,15 +13,40 @@
 #include <pkmn/exception.hpp>
 
 #include <boost/format.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <cstring>
 #include <stdexcept>
 #include <string>
 
+// Each thread has its own error, which is what pkmn_strerror() returns.
 void pkmn_set_error(
     const std::string& error
 );
 
+/*
+ * Handles store the error from the last call made on them. The handle's
+ * mutex is only taken when setting an error or clearing a previous one, so
+ * successful calls on a handle don't contend with each other.
+ */
+
+#define PKMN_SET_HANDLE_ERROR(h, message) \
+{ \
+    boost::mutex::scoped_lock handle_error_lock(h->error_mutex); \
+    h->last_error = message; \
+    h->has_error = true; \
+}
+
+#define PKMN_CLEAR_HANDLE_ERROR(h) \
+{ \
+    if(h->has_error) \
+    { \
+        boost::mutex::scoped_lock handle_error_lock(h->error_mutex); \
+        h->last_error = "None"; \
+        h->has_error = false; \
+    } \
+}
+
 #define PKMN_CHECK_NULL_WRAPPER_PARAM(param) \
 { \
     if(param) \
@@ -53,17 +78,15 @@ void pkmn_set_error(
     { \
         if(!param->p_internal) \
         { \
-            boost::mutex::scoped_lock lock(handle->error_mutex); \
             pkmn_set_error("The parameter \"" #param "\" has not been initialized."); \
-            handle->last_error = "The parameter \"" #param "\" has not been initialized."; \
+            PKMN_SET_HANDLE_ERROR(handle, "The parameter \"" #param "\" has not been initialized."); \
             return PKMN_ERROR_NULL_POINTER; \
         } \
     } \
     else \
     { \
-        boost::mutex::scoped_lock lock(handle->error_mutex); \
         pkmn_set_error("Null pointer passed into parameter \"" #param "\""); \
-        handle->last_error = "Null pointer passed into parameter \"" #param "\""; \
+        PKMN_SET_HANDLE_ERROR(handle, "Null pointer passed into parameter \"" #param "\""); \
         return PKMN_ERROR_NULL_POINTER; \
     } \
 }
@@ -71,9 +94,8 @@ void pkmn_set_error(
 #define PKMN_CHECK_NULL_PARAM_WITH_HANDLE(param, handle) \
 { \
     if(!param) { \
-        boost::mutex::scoped_lock lock(handle->error_mutex); \
         pkmn_set_error("Null pointer passed into parameter \"" #param "\""); \
-        handle->last_error = "Null pointer passed into parameter \"" #param "\""; \
+        PKMN_SET_HANDLE_ERROR(handle, "Null pointer passed into parameter \"" #param "\""); \
         return PKMN_ERROR_NULL_POINTER; \
     } \
 }
@@ -169,84 +191,83 @@ void pkmn_set_error(
 #define PKMN_CPP_TO_C_WITH_HANDLE(h,...) \
 { \
     enum pkmn_error error = PKMN_ERROR_NONE; \
-    boost::mutex::scoped_lock lock(h->error_mutex); \
     try \
     { \
         __VA_ARGS__ ; \
         pkmn_set_error("None"); \
-        h->last_error = "None"; \
+        PKMN_CLEAR_HANDLE_ERROR(h); \
         error = PKMN_ERROR_NONE; \
     } \
     catch(const pkmn::unimplemented_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_UNIMPLEMENTED_ERROR; \
     } \
     catch(const pkmn::feature_not_in_game_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_FEATURE_NOT_IN_GAME_ERROR; \
     } \
     catch(const pkmn::feature_not_in_build_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_FEATURE_NOT_IN_BUILD_ERROR; \
     } \
     catch(const std::invalid_argument &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_INVALID_ARGUMENT; \
     } \
     catch(const std::domain_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_DOMAIN_ERROR; \
     } \
     catch(const std::length_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_LENGTH_ERROR; \
     } \
     catch(const std::out_of_range &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_OUT_OF_RANGE; \
     } \
     catch(const std::logic_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_LOGIC_ERROR; \
     } \
     catch(const std::range_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_RANGE_ERROR; \
     } \
     catch(const std::overflow_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_OVERFLOW_ERROR; \
     } \
     catch(const std::underflow_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_UNDERFLOW_ERROR; \
     } \
     catch(const std::runtime_error &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         if(strstr(e.what(), "Internal error") != nullptr) \
         { \
             error = PKMN_ERROR_INTERNAL_ERROR; \
@@ -259,13 +280,13 @@ void pkmn_set_error(
     catch(const std::exception &e) \
     { \
         pkmn_set_error(e.what()); \
-        h->last_error = e.what(); \
+        PKMN_SET_HANDLE_ERROR(h, e.what()); \
         error = PKMN_ERROR_STD_EXCEPTION; \
     } \
     catch(...) \
     { \
         pkmn_set_error("Unknown error"); \
-        h->last_error = "Unknown error"; \
+        PKMN_SET_HANDLE_ERROR(h, "Unknown error"); \
         error = PKMN_ERROR_UNKNOWN_ERROR; \
     } \
     return error; \
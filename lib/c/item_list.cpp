@@ -69,8 +69,7 @@ const char* pkmn_item_list_strerror(
             return nullptr;
         }
 
-        boost::mutex::scoped_lock lock(p_internal->error_mutex);
-        return p_internal->last_error.c_str();
+        return pkmn::c::get_handle_error(p_internal);
     }
     catch(...)
     {
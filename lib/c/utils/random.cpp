@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "cpp_to_c.hpp"
+#include "error_internal.hpp"
+
+#include <pkmn-c/utils/random.h>
+
+#include <pkmn/utils/random.hpp>
+
+enum pkmn_error pkmn_seed_rng(
+    uint64_t seed
+)
+{
+    PKMN_CPP_TO_C(
+        pkmn::seed_rng(seed);
+    )
+}
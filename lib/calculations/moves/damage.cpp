@@ -6,11 +6,28 @@
  */
 
 #include "exception_internal.hpp"
+#include "calculations/moves/type_chart.hpp"
 
+#include <pkmn/calculations/moves/critical_hit.hpp>
 #include <pkmn/calculations/moves/damage.hpp>
+#include <pkmn/calculations/moves/modifiers.hpp>
+
+#include <array>
+#include <vector>
 
 namespace pkmn { namespace calculations {
 
+    // Everything before the modifier is applied, which is shared by every
+    // roll of a given matchup.
+    static PKMN_CONSTEXPR_OR_INLINE float _unmodified_damage(
+        float level,
+        float power,
+        float attack,
+        float defense
+    ) {
+        return (((((2.0f * level) / 5.0f) + 2.0f) * power * (attack / defense)) / 50.0f) + 2.0f;
+    }
+
     static PKMN_CONSTEXPR_OR_INLINE int _damage(
         float level,
         float power,
@@ -18,15 +35,14 @@ namespace pkmn { namespace calculations {
         float defense,
         float modifier
     ) {
-        return int(((((((2.0f * level) / 5.0f) + 2.0f) * power * (attack / defense)) / 50.0f) + 2.0f) * modifier);
+        return int(_unmodified_damage(level, power, attack, defense) * modifier);
     }
 
-    int damage(
+    static void enforce_damage_params(
         int attacker_level,
         int move_base_power,
         int attack_stat,
-        int defense_stat,
-        float modifier
+        int defense_stat
     ) {
         pkmn::enforce_bounds(
             "Attacker level",
@@ -43,6 +59,21 @@ namespace pkmn { namespace calculations {
         if(defense_stat < 0) {
             throw std::out_of_range("defense_stat must be > 0.");
         }
+    }
+
+    int damage(
+        int attacker_level,
+        int move_base_power,
+        int attack_stat,
+        int defense_stat,
+        float modifier
+    ) {
+        enforce_damage_params(
+            attacker_level,
+            move_base_power,
+            attack_stat,
+            defense_stat
+        );
         if(modifier < 0.0f) {
             throw std::out_of_range("modifier must be > 0.0f.");
         }
@@ -56,4 +87,104 @@ namespace pkmn { namespace calculations {
                );
     }
 
+    // Returns a negative value if the matchup isn't in the type chart.
+    static inline float _type_modifier(
+        const type_chart& chart,
+        pkmn::e_type move_type,
+        const pkmn::type_pair_t& defender_types
+    ) {
+        float ret = chart.get_modifier(move_type, defender_types.first);
+
+        if((ret >= 0.0f) &&
+           (defender_types.second != pkmn::e_type::NONE) &&
+           (defender_types.second != defender_types.first)) {
+            float second_modifier = chart.get_modifier(move_type, defender_types.second);
+            ret = (second_modifier >= 0.0f) ? (ret * second_modifier) : second_modifier;
+        }
+
+        return ret;
+    }
+
+    std::vector<pkmn::calculations::damage_range> damage_ranges(
+        int generation,
+        const std::vector<pkmn::calculations::damage_matchup>& matchups
+    ) {
+        const type_chart& chart = get_type_chart(generation);
+
+        // Generation I's critical hit modifier depends on the level, so
+        // it's calculated for each matchup.
+        const float critical_hit_modifier = (generation == 1) ? 0.0f
+                                          : pkmn::calculations::critical_hit_modifier(generation);
+
+        std::array<float, NUM_DAMAGE_ROLLS> roll_modifiers;
+        for(int roll_index = 0; roll_index < NUM_DAMAGE_ROLLS; ++roll_index) {
+            roll_modifiers[roll_index] = float(85 + roll_index) / 100.0f;
+        }
+
+        std::vector<pkmn::calculations::damage_range> ret(matchups.size());
+
+        for(size_t matchup_index = 0; matchup_index < matchups.size(); ++matchup_index) {
+            const pkmn::calculations::damage_matchup& matchup = matchups[matchup_index];
+            pkmn::calculations::damage_range& r_damage_range = ret[matchup_index];
+
+            enforce_damage_params(
+                matchup.attacker_level,
+                matchup.move_base_power,
+                matchup.attack_stat,
+                matchup.defense_stat
+            );
+
+            r_damage_range.type_modifier = _type_modifier(
+                                               chart,
+                                               matchup.move_type,
+                                               matchup.defender_types
+                                           );
+            if(r_damage_range.type_modifier < 0.0f) {
+                // Let the single-matchup function throw the appropriate
+                // error for whichever type is invalid.
+                r_damage_range.type_modifier = pkmn::calculations::type_damage_modifier(
+                                                   generation,
+                                                   matchup.move_type,
+                                                   matchup.defender_types.first
+                                               );
+                if((matchup.defender_types.second != pkmn::e_type::NONE) &&
+                   (matchup.defender_types.second != matchup.defender_types.first)) {
+                    r_damage_range.type_modifier *= pkmn::calculations::type_damage_modifier(
+                                                        generation,
+                                                        matchup.move_type,
+                                                        matchup.defender_types.second
+                                                    );
+                }
+            }
+
+            r_damage_range.has_STAB = (matchup.move_type == matchup.attacker_types.first) ||
+                                      (matchup.move_type == matchup.attacker_types.second);
+
+            const float modifier = r_damage_range.type_modifier *
+                                   (r_damage_range.has_STAB ? STAB_MODIFIER : 1.0f);
+            const float critical_hit_damage_modifier = modifier * (
+                (generation == 1) ? pkmn::calculations::gen1_critical_hit_modifier(matchup.attacker_level)
+                                  : critical_hit_modifier
+            );
+
+            const float unmodified_damage = _unmodified_damage(
+                                                float(matchup.attacker_level),
+                                                float(matchup.move_base_power),
+                                                float(matchup.attack_stat),
+                                                float(matchup.defense_stat)
+                                            );
+
+            for(int roll_index = 0; roll_index < NUM_DAMAGE_ROLLS; ++roll_index) {
+                r_damage_range.rolls[roll_index] = int(
+                    unmodified_damage * (modifier * roll_modifiers[roll_index])
+                );
+                r_damage_range.critical_hit_rolls[roll_index] = int(
+                    unmodified_damage * (critical_hit_damage_modifier * roll_modifiers[roll_index])
+                );
+            }
+        }
+
+        return ret;
+    }
+
 }}
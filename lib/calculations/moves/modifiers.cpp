@@ -10,12 +10,119 @@
 #include <pkmn/enums/enum_to_string.hpp>
 
 #include "exception_internal.hpp"
+#include "calculations/moves/type_chart.hpp"
 #include "database/database_common.hpp"
+#include "database/lookup_tables.hpp"
 
 #include <boost/format.hpp>
 
+#include <array>
+#include <vector>
+
 namespace pkmn { namespace calculations {
 
+    static bool is_type_in_generation(
+        pkmn::e_type type,
+        int generation
+    )
+    {
+        bool ret = (type != pkmn::e_type::NONE) && (type != pkmn::e_type::INVALID);
+
+        if((generation < 2) && ((type == pkmn::e_type::DARK) || (type == pkmn::e_type::STEEL)))
+        {
+            ret = false;
+        }
+        else if((generation != 3) && (type == pkmn::e_type::SHADOW))
+        {
+            ret = false;
+        }
+        else if((generation != 4) && (type == pkmn::e_type::QUESTION_MARK))
+        {
+            ret = false;
+        }
+        else if((generation < 6) && (type == pkmn::e_type::FAIRY))
+        {
+            ret = false;
+        }
+
+        return ret;
+    }
+
+    type_chart::type_chart(
+        int generation
+    )
+    {
+        static const std::vector<pkmn::e_type> ALL_TYPES =
+        {
+            pkmn::e_type::NORMAL, pkmn::e_type::FIGHTING, pkmn::e_type::FLYING,
+            pkmn::e_type::POISON, pkmn::e_type::GROUND, pkmn::e_type::ROCK,
+            pkmn::e_type::BUG, pkmn::e_type::GHOST, pkmn::e_type::STEEL,
+            pkmn::e_type::FIRE, pkmn::e_type::WATER, pkmn::e_type::GRASS,
+            pkmn::e_type::ELECTRIC, pkmn::e_type::PSYCHIC, pkmn::e_type::ICE,
+            pkmn::e_type::DRAGON, pkmn::e_type::DARK, pkmn::e_type::FAIRY,
+            pkmn::e_type::QUESTION_MARK, pkmn::e_type::SHADOW
+        };
+
+        for(std::array<float, CHART_SIZE>& r_row: _modifiers)
+        {
+            r_row.fill(-1.0f);
+        }
+
+        for(pkmn::e_type attacking_type: ALL_TYPES)
+        {
+            for(pkmn::e_type defending_type: ALL_TYPES)
+            {
+                float& r_modifier = _modifiers[type_to_index(attacking_type)]
+                                              [type_to_index(defending_type)];
+                int damage_factor = 0;
+
+                if(!is_type_in_generation(attacking_type, generation) ||
+                   !is_type_in_generation(defending_type, generation))
+                {
+                    // Left invalid
+                }
+                // Hardcode cases specific enough to not be worth putting in the database.
+                //
+                // Before Generation VI, Ghost and Dark did 0.5x damage against Steel.
+                else if((generation <= 5) &&
+                        (((attacking_type == pkmn::e_type::DARK) || (attacking_type == pkmn::e_type::GHOST)) &&
+                          (defending_type == pkmn::e_type::STEEL)))
+                {
+                    r_modifier = 0.5f;
+                }
+                else if(pkmn::database::lookup_type_efficacy(
+                            generation,
+                            static_cast<int>(attacking_type),
+                            static_cast<int>(defending_type),
+                            &damage_factor
+                       ))
+                {
+                    r_modifier = float(damage_factor) / 100.0f;
+                }
+            }
+        }
+    }
+
+    const type_chart& get_type_chart(
+        int generation
+    )
+    {
+        static const std::array<type_chart, 6> TYPE_CHARTS =
+        {{
+            type_chart(1), type_chart(2), type_chart(3),
+            type_chart(4), type_chart(5), type_chart(6)
+        }};
+
+        pkmn::enforce_bounds(
+            "Generation",
+            generation,
+            1,
+            6
+        );
+
+        return TYPE_CHARTS[generation-1];
+    }
+
     float type_damage_modifier(
         int generation,
         pkmn::e_type attacking_type,
@@ -68,31 +175,27 @@ namespace pkmn { namespace calculations {
             }
         }
 
-        float damage_modifier = 0.0f;
-        const char* query = "";
+        float damage_modifier = get_type_chart(generation).get_modifier(
+                                    attacking_type,
+                                    defending_type
+                                );
 
-        if(generation == 1)
-        {
-            query = "SELECT damage_factor FROM gen1_type_efficacy WHERE "
-                    "damage_type_id=? AND target_type_id=?";
-        }
-        else
+        // Fall back to the database so errors are reported the same way.
+        if(damage_modifier < 0.0f)
         {
-            query = "SELECT damage_factor FROM type_efficacy WHERE "
-                    "damage_type_id=? AND target_type_id=?";
-        }
+            const char* query = "";
 
-        // Hardcode cases specific enough to not be worth putting in the database.
+            if(generation == 1)
+            {
+                query = "SELECT damage_factor FROM gen1_type_efficacy WHERE "
+                        "damage_type_id=? AND target_type_id=?";
+            }
+            else
+            {
+                query = "SELECT damage_factor FROM type_efficacy WHERE "
+                        "damage_type_id=? AND target_type_id=?";
+            }
 
-        // Before Generation VI, Ghost and Dark did 0.5x damage against Steel.
-        if((generation <= 5) &&
-           (((attacking_type == pkmn::e_type::DARK) || (attacking_type == pkmn::e_type::GHOST)) &&
-             (defending_type == pkmn::e_type::STEEL)))
-        {
-            damage_modifier = 0.5f;
-        }
-        else
-        {
             std::string error_message = str(boost::format("Invalid type(s): %s, %s")
                                             % pkmn::type_to_string(attacking_type).c_str()
                                             % pkmn::type_to_string(defending_type).c_str());
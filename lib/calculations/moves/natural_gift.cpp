@@ -34,18 +34,16 @@ namespace pkmn { namespace calculations {
         static const std::string gen_6_query =
             "SELECT type_id,gen_6_power FROM natural_gift_stats WHERE item_id=?";
 
-        const std::string query = (generation <= 5) ? gen_4_5_query : gen_6_query;
+        // Cached statements are keyed by address, so don't copy the query.
+        const std::string& query = (generation <= 5) ? gen_4_5_query : gen_6_query;
 
-        SQLite::Statement stmt(
-            pkmn::database::get_connection(),
-            query
-        );
-        stmt.bind(1, static_cast<int>(item));
+        pkmn::database::cached_statement stmt(query);
+        stmt->bind(1, static_cast<int>(item));
 
-        if(stmt.executeStep())
+        if(stmt->executeStep())
         {
-            ret.type = static_cast<pkmn::e_type>(int(stmt.getColumn(0)));
-            ret.base_power = stmt.getColumn(1);
+            ret.type = static_cast<pkmn::e_type>(int(stmt->getColumn(0)));
+            ret.base_power = stmt->getColumn(1);
         }
         else
         {
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_CALCULATIONS_MOVES_TYPE_CHART_HPP
+#define PKMN_CALCULATIONS_MOVES_TYPE_CHART_HPP
+
+#include <pkmn/enums/type.hpp>
+
+#include <boost/config.hpp>
+
+#include <array>
+
+namespace pkmn { namespace calculations {
+
+    /*
+     * A generation's whole type chart, so that checking a matchup is a
+     * single array access instead of a database query. Each generation's
+     * chart is built the first time it's used.
+     */
+    class type_chart
+    {
+        public:
+            explicit type_chart(
+                int generation
+            );
+
+            // Returns a negative value if either type isn't in this
+            // generation or the database has no value for the matchup.
+            inline float get_modifier(
+                pkmn::e_type attacking_type,
+                pkmn::e_type defending_type
+            ) const
+            {
+                int attacking_index = type_to_index(attacking_type);
+                int defending_index = type_to_index(defending_type);
+
+                return ((attacking_index >= 0) && (defending_index >= 0))
+                           ? _modifiers[attacking_index][defending_index]
+                           : -1.0f;
+            }
+
+        private:
+            BOOST_STATIC_CONSTEXPR int NUM_TYPES = 18;
+            BOOST_STATIC_CONSTEXPR int CHART_SIZE = NUM_TYPES + 3;
+
+            std::array<std::array<float, CHART_SIZE>, CHART_SIZE> _modifiers;
+
+            static inline int type_to_index(
+                pkmn::e_type type
+            )
+            {
+                int ret = -1;
+
+                if((type > pkmn::e_type::NONE) && (type <= pkmn::e_type::FAIRY))
+                {
+                    ret = static_cast<int>(type);
+                }
+                else if(type == pkmn::e_type::QUESTION_MARK)
+                {
+                    ret = NUM_TYPES + 1;
+                }
+                else if(type == pkmn::e_type::SHADOW)
+                {
+                    ret = NUM_TYPES + 2;
+                }
+
+                return ret;
+            }
+    };
+
+    // Throws std::out_of_range if the generation is not in the range [1-6].
+    const type_chart& get_type_chart(
+        int generation
+    );
+
+}}
+
+#endif /* PKMN_CALCULATIONS_MOVES_TYPE_CHART_HPP */
@@ -24,7 +24,9 @@
 #include <pkmn/database/pokemon_entry.hpp>
 #include <pkmn/enums/gender.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
+#include <boost/config.hpp>
 
 #include <algorithm>
 #include <stdexcept>
@@ -58,7 +60,26 @@ namespace pkmn { namespace calculations {
         return ret;
     }
 
-    uint32_t generate_personality(
+    BOOST_STATIC_CONSTEXPR uint32_t NUM_NATURES = 25;
+
+    // A personality's high half is worth 65536 = 11 (mod 25), and
+    // 11 * 16 = 1 (mod 25), so this solves for the high half's residue.
+    BOOST_STATIC_CONSTEXPR uint32_t HIGH_HALF_INVERSE_MOD_NATURES = 16;
+
+    // Everything a personality needs to match, validated and looked up once
+    // per set of inputs.
+    struct personality_constraints
+    {
+        uint32_t trainer_id_xor;
+        bool shiny;
+        uint32_t nature_index;
+        uint32_t ability_modulo;
+
+        uint32_t min_gender_byte;
+        uint32_t max_gender_byte;
+    };
+
+    static personality_constraints get_personality_constraints(
         pkmn::e_species species,
         uint32_t trainer_id,
         bool shiny,
@@ -82,21 +103,23 @@ namespace pkmn { namespace calculations {
             throw std::invalid_argument("Nature cannot be None.");
         }
 
-        uint32_t ret = 0;
-
         pkmn::database::pokemon_entry entry(species, pkmn::e_game::OMEGA_RUBY, "");
         pkmn::ability_pair_t abilities = entry.get_abilities();
         pkmn::e_ability hidden_ability = entry.get_hidden_ability();
         float chance_male = entry.get_chance_male();
         float chance_female = entry.get_chance_female();
 
+        personality_constraints ret;
+        ret.trainer_id_xor = (trainer_id >> 16) ^ (trainer_id & 0xFFFF);
+        ret.shiny = shiny;
+
         // Validate ability input.
-        uint32_t ability_modulo = 0; // If first or hidden ability, keep this
+        ret.ability_modulo = 0; // If first or hidden ability, keep this
         if(ability == abilities.second)
         {
             if(ability != pkmn::e_ability::NONE)
             {
-                ability_modulo = 1;
+                ret.ability_modulo = 1;
             }
             else
             {
@@ -136,38 +159,174 @@ namespace pkmn { namespace calculations {
         }
 
         // TODO: validate
-        uint32_t nature_index = static_cast<uint32_t>(nature) - 1;
-        static const size_t NUM_NATURES = 25;
+        ret.nature_index = static_cast<uint32_t>(nature) - 1;
 
-        // Start trying to find a valid value.
+        // The gender is determined by the personality's lowest byte.
         uint32_t gender_threshold = get_gender_threshold(chance_male);
+        if(gender == pkmn::e_gender::MALE)
+        {
+            ret.min_gender_byte = gender_threshold;
+            ret.max_gender_byte = 0xFF;
+        }
+        else if(gender == pkmn::e_gender::FEMALE)
+        {
+            ret.min_gender_byte = 0;
+            ret.max_gender_byte = gender_threshold - 1;
+        }
+        else
+        {
+            ret.min_gender_byte = 0;
+            ret.max_gender_byte = 0xFF;
+        }
+
+        return ret;
+    }
+
+    // The ability is determined by the personality's parity, so the lowest
+    // byte sets both. Every gender range is wide enough to contain both
+    // parities.
+    static uint32_t generate_lowest_byte(
+        const personality_constraints& constraints,
+        pkmn::rng<uint32_t>& r_rng
+    )
+    {
+        uint32_t ret = r_rng.rand(
+                           constraints.min_gender_byte,
+                           constraints.max_gender_byte
+                       );
+        if((ret % 2) != constraints.ability_modulo)
+        {
+            ret = (ret > constraints.min_gender_byte) ? (ret - 1) : (ret + 1);
+        }
+
+        return ret;
+    }
+
+    /*
+     * A personality is shiny when (high half ^ low half ^ trainer ID halves)
+     * is under 8. Once the low half is chosen, that leaves eight possible high
+     * halves. Together with the 256 choices for the low half's upper byte,
+     * these reach every nature for any trainer ID (checked exhaustively), so
+     * the search below always succeeds.
+     */
+    static uint32_t construct_shiny_personality(
+        const personality_constraints& constraints,
+        pkmn::rng<uint32_t>& r_rng
+    )
+    {
+        BOOST_STATIC_CONSTEXPR uint32_t NUM_CANDIDATES = 256 * 8;
+
+        uint32_t lowest_byte = generate_lowest_byte(constraints, r_rng);
+        uint32_t first_upper_byte = r_rng.rand(0, 0xFF);
+        uint32_t first_shiny_xor = r_rng.rand(0, 7);
+
+        uint32_t ret = 0;
         bool found = false;
-        pkmn::rng<uint32_t> rng;
-        do
+        for(uint32_t candidate = 0; (candidate < NUM_CANDIDATES) && !found; ++candidate)
         {
-            ret = rng.rand();
+            uint32_t upper_byte = (first_upper_byte + (candidate / 8)) & 0xFF;
+            uint32_t shiny_xor = (first_shiny_xor + candidate) & 7;
 
-            // Set the gender if applicable.
-            if(gender == pkmn::e_gender::MALE)
-            {
-                ret &= ~0xFF;
-                ret |= (rng.rand() % (0xFF - gender_threshold) + gender_threshold);
-            }
-            else if(gender == pkmn::e_gender::FEMALE)
-            {
-                ret &= ~0xFF;
-                ret |= (rng.rand() % gender_threshold);
-            }
+            uint32_t low_half = (upper_byte << 8) | lowest_byte;
+            uint32_t high_half = low_half ^ constraints.trainer_id_xor ^ shiny_xor;
 
-            if((modern_shiny(ret, trainer_id) == shiny) &&
-               ((ret % NUM_NATURES) == nature_index) &&
-               ((ret % 2) == ability_modulo)
-            )
-            {
-                found = true;
-            }
+            ret = (high_half << 16) | low_half;
+            found = ((ret % NUM_NATURES) == constraints.nature_index);
+        }
+        BOOST_ASSERT(found);
+
+        return ret;
+    }
+
+    /*
+     * With the low half chosen, the nature fixes the high half's residue mod
+     * 25, so pick a random high half with that residue. If that happens to be
+     * shiny, moving it by 25 leaves the eight shiny values.
+     */
+    static uint32_t construct_non_shiny_personality(
+        const personality_constraints& constraints,
+        pkmn::rng<uint32_t>& r_rng
+    )
+    {
+        uint32_t low_half = (r_rng.rand(0, 0xFF) << 8) |
+                            generate_lowest_byte(constraints, r_rng);
+
+        uint32_t high_half_residue = ((constraints.nature_index + NUM_NATURES - (low_half % NUM_NATURES))
+                                     * HIGH_HALF_INVERSE_MOD_NATURES) % NUM_NATURES;
+        uint32_t max_multiple = (0xFFFF - high_half_residue) / NUM_NATURES;
+        uint32_t multiple = r_rng.rand(0, max_multiple);
+
+        uint32_t high_half = (multiple * NUM_NATURES) + high_half_residue;
+        if(((high_half ^ low_half ^ constraints.trainer_id_xor) & 0xFFF8) == 0)
+        {
+            high_half = (multiple < max_multiple) ? (high_half + NUM_NATURES)
+                                                  : (high_half - NUM_NATURES);
+        }
+
+        return (high_half << 16) | low_half;
+    }
+
+    static inline uint32_t construct_personality(
+        const personality_constraints& constraints,
+        pkmn::rng<uint32_t>& r_rng
+    )
+    {
+        return constraints.shiny ? construct_shiny_personality(constraints, r_rng)
+                                 : construct_non_shiny_personality(constraints, r_rng);
+    }
+
+    uint32_t generate_personality(
+        pkmn::e_species species,
+        uint32_t trainer_id,
+        bool shiny,
+        pkmn::e_ability ability,
+        pkmn::e_gender gender,
+        pkmn::e_nature nature
+    )
+    {
+        personality_constraints constraints = get_personality_constraints(
+                                                  species,
+                                                  trainer_id,
+                                                  shiny,
+                                                  ability,
+                                                  gender,
+                                                  nature
+                                              );
+
+        pkmn::rng<uint32_t> rng;
+
+        return construct_personality(constraints, rng);
+    }
+
+    std::vector<uint32_t> generate_personalities(
+        pkmn::e_species species,
+        uint32_t trainer_id,
+        bool shiny,
+        pkmn::e_ability ability,
+        pkmn::e_gender gender,
+        pkmn::e_nature nature,
+        size_t num_personalities
+    )
+    {
+        personality_constraints constraints = get_personality_constraints(
+                                                  species,
+                                                  trainer_id,
+                                                  shiny,
+                                                  ability,
+                                                  gender,
+                                                  nature
+                                              );
+
+        std::vector<uint32_t> ret;
+        ret.reserve(num_personalities);
+
+        pkmn::rng<uint32_t> rng;
+        for(size_t personality_index = 0;
+            personality_index < num_personalities;
+            ++personality_index)
+        {
+            ret.emplace_back(construct_personality(constraints, rng));
         }
-        while(!found);
 
         return ret;
     }
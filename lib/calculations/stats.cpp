@@ -14,6 +14,7 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <vector>
 
 namespace pkmn { namespace calculations {
 
@@ -62,6 +63,70 @@ namespace pkmn { namespace calculations {
         return ret;
     }
 
+    static void enforce_batch_sizes(
+        size_t num_pokemon,
+        size_t num_values
+    )
+    {
+        if(num_values != num_pokemon)
+        {
+            throw std::invalid_argument("All batch stat inputs must be the same size.");
+        }
+    }
+
+    std::vector<int> get_gb_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const std::vector<int>& base_stats,
+        const std::vector<int>& EVs,
+        const std::vector<int>& IVs
+    )
+    {
+        const size_t num_pokemon = levels.size();
+
+        // Input validation
+        pkmn::enforce_value_in_vector("Stat", stat, pkmn::GEN2_STATS);
+        enforce_batch_sizes(num_pokemon, base_stats.size());
+        enforce_batch_sizes(num_pokemon, EVs.size());
+        enforce_batch_sizes(num_pokemon, IVs.size());
+
+        // The square root is taken while validating, since it can't be
+        // vectorized without relaxing floating-point error handling.
+        std::vector<int> EV_bonuses(num_pokemon);
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            pkmn::enforce_EV_bounds(stat, EVs[pokemon_index], false);
+            pkmn::enforce_IV_bounds(stat, IVs[pokemon_index], false);
+
+            EV_bonuses[pokemon_index] = int(std::sqrt(EVs[pokemon_index])) / 4;
+        }
+
+        // Everything that depends on the stat is hoisted out of the loop so
+        // the loop has no branches and can be vectorized.
+        const int level_multiplier = (stat == pkmn::e_stat::HP) ? 1 : 0;
+        const int stat_offset = (stat == pkmn::e_stat::HP) ? 10 : 5;
+
+        std::vector<int> ret(num_pokemon);
+
+        const int* p_levels = levels.data();
+        const int* p_base_stats = base_stats.data();
+        const int* p_EV_bonuses = EV_bonuses.data();
+        const int* p_IVs = IVs.data();
+        int* p_ret = ret.data();
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            const int common = ((((p_base_stats[pokemon_index] + p_IVs[pokemon_index]) * 2) + p_EV_bonuses[pokemon_index])
+                               * p_levels[pokemon_index]) / 100;
+
+            p_ret[pokemon_index] = common
+                                 + (p_levels[pokemon_index] * level_multiplier)
+                                 + stat_offset;
+        }
+
+        return ret;
+    }
+
     inline int modern_stat_common(
         int level,
         int base_stat,
@@ -115,4 +180,71 @@ namespace pkmn { namespace calculations {
         return ret;
     }
 
+    std::vector<int> get_modern_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const std::vector<float>& nature_modifiers,
+        const std::vector<int>& base_stats,
+        const std::vector<int>& EVs,
+        const std::vector<int>& IVs
+    )
+    {
+        const size_t num_pokemon = levels.size();
+
+        // Input validation
+        pkmn::enforce_value_in_vector("Stat", stat, pkmn::MODERN_STATS);
+        enforce_batch_sizes(num_pokemon, nature_modifiers.size());
+        enforce_batch_sizes(num_pokemon, base_stats.size());
+        enforce_batch_sizes(num_pokemon, EVs.size());
+        enforce_batch_sizes(num_pokemon, IVs.size());
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            const float nature_modifier = nature_modifiers[pokemon_index];
+            if(pkmn::fp_compare_not_equal(nature_modifier, 0.9f) and
+               pkmn::fp_compare_not_equal(nature_modifier, 1.0f) and
+               pkmn::fp_compare_not_equal(nature_modifier, 1.1f))
+            {
+                throw std::domain_error("nature_modifier: valid values 0.9, 1.0, 1.1");
+            }
+
+            pkmn::enforce_EV_bounds(stat, EVs[pokemon_index], true);
+            pkmn::enforce_IV_bounds(stat, IVs[pokemon_index], true);
+        }
+
+        std::vector<int> ret(num_pokemon);
+
+        const int* p_levels = levels.data();
+        const float* p_nature_modifiers = nature_modifiers.data();
+        const int* p_base_stats = base_stats.data();
+        const int* p_EVs = EVs.data();
+        const int* p_IVs = IVs.data();
+        int* p_ret = ret.data();
+
+        // The stat is checked once outside of the loops so that each loop
+        // has no branches and can be vectorized.
+        if(stat == pkmn::e_stat::HP)
+        {
+            for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+            {
+                const int common = (((2 * p_base_stats[pokemon_index]) + p_IVs[pokemon_index] + (p_EVs[pokemon_index] / 4))
+                                   * p_levels[pokemon_index]) / 100;
+
+                p_ret[pokemon_index] = common + p_levels[pokemon_index] + 10;
+            }
+        }
+        else
+        {
+            for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+            {
+                const int common = (((2 * p_base_stats[pokemon_index]) + p_IVs[pokemon_index] + (p_EVs[pokemon_index] / 4))
+                                   * p_levels[pokemon_index]) / 100;
+
+                p_ret[pokemon_index] = int((common + 5) * p_nature_modifiers[pokemon_index]);
+            }
+        }
+
+        return ret;
+    }
+
 }}
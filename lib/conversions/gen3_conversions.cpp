@@ -435,4 +435,31 @@ namespace pkmn { namespace conversions {
         to->party_data.spdef        = pksav_littleendian16(from->partyData.stats[int(pkmgc::e_stat::SPECIAL_DEFENSE)]);
     }
 
+    bool gcn_held_item_to_gba(
+        const LibPkmGC::GC::Pokemon* from,
+        int game_id,
+        struct pksav_gba_pc_pokemon* to
+    )
+    {
+        // The Gamecube games use the GBA item indices, with their own
+        // items after them. Like set_held_item(), also reject unused
+        // indices and items the given game doesn't have.
+        if(from->heldItem > MAX_GBA_ITEM_INDEX)
+        {
+            return false;
+        }
+        if((from->heldItem != LibPkmGC::NoItem) &&
+           !pkmn::database::item_index_valid(
+                int(from->heldItem),
+                pkmn::database::game_id_to_version_group(game_id)
+            ))
+        {
+            return false;
+        }
+
+        to->blocks.growth.held_item = pksav_littleendian16(uint16_t(from->heldItem));
+
+        return true;
+    }
+
 }}
@@ -34,6 +34,18 @@ namespace pkmn { namespace conversions {
         struct pksav_gba_party_pokemon* to
     );
 
+    /*
+     * The functions above leave the held item empty, as to_game() sets it
+     * through the database. Bulk transfers copy it directly with this
+     * instead, which returns false if the item doesn't exist in the given
+     * GBA game.
+     */
+    bool gcn_held_item_to_gba(
+        const LibPkmGC::GC::Pokemon* from,
+        int game_id,
+        struct pksav_gba_pc_pokemon* to
+    );
+
 }}
 
 #endif /* INCLUDED_PKMN_CONVERSIONS_GEN3_CONVERSIONS_HPP */
@@ -6,8 +6,12 @@
  */
 
 #include "database_common.hpp"
+#include "env.hpp"
+#include "lookup_tables.hpp"
+#include "query_instrumentation.hpp"
 #include "../utils/misc.hpp"
 
+#include <pkmn/database/in_memory.hpp>
 #include <pkmn/utils/paths.hpp>
 
 #include <boost/assert.hpp>
@@ -15,11 +19,15 @@
 #include <boost/config.hpp>
 #include <boost/algorithm/string/compare.hpp>
 #include <boost/thread/lock_guard.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/once.hpp>
+#include <boost/thread/tss.hpp>
 
 #include <algorithm>
 #include <atomic>
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 #define PKMN_COMPAT_NUM 20
 
@@ -27,33 +35,404 @@
 
 namespace pkmn { namespace database {
 
-    static std::unique_ptr<SQLite::Database> _database_uptr;
+    struct statement_cache_entry
+    {
+        std::unique_ptr<SQLite::Statement> statement_uptr;
+        bool is_in_use;
+    };
+
+    // Members are destroyed in reverse order, so every cached statement is
+    // finalized before the connection is closed.
+    struct database_connection
+    {
+        std::unique_ptr<SQLite::Database> database_uptr;
+        unsigned int generation;
+        std::unordered_map<const char*, statement_cache_entry> statement_cache;
+    };
+
+    /*
+     * Each thread gets its own read-only connection (and statement cache),
+     * opened without SQLite's per-connection mutex, so lookups on different
+     * threads never wait on each other. Connections are closed when their
+     * thread exits.
+     */
+    static boost::thread_specific_ptr<database_connection> _thread_connection;
+
+    static boost::once_flag _initialization_flag = BOOST_ONCE_INIT;
+    static std::string _database_path;
+
+    /*
+     * When the database is in memory, this connection owns the single copy.
+     * It's opened in SQLite's shared-cache mode, so every thread's connection
+     * reads from the same pages instead of making its own copy, and the copy
+     * lives as long as this connection does.
+     */
+    static std::unique_ptr<SQLite::Database> _memory_database_uptr;
+    static boost::mutex _memory_database_mutex;
+    static std::atomic_bool _is_in_memory(false);
+
+    // Incremented whenever the database every thread should be using
+    // changes, so each thread knows to reopen its connection.
+    static std::atomic_uint _connection_generation(0);
+
+    BOOST_STATIC_CONSTEXPR int THREAD_CONNECTION_FLAGS =
+        (SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX);
+
+    static BOOST_CONSTEXPR const char* MEMORY_DATABASE_URI =
+        "file:pkmn_db?mode=memory&cache=shared";
+
+    // Only a handful of queries are built at runtime, but don't let their
+    // addresses grow the cache forever.
+    BOOST_STATIC_CONSTEXPR size_t MAX_CACHED_STATEMENTS = 512;
+
+    static bool _is_in_memory_env_var_set()
+    {
+        std::string env_value = pkmn_getenv("PKMN_DATABASE_IN_MEMORY");
+
+        return !env_value.empty() && (env_value != "0");
+    }
+
+    static bool _is_instrumentation_env_var_set()
+    {
+        std::string env_value = pkmn_getenv("PKMN_DATABASE_INSTRUMENTATION");
+
+        return !env_value.empty() && (env_value != "0");
+    }
+
+    // Only meant for measuring what the statement cache saves, such as in
+    // LibPKMN's benchmarks, so it's read once.
+    static bool _is_statement_cache_disabled()
+    {
+        static const bool IS_DISABLED = []()
+        {
+            std::string env_value = pkmn_getenv("PKMN_DATABASE_NO_STATEMENT_CACHE");
+
+            return !env_value.empty() && (env_value != "0");
+        }();
+
+        return IS_DISABLED;
+    }
+
+    // Use SQLite's online backup API to copy the whole database in one step.
+    static std::unique_ptr<SQLite::Database> _copy_database_into_memory(
+        const SQLite::Database& source_database
+    )
+    {
+        std::unique_ptr<SQLite::Database> memory_database_uptr(
+            new SQLite::Database(
+                    MEMORY_DATABASE_URI,
+                    (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE |
+                     SQLITE_OPEN_URI | SQLITE_OPEN_FULLMUTEX)
+                )
+        );
+
+        sqlite3_backup* p_backup = sqlite3_backup_init(
+                                       memory_database_uptr->getHandle(),
+                                       "main",
+                                       source_database.getHandle(),
+                                       "main"
+                                   );
+        if(!p_backup)
+        {
+            std::string error_message = "Failed to load the LibPKMN database into memory: ";
+            error_message += memory_database_uptr->errmsg();
+
+            throw std::runtime_error(error_message);
+        }
+
+        (void)sqlite3_backup_step(p_backup, -1);
+        if(sqlite3_backup_finish(p_backup) != SQLITE_OK)
+        {
+            std::string error_message = "Failed to load the LibPKMN database into memory: ";
+            error_message += memory_database_uptr->errmsg();
+
+            throw std::runtime_error(error_message);
+        }
+
+        // The copy had to be writable to be filled, but nothing should
+        // change it from here on.
+        (void)memory_database_uptr->exec("PRAGMA query_only=1");
+
+        return memory_database_uptr;
+    }
+
+    static void _load_memory_database(
+        const SQLite::Database& source_database
+    )
+    {
+        boost::lock_guard<boost::mutex> lock(_memory_database_mutex);
+
+        if(!_is_in_memory)
+        {
+            _memory_database_uptr = _copy_database_into_memory(source_database);
+            _is_in_memory = true;
+            ++_connection_generation;
+        }
+    }
+
+    static void _initialize_connection_once()
+    {
+        std::string database_path = pkmn::get_database_path();
+        SQLite::Database database(database_path, THREAD_CONNECTION_FLAGS);
+
+        // Make sure our Veekun commit matches the database's.
+        int compat_num = database.execAndGet("SELECT compat_num FROM compat_num");
+        if(compat_num != PKMN_COMPAT_NUM)
+        {
+            throw std::runtime_error("This database is incompatible with this version of LibPKMN.");
+        }
 
+        _database_path = database_path;
+
+        if(_is_instrumentation_env_var_set())
+        {
+            set_query_instrumentation_enabled(true);
+        }
+        if(_is_in_memory_env_var_set())
+        {
+            _load_memory_database(database);
+        }
+    }
+
+    // If this throws, the next call tries again.
     void initialize_connection()
     {
-        static std::atomic_bool atomic_is_db_initialized(false);
+        boost::call_once(_initialization_flag, &_initialize_connection_once);
+    }
+
+    static std::unique_ptr<SQLite::Database> _open_thread_database()
+    {
+        if(_is_in_memory)
+        {
+            // The main in-memory connection is set before _is_in_memory and
+            // is never closed, so this doesn't need the lock.
+            std::unique_ptr<SQLite::Database> database_uptr(
+                new SQLite::Database(
+                        MEMORY_DATABASE_URI,
+                        (THREAD_CONNECTION_FLAGS | SQLITE_OPEN_URI)
+                    )
+            );
+
+            // Nothing ever writes to the shared copy, so skip shared-cache
+            // table locks.
+            (void)database_uptr->exec("PRAGMA read_uncommitted=1");
 
-        if(!atomic_is_db_initialized)
+            return database_uptr;
+        }
+        else
         {
-            BOOST_ASSERT(!_database_uptr);
-            std::string database_path = pkmn::get_database_path();
-            _database_uptr.reset(new SQLite::Database(database_path));
+            return std::unique_ptr<SQLite::Database>(
+                       new SQLite::Database(_database_path, THREAD_CONNECTION_FLAGS)
+                   );
+        }
+    }
 
-            // Make sure our Veekun commit matches the database's.
-            int compat_num = _database_uptr->execAndGet("SELECT compat_num FROM compat_num");
-            if(compat_num != PKMN_COMPAT_NUM)
+    static database_connection& _get_thread_connection()
+    {
+        initialize_connection();
+
+        database_connection* p_connection = _thread_connection.get();
+        if(!p_connection)
+        {
+            p_connection = new database_connection;
+            p_connection->generation = _connection_generation;
+            p_connection->database_uptr = _open_thread_database();
+
+            _thread_connection.reset(p_connection);
+        }
+        else if(p_connection->generation != _connection_generation)
+        {
+            // Statements belong to the connection that prepared them, so
+            // only switch over once none are in use further up the stack.
+            const bool is_any_statement_in_use = std::any_of(
+                p_connection->statement_cache.begin(),
+                p_connection->statement_cache.end(),
+                [](const std::pair<const char* const, statement_cache_entry>& cache_pair)
+                {
+                    return cache_pair.second.is_in_use;
+                }
+            );
+            if(!is_any_statement_in_use)
             {
-                throw std::runtime_error("This database is incompatible with this version of LibPKMN.");
+                p_connection->statement_cache.clear();
+                p_connection->generation = _connection_generation;
+                p_connection->database_uptr = _open_thread_database();
             }
-
-            atomic_is_db_initialized = true;
         }
+
+        return *p_connection;
     }
 
     SQLite::Database* get_connection()
+    {
+        return _get_thread_connection().database_uptr.get();
+    }
+
+    /*
+     * Prepared statement cache
+     */
+
+    static void _prune_statement_cache(
+        database_connection& r_connection
+    )
+    {
+        auto& r_statement_cache = r_connection.statement_cache;
+        for(auto cache_iter = r_statement_cache.begin();
+            cache_iter != r_statement_cache.end();)
+        {
+            if(cache_iter->second.is_in_use)
+            {
+                ++cache_iter;
+            }
+            else
+            {
+                cache_iter = r_statement_cache.erase(cache_iter);
+            }
+        }
+    }
+
+    cached_statement::cached_statement(
+        const char* query
+    ): _p_statement(nullptr),
+       _uncached_statement_uptr(),
+       _p_is_in_use(nullptr),
+       _instrumented_query(nullptr),
+       _start_time()
+    {
+        BOOST_ASSERT(query);
+
+        database_connection& r_connection = _get_thread_connection();
+
+        // Check after connecting, as the first connection may enable
+        // instrumentation.
+        if(is_query_instrumentation_enabled())
+        {
+            _instrumented_query = query;
+            _start_time = std::chrono::steady_clock::now();
+        }
+
+        SQLite::Database* p_connection = r_connection.database_uptr.get();
+        if(_is_statement_cache_disabled())
+        {
+            _uncached_statement_uptr.reset(
+                new SQLite::Statement(p_connection, query)
+            );
+            _p_statement = _uncached_statement_uptr.get();
+
+            return;
+        }
+
+        auto& r_statement_cache = r_connection.statement_cache;
+
+        auto cache_iter = r_statement_cache.find(query);
+        if(cache_iter == r_statement_cache.end())
+        {
+            if(r_statement_cache.size() >= MAX_CACHED_STATEMENTS)
+            {
+                _prune_statement_cache(r_connection);
+            }
+
+            cache_iter = r_statement_cache.emplace(
+                             query,
+                             statement_cache_entry{
+                                 std::unique_ptr<SQLite::Statement>(
+                                     new SQLite::Statement(p_connection, query)
+                                 ),
+                                 false
+                             }
+                         ).first;
+        }
+
+        statement_cache_entry& r_entry = cache_iter->second;
+        if(r_entry.is_in_use)
+        {
+            _uncached_statement_uptr.reset(
+                new SQLite::Statement(p_connection, query)
+            );
+            _p_statement = _uncached_statement_uptr.get();
+        }
+        else
+        {
+            // Queries built at runtime can reuse an address with different
+            // text, so make sure this is actually the same query.
+            if(r_entry.statement_uptr->getQuery() != query)
+            {
+                r_entry.statement_uptr.reset(
+                    new SQLite::Statement(p_connection, query)
+                );
+            }
+
+            r_entry.is_in_use = true;
+            _p_statement = r_entry.statement_uptr.get();
+            _p_is_in_use = &r_entry.is_in_use;
+        }
+    }
+
+    cached_statement::~cached_statement()
+    {
+        if(_p_is_in_use)
+        {
+            // sqlite3_reset() always resets the statement, even when it
+            // reports an error from the last step.
+            try
+            {
+                _p_statement->reset();
+                _p_statement->clearBindings();
+            }
+            catch(...)
+            {
+            }
+
+            *_p_is_in_use = false;
+        }
+
+        if(_instrumented_query)
+        {
+            const uint64_t duration_ns = uint64_t(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - _start_time
+                ).count()
+            );
+
+            try
+            {
+                record_query(_instrumented_query, duration_ns);
+            }
+            catch(...)
+            {
+            }
+        }
+    }
+
+    // Only this thread's cache is touched. Other threads' caches are
+    // cleared when their connections close.
+    void clear_statement_cache()
+    {
+        database_connection* p_connection = _thread_connection.get();
+        if(p_connection)
+        {
+            _prune_statement_cache(*p_connection);
+        }
+    }
+
+    /*
+     * In-memory database
+     */
+
+    void load_into_memory()
     {
         initialize_connection();
-        return _database_uptr.get();
+
+        if(!_is_in_memory)
+        {
+            SQLite::Database database(_database_path, THREAD_CONNECTION_FLAGS);
+            _load_memory_database(database);
+        }
+    }
+
+    bool is_loaded_into_memory()
+    {
+        return _is_in_memory;
     }
 
     /*
@@ -64,6 +443,12 @@ namespace pkmn { namespace database {
         int game_id
     )
     {
+        const game_row* p_game_row = lookup_game(game_id);
+        if(p_game_row)
+        {
+            return p_game_row->generation;
+        }
+
         static BOOST_CONSTEXPR const char* query =
             "SELECT generation_id FROM version_groups WHERE id="
             "(SELECT version_group_id FROM versions WHERE id=?)";
@@ -75,6 +460,12 @@ namespace pkmn { namespace database {
         int game_id
     )
     {
+        const game_row* p_game_row = lookup_game(game_id);
+        if(p_game_row)
+        {
+            return p_game_row->version_group_id;
+        }
+
         static BOOST_CONSTEXPR const char* query =
             "SELECT version_group_id FROM versions WHERE id=?";
 
@@ -236,25 +627,25 @@ namespace pkmn { namespace database {
 
         const char* gcn_query = (all_pockets ? gcn_all_pockets_query
                                              : gcn_single_pocket_query);
-        SQLite::Statement gcn_stmt(get_connection(), gcn_query);
-        gcn_stmt.bind(1, (colosseum ? 1 : 0));
+        cached_statement gcn_stmt(gcn_query);
+        gcn_stmt->bind(1, (colosseum ? 1 : 0));
         if(not all_pockets)
         {
-            gcn_stmt.bind(2, version_group_id);
-            gcn_stmt.bind(3, list_id);
+            gcn_stmt->bind(2, version_group_id);
+            gcn_stmt->bind(3, list_id);
         }
 
-        while(gcn_stmt.executeStep())
+        while(gcn_stmt->executeStep())
         {
             if(should_populate_enum_list)
             {
                 r_items.emplace_back(
-                    static_cast<pkmn::e_item>(int(gcn_stmt.getColumn(0)))
+                    static_cast<pkmn::e_item>(int(gcn_stmt->getColumn(0)))
                 );
             }
             if(should_populate_string_list)
             {
-                r_item_names.emplace_back(gcn_stmt.getColumn(1));
+                r_item_names.emplace_back(gcn_stmt->getColumn(1));
             }
         }
     }
@@ -300,22 +691,22 @@ namespace pkmn { namespace database {
         {
             if(!item_range_empty(version_group_id, i))
             {
-                SQLite::Statement stmt(get_connection(), query);
-                stmt.bind(1, generation);
-                stmt.bind(2, version_group_item_index_bounds[version_group_id][i][0]);
-                stmt.bind(3, version_group_item_index_bounds[version_group_id][i][1]);
+                cached_statement stmt(query);
+                stmt->bind(1, generation);
+                stmt->bind(2, version_group_item_index_bounds[version_group_id][i][0]);
+                stmt->bind(3, version_group_item_index_bounds[version_group_id][i][1]);
                 if(!all_pockets)
                 {
-                    stmt.bind(4, version_group_id);
-                    stmt.bind(5, list_id);
+                    stmt->bind(4, version_group_id);
+                    stmt->bind(5, list_id);
                 }
 
-                while(stmt.executeStep())
+                while(stmt->executeStep())
                 {
                     if(should_populate_enum_list)
                     {
                         r_items.emplace_back(
-                            static_cast<pkmn::e_item>(int(stmt.getColumn(0)))
+                            static_cast<pkmn::e_item>(int(stmt->getColumn(0)))
                         );
                     }
                     if(should_populate_string_list)
@@ -334,19 +725,19 @@ namespace pkmn { namespace database {
                                 "item_id=? AND latest_version_group>=? ORDER BY latest_version_group";
                             if(pkmn::database::maybe_query_db_bind2<std::string, int, int>(
                                    old_name_query, old_name,
-                                   int(stmt.getColumn(0)), version_group_id
+                                   int(stmt->getColumn(0)), version_group_id
                                ))
                             {
                                 r_item_names.emplace_back(old_name);
                             }
                             else
                             {
-                                r_item_names.emplace_back(stmt.getColumn(1));
+                                r_item_names.emplace_back(stmt->getColumn(1));
                             }
                         }
                         else
                         {
-                            r_item_names.emplace_back(stmt.getColumn(1));
+                            r_item_names.emplace_back(stmt->getColumn(1));
                         }
                     }
                 }
@@ -17,6 +17,7 @@
 
 #include <boost/config.hpp>
 
+#include <chrono>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -28,8 +29,65 @@ namespace pkmn { namespace database {
     typedef std::shared_ptr<SQLite::Database> sptr;
 
     void initialize_connection();
+
+    // Returns this thread's connection. It must not be used from
+    // other threads.
     SQLite::Database* get_connection();
 
+    /*
+     * Prepared statement cache
+     *
+     * Most of the time spent on a simple lookup goes to SQLite parsing and
+     * planning the query, so each thread's connection keeps every statement
+     * it has prepared, keyed by the address of the query string. A cached_statement
+     * hands out the cached statement and resets it (and clears its bindings)
+     * when it goes out of scope.
+     *
+     * If the statement for a query is already in use further up the call
+     * stack, a one-off statement is prepared instead.
+     *
+     * When query instrumentation is enabled, the time from construction to
+     * destruction is recorded as a single query.
+     */
+    class cached_statement
+    {
+        public:
+            explicit cached_statement(
+                const char* query
+            );
+
+            explicit cached_statement(
+                const std::string& query
+            ): cached_statement(query.c_str())
+            {}
+
+            ~cached_statement();
+
+            inline SQLite::Statement& operator*()
+            {
+                return *_p_statement;
+            }
+
+            inline SQLite::Statement* operator->()
+            {
+                return _p_statement;
+            }
+
+        private:
+            SQLite::Statement* _p_statement;
+            std::unique_ptr<SQLite::Statement> _uncached_statement_uptr;
+            bool* _p_is_in_use;
+
+            // Only set if query instrumentation was enabled on construction.
+            const char* _instrumented_query;
+            std::chrono::steady_clock::time_point _start_time;
+
+            cached_statement(const cached_statement&) = delete;
+            cached_statement& operator=(const cached_statement&) = delete;
+    };
+
+    void clear_statement_cache();
+
     /*
      * Templated query functions
      */
@@ -42,10 +100,10 @@ namespace pkmn { namespace database {
     {
         ret_type ret = ret_type();
 
-        SQLite::Statement stmt(get_connection(), query);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        if(stmt->executeStep())
         {
-            ret = (ret_type)stmt.getColumn(0);
+            ret = (ret_type)stmt->getColumn(0);
         }
         else
         {
@@ -73,11 +131,11 @@ namespace pkmn { namespace database {
     {
         ret_type ret = ret_type();
 
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        if(stmt->executeStep())
         {
-            ret = (ret_type)stmt.getColumn(0);
+            ret = (ret_type)stmt->getColumn(0);
         }
         else
         {
@@ -107,12 +165,12 @@ namespace pkmn { namespace database {
     {
         ret_type ret = ret_type();
 
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        if(stmt->executeStep())
         {
-            ret = (ret_type)stmt.getColumn(0);
+            ret = (ret_type)stmt->getColumn(0);
         }
         else
         {
@@ -144,13 +202,13 @@ namespace pkmn { namespace database {
     {
         ret_type ret = ret_type();
 
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        stmt.bind(3, (bind3_type)bind3);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        stmt->bind(3, (bind3_type)bind3);
+        if(stmt->executeStep())
         {
-            ret = (ret_type)stmt.getColumn(0);
+            ret = (ret_type)stmt->getColumn(0);
         }
         else
         {
@@ -183,10 +241,10 @@ namespace pkmn { namespace database {
     )
     {
         bool ret = false;
-        SQLite::Statement stmt(get_connection(), query);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        if(stmt->executeStep())
         {
-            out = (ret_type)stmt.getColumn(0);
+            out = (ret_type)stmt->getColumn(0);
             ret = true;
         }
 
@@ -201,11 +259,11 @@ namespace pkmn { namespace database {
     )
     {
         bool ret = false;
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        if(stmt->executeStep())
         {
-            out = (ret_type)stmt.getColumn(0);
+            out = (ret_type)stmt->getColumn(0);
             ret = true;
         }
 
@@ -221,12 +279,12 @@ namespace pkmn { namespace database {
     )
     {
         bool ret = false;
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        if(stmt->executeStep())
         {
-            out = (ret_type)stmt.getColumn(0);
+            out = (ret_type)stmt->getColumn(0);
             ret = true;
         }
 
@@ -243,13 +301,13 @@ namespace pkmn { namespace database {
     )
     {
         bool ret = false;
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        stmt.bind(3, (bind3_type)bind3);
-        if(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        stmt->bind(3, (bind3_type)bind3);
+        if(stmt->executeStep())
         {
-            out = (ret_type)stmt.getColumn(0);
+            out = (ret_type)stmt->getColumn(0);
             ret = true;
         }
 
@@ -266,11 +324,11 @@ namespace pkmn { namespace database {
         std::vector<enum_type>& ret_vec
     )
     {
-        SQLite::Statement stmt(get_connection(), query.c_str());
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        while(stmt->executeStep())
         {
             ret_vec.emplace_back(
-                static_cast<enum_type>(int(stmt.getColumn(0)))
+                static_cast<enum_type>(int(stmt->getColumn(0)))
             );
         }
     }
@@ -282,12 +340,12 @@ namespace pkmn { namespace database {
         const bind_type& bind_val1
     )
     {
-        SQLite::Statement stmt(get_connection(), query.c_str());
-        stmt.bind(1, bind_val1);
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, bind_val1);
+        while(stmt->executeStep())
         {
             ret_vec.emplace_back(
-                static_cast<enum_type>(int(stmt.getColumn(0)))
+                static_cast<enum_type>(int(stmt->getColumn(0)))
             );
         }
     }
@@ -302,10 +360,10 @@ namespace pkmn { namespace database {
         std::vector<ret_type> &ret_vec
     )
     {
-        SQLite::Statement stmt(get_connection(), query);
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        while(stmt->executeStep())
         {
-            ret_vec.emplace_back((ret_type)stmt.getColumn(0));
+            ret_vec.emplace_back((ret_type)stmt->getColumn(0));
         }
     }
 
@@ -316,11 +374,11 @@ namespace pkmn { namespace database {
         bind1_type bind1
     )
     {
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        while(stmt->executeStep())
         {
-            ret_vec.emplace_back((ret_type)stmt.getColumn(0));
+            ret_vec.emplace_back((ret_type)stmt->getColumn(0));
         }
     }
 
@@ -332,12 +390,12 @@ namespace pkmn { namespace database {
         bind2_type bind2
     )
     {
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        while(stmt->executeStep())
         {
-            ret_vec.emplace_back((ret_type)stmt.getColumn(0));
+            ret_vec.emplace_back((ret_type)stmt->getColumn(0));
         }
     }
 
@@ -350,13 +408,13 @@ namespace pkmn { namespace database {
         bind1_type bind3
     )
     {
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, (bind1_type)bind1);
-        stmt.bind(2, (bind2_type)bind2);
-        stmt.bind(3, (bind3_type)bind3);
-        while(stmt.executeStep())
+        cached_statement stmt(query);
+        stmt->bind(1, (bind1_type)bind1);
+        stmt->bind(2, (bind2_type)bind2);
+        stmt->bind(3, (bind3_type)bind3);
+        while(stmt->executeStep())
         {
-            ret_vec.emplace_back((ret_type)stmt.getColumn(0));
+            ret_vec.emplace_back((ret_type)stmt->getColumn(0));
         }
     }
 
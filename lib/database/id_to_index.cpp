@@ -17,272 +17,448 @@
 
 namespace pkmn { namespace database {
 
-    int game_id_to_index(
-        int game_id
-    )
+    /*
+     * Each function is implemented as its try_ version, which reports
+     * failure with its return value. The throwing versions only format an
+     * error message once a conversion has already failed.
+     */
+
+    bool try_game_id_to_index(
+        int game_id,
+        int& game_index_out
+    ) noexcept
     {
         if(game_id == 0)
         {
-            return 0;
+            game_index_out = 0;
+            return true;
         }
 
         static BOOST_CONSTEXPR const char* query =
             "SELECT game_index FROM version_game_indices WHERE version_id=?";
 
-        return pkmn::database::query_db_bind1<int, int>(query, game_id);
+        try
+        {
+            return pkmn::database::maybe_query_db_bind1<int, int>(
+                       query, game_index_out, game_id
+                   );
+        }
+        catch(...)
+        {
+            return false;
+        }
     }
 
-    int game_index_to_id(
-        int game_index
+    int game_id_to_index(
+        int game_id
     )
+    {
+        int ret = 0;
+        if(!try_game_id_to_index(game_id, ret))
+        {
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid game ID %d.") % game_id)
+            );
+        }
+
+        return ret;
+    }
+
+    bool try_game_index_to_id(
+        int game_index,
+        int& game_id_out
+    ) noexcept
     {
         if(game_index == 0)
         {
-            return 0;
+            game_id_out = 0;
+            return true;
         }
 
         static BOOST_CONSTEXPR const char* query =
             "SELECT version_id FROM version_game_indices WHERE game_index=?";
 
-        return pkmn::database::query_db_bind1<int, int>(query, game_index);
+        try
+        {
+            return pkmn::database::maybe_query_db_bind1<int, int>(
+                       query, game_id_out, game_index
+                   );
+        }
+        catch(...)
+        {
+            return false;
+        }
     }
 
-    int item_id_to_index(
-        int item_id,
-        int game_id
+    int game_index_to_id(
+        int game_index
     )
     {
-        if((item_id == 0) or (game_id == 0))
+        int ret = 0;
+        if(!try_game_index_to_id(game_index, ret))
         {
-            return 0;
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid game index %d.") % game_index)
+            );
         }
 
-        int generation = pkmn::database::game_id_to_generation(game_id);
+        return ret;
+    }
+
+    static bool _try_gcn_item_query(
+        const char* query,
+        int value,
+        int game_id,
+        int& out
+    )
+    {
+        BOOST_STATIC_CONSTEXPR int COLOSSEUM_GAME_ID = 19;
+        const bool colosseum = (game_id == COLOSSEUM_GAME_ID);
 
-        /*
-         * In any case, check the main item indices table. If this
-         * fails for a Gamecube game, check that table. If it fails
-         * for any other game, it failed overall.
-         */
-        static BOOST_CONSTEXPR const char* main_query =
-            "SELECT game_index FROM item_game_indices WHERE item_id=? "
-            "AND generation_id=?";
+        return pkmn::database::maybe_query_db_bind2<int, int, int>(
+                   query, out, value, (colosseum ? 1 : 0)
+               );
+    }
 
-        std::string error_message = "Invalid item: ";
-        error_message += item_id_to_name(item_id, game_id_to_version_group(game_id));
+    bool try_item_id_to_index(
+        int item_id,
+        int game_id,
+        int& item_index_out
+    ) noexcept
+    {
+        if((item_id == 0) or (game_id == 0))
+        {
+            item_index_out = 0;
+            return true;
+        }
 
-        int ret = 0;
-        if(pkmn::database::maybe_query_db_bind2<int, int, int>(
-               main_query, ret, item_id, generation
-           ))
+        static BOOST_CONSTEXPR const char* gcn_query =
+            "SELECT game_index FROM gamecube_item_game_indices "
+            "WHERE item_id=? AND colosseum=?";
+
+        try
         {
+            int generation = pkmn::database::game_id_to_generation(game_id);
+
             /*
-             * We know the item existed in this generation, but we need to
-             * confirm that it existed in this specific game.
+             * In any case, check the main item indices table. If this
+             * fails for a Gamecube game, check that table. If it fails
+             * for any other game, it failed overall.
              */
-            BOOST_STATIC_CONSTEXPR int RS = 5;
-            int version_group_id = pkmn::database::game_id_to_version_group(game_id);
-            if(item_id < 10000 and (version_group_id == 12 or version_group_id == 13))
-            {
-                version_group_id = RS;
-            }
-
-            if(not item_index_valid(ret, version_group_id))
+            static BOOST_CONSTEXPR const char* main_query =
+                "SELECT game_index FROM item_game_indices WHERE item_id=? "
+                "AND generation_id=?";
+
+            int ret = 0;
+            if(pkmn::database::maybe_query_db_bind2<int, int, int>(
+                   main_query, ret, item_id, generation
+               ))
             {
-                if(game_is_gamecube(game_id))
+                /*
+                 * We know the item existed in this generation, but we need to
+                 * confirm that it existed in this specific game.
+                 */
+                BOOST_STATIC_CONSTEXPR int RS = 5;
+                int version_group_id = pkmn::database::game_id_to_version_group(game_id);
+                if(item_id < 10000 and (version_group_id == 12 or version_group_id == 13))
                 {
-                    // This may share a name but be in the Gamecube indices.
-                    bool colosseum = (game_id == 19);
-
-                    static BOOST_CONSTEXPR const char* gcn_query =
-                        "SELECT game_index FROM gamecube_item_game_indices "
-                        "WHERE item_id=? AND colosseum=?";
-
-                    ret = pkmn::database::query_db_bind2<int, int, int>(
-                              gcn_query, item_id, (colosseum ? 1 : 0),
-                              error_message
-                          );
+                    version_group_id = RS;
                 }
-                else
+
+                if(item_index_valid(ret, version_group_id))
                 {
-                    throw std::invalid_argument(error_message);
+                    item_index_out = ret;
+                    return true;
                 }
             }
+
+            // This may share a name but be in the Gamecube indices.
+            return game_is_gamecube(game_id) &&
+                   _try_gcn_item_query(gcn_query, item_id, game_id, item_index_out);
         }
-        else
+        catch(...)
         {
-            if(game_is_gamecube(game_id))
-            {
-                bool colosseum = (game_id == 19);
+            return false;
+        }
+    }
 
-                static BOOST_CONSTEXPR const char* gcn_query =
-                    "SELECT game_index FROM gamecube_item_game_indices "
-                    "WHERE item_id=? AND colosseum=?";
+    int item_id_to_index(
+        int item_id,
+        int game_id
+    )
+    {
+        int ret = 0;
+        if(!try_item_id_to_index(item_id, game_id, ret))
+        {
+            std::string error_message = "Invalid item: ";
+            error_message += item_id_to_name(item_id, game_id_to_version_group(game_id));
 
-                ret = pkmn::database::query_db_bind2<int, int, int>(
-                          gcn_query, item_id, (colosseum ? 1 : 0),
-                          error_message
-                      );
-            }
-            else
-            {
-                throw std::invalid_argument(error_message);
-            }
+            throw std::invalid_argument(error_message);
         }
 
         return ret;
     }
 
-    int item_index_to_id(
+    bool try_item_index_to_id(
         int item_index,
-        int game_id
-    )
+        int game_id,
+        int& item_id_out
+    ) noexcept
     {
         if((item_index == 0) or (game_id == 0))
         {
-            return 0;
+            item_id_out = 0;
+            return true;
         }
 
-        int version_group_id = pkmn::database::game_id_to_version_group(game_id);
-
-        std::string error_message = str(boost::format("Internal error: invalid index %d for game %d.")
-                                        % item_index % game_id);
+        static BOOST_CONSTEXPR const char* gcn_query =
+            "SELECT item_id FROM gamecube_item_game_indices "
+            "WHERE game_index=? AND colosseum=?";
 
-        /*
-         * Make sure the item index is valid before attempting to query the
-         * database. This check may not succeed for Gamecube games.
-         */
-        if(not item_index_valid(item_index, version_group_id) and
-           not game_is_gamecube(game_id)
-        )
+        try
         {
-            throw std::invalid_argument(error_message);
-        }
-
-        /*
-         * In any case, check the main item indices table. If this
-         * fails for a Gamecube game, check that table. If it fails
-         * for any other game, it failed overall.
-         */
-        int generation = pkmn::database::game_id_to_generation(game_id);
-
-        static BOOST_CONSTEXPR const char* main_query =
-            "SELECT item_id FROM item_game_indices WHERE game_index=? "
-            "AND generation_id=?";
+            int version_group_id = pkmn::database::game_id_to_version_group(game_id);
 
-        int ret = 0;
-        if(not pkmn::database::maybe_query_db_bind2<int, int, int>(
-               main_query, ret, item_index, generation
-           )
-        )
-        {
-            if(game_is_gamecube(game_id))
+            /*
+             * Make sure the item index is valid before attempting to query the
+             * database. This check may not succeed for Gamecube games.
+             */
+            const bool is_gamecube = game_is_gamecube(game_id);
+            if(not item_index_valid(item_index, version_group_id) and not is_gamecube)
             {
-                bool colosseum = (game_id == 19);
+                return false;
+            }
 
-                static BOOST_CONSTEXPR const char* gcn_query =
-                    "SELECT item_id FROM gamecube_item_game_indices "
-                    "WHERE game_index=? AND colosseum=?";
+            /*
+             * In any case, check the main item indices table. If this
+             * fails for a Gamecube game, check that table. If it fails
+             * for any other game, it failed overall.
+             */
+            int generation = pkmn::database::game_id_to_generation(game_id);
 
-                ret = pkmn::database::query_db_bind2<int, int, int>(
-                          gcn_query, item_index, (colosseum ? 1 : 0)
-                      );
-            }
-            else
+            static BOOST_CONSTEXPR const char* main_query =
+                "SELECT item_id FROM item_game_indices WHERE game_index=? "
+                "AND generation_id=?";
+
+            if(pkmn::database::maybe_query_db_bind2<int, int, int>(
+                   main_query, item_id_out, item_index, generation
+               ))
             {
-                throw std::invalid_argument(error_message);
+                return true;
             }
+
+            return is_gamecube &&
+                   _try_gcn_item_query(gcn_query, item_index, game_id, item_id_out);
+        }
+        catch(...)
+        {
+            return false;
+        }
+    }
+
+    int item_index_to_id(
+        int item_index,
+        int game_id
+    )
+    {
+        int ret = 0;
+        if(!try_item_index_to_id(item_index, game_id, ret))
+        {
+            throw std::invalid_argument(
+                      str(boost::format("Internal error: invalid index %d for game %d.")
+                          % item_index % game_id)
+                  );
         }
 
         return ret;
     }
 
-    int nature_id_to_index(
-        int nature_id
-    )
+    bool try_nature_id_to_index(
+        int nature_id,
+        int& nature_index_out
+    ) noexcept
     {
         if(nature_id == 0)
         {
-            return 0;
+            nature_index_out = 0;
+            return true;
         }
 
         static BOOST_CONSTEXPR const char* query =
             "SELECT game_index FROM natures WHERE id=?";
 
-        return pkmn::database::query_db_bind1<int, int>(query, nature_id);
+        try
+        {
+            return pkmn::database::maybe_query_db_bind1<int, int>(
+                       query, nature_index_out, nature_id
+                   );
+        }
+        catch(...)
+        {
+            return false;
+        }
     }
 
-    int nature_index_to_id(
-        int nature_index
+    int nature_id_to_index(
+        int nature_id
     )
+    {
+        int ret = 0;
+        if(!try_nature_id_to_index(nature_id, ret))
+        {
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid nature ID %d.") % nature_id)
+            );
+        }
+
+        return ret;
+    }
+
+    bool try_nature_index_to_id(
+        int nature_index,
+        int& nature_id_out
+    ) noexcept
     {
         if(nature_index == 0)
         {
-            return 0;
+            nature_id_out = 0;
+            return true;
         }
 
         static BOOST_CONSTEXPR const char* query =
             "SELECT id FROM natures WHERE game_index=?";
 
-        return pkmn::database::query_db_bind1<int, int>(query, nature_index);
+        try
+        {
+            return pkmn::database::maybe_query_db_bind1<int, int>(
+                       query, nature_id_out, nature_index
+                   );
+        }
+        catch(...)
+        {
+            return false;
+        }
     }
 
-    int pokemon_id_to_index(
-        int pokemon_id,
-        int game_id
+    int nature_index_to_id(
+        int nature_index
     )
+    {
+        int ret = 0;
+        if(!try_nature_index_to_id(nature_index, ret))
+        {
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid nature index %d.") % nature_index)
+            );
+        }
+
+        return ret;
+    }
+
+    bool try_pokemon_id_to_index(
+        int pokemon_id,
+        int game_id,
+        int& pokemon_index_out
+    ) noexcept
     {
         if((pokemon_id == 0) or (game_id == 0))
         {
-            return 0;
+            pokemon_index_out = 0;
+            return true;
         }
 
         static BOOST_CONSTEXPR const char* query =
             "SELECT game_index FROM pokemon_game_indices WHERE "
             "pokemon_id=? AND version_id=?";
 
-        return pkmn::database::query_db_bind2<int, int, int>(
-                   query, pokemon_id, game_id
-               );
+        try
+        {
+            return pkmn::database::maybe_query_db_bind2<int, int, int>(
+                       query, pokemon_index_out, pokemon_id, game_id
+                   );
+        }
+        catch(...)
+        {
+            return false;
+        }
     }
 
-    int pokemon_index_to_id(
-        int pokemon_index,
+    int pokemon_id_to_index(
+        int pokemon_id,
         int game_id
     )
     {
-        if((pokemon_index == 0) or (game_id == 0))
+        int ret = 0;
+        if(!try_pokemon_id_to_index(pokemon_id, game_id, ret))
         {
-            return 0;
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid Pokémon ID %d for game %d.")
+                    % pokemon_id % game_id)
+            );
         }
 
-        int ret = 0;
+        return ret;
+    }
 
-        int generation = pkmn::database::game_id_to_generation(game_id);
+    bool try_pokemon_index_to_id(
+        int pokemon_index,
+        int game_id,
+        int& pokemon_id_out
+    ) noexcept
+    {
+        if((pokemon_index == 0) or (game_id == 0))
+        {
+            pokemon_id_out = 0;
+            return true;
+        }
 
         BOOST_STATIC_CONSTEXPR int GEN3_UNOWN_B_INDEX = 413;
         BOOST_STATIC_CONSTEXPR int GEN3_UNOWN_QMARK_INDEX = 439;
 
-        if((generation == 3) and
-           (pokemon_index >= GEN3_UNOWN_B_INDEX and pokemon_index <= GEN3_UNOWN_QMARK_INDEX))
+        try
         {
-            static BOOST_CONSTEXPR const char* query =
-                "SELECT pokemon_id FROM pokemon_forms WHERE id="
-                "(SELECT form_id FROM gen3_unown_game_indices WHERE game_index=?)";
+            int generation = pkmn::database::game_id_to_generation(game_id);
 
-            ret = pkmn::database::query_db_bind1<int, int>(
-                      query, pokemon_index
-                  );
+            if((generation == 3) and
+               (pokemon_index >= GEN3_UNOWN_B_INDEX and pokemon_index <= GEN3_UNOWN_QMARK_INDEX))
+            {
+                static BOOST_CONSTEXPR const char* query =
+                    "SELECT pokemon_id FROM pokemon_forms WHERE id="
+                    "(SELECT form_id FROM gen3_unown_game_indices WHERE game_index=?)";
+
+                return pkmn::database::maybe_query_db_bind1<int, int>(
+                           query, pokemon_id_out, pokemon_index
+                       );
+            }
+            else
+            {
+                static BOOST_CONSTEXPR const char* query =
+                    "SELECT pokemon_id FROM pokemon_game_indices WHERE "
+                    "game_index=? AND version_id=?";
+
+                return pkmn::database::maybe_query_db_bind2<int, int, int>(
+                           query, pokemon_id_out, pokemon_index, game_id
+                       );
+            }
         }
-        else
+        catch(...)
         {
-            static BOOST_CONSTEXPR const char* query =
-                "SELECT pokemon_id FROM pokemon_game_indices WHERE "
-                "game_index=? AND version_id=?";
+            return false;
+        }
+    }
 
-            ret = pkmn::database::query_db_bind2<int, int, int>(
-                      query, pokemon_index, game_id
-                  );
+    int pokemon_index_to_id(
+        int pokemon_index,
+        int game_id
+    )
+    {
+        int ret = 0;
+        if(!try_pokemon_index_to_id(pokemon_index, game_id, ret))
+        {
+            throw_internal_error<std::invalid_argument>(
+                str(boost::format("invalid Pokémon index %d for game %d.")
+                    % pokemon_index % game_id)
+            );
         }
 
         return ret;
@@ -10,6 +10,10 @@
 /*
  * These functions convert between database ID's and their corresponding
  * in-game indices.
+ *
+ * Each has a try_ version that returns whether the conversion succeeded
+ * instead of throwing, for callers that expect many invalid values, such
+ * as when validating untrusted data. The output is only set on success.
  */
 
 namespace pkmn { namespace database {
@@ -22,10 +26,20 @@ namespace pkmn { namespace database {
         int game_id
     );
 
+    bool try_game_id_to_index(
+        int game_id,
+        int& game_index_out
+    ) noexcept;
+
     int game_index_to_id(
         int game_index
     );
 
+    bool try_game_index_to_id(
+        int game_index,
+        int& game_id_out
+    ) noexcept;
+
     /*
      * Items
      */
@@ -35,11 +49,23 @@ namespace pkmn { namespace database {
         int game_id
     );
 
+    bool try_item_id_to_index(
+        int item_id,
+        int game_id,
+        int& item_index_out
+    ) noexcept;
+
     int item_index_to_id(
         int item_index,
         int game_id
     );
 
+    bool try_item_index_to_id(
+        int item_index,
+        int game_id,
+        int& item_id_out
+    ) noexcept;
+
     /*
      * Natures
      */
@@ -48,10 +74,20 @@ namespace pkmn { namespace database {
         int nature_id
     );
 
+    bool try_nature_id_to_index(
+        int nature_id,
+        int& nature_index_out
+    ) noexcept;
+
     int nature_index_to_id(
         int nature_index
     );
 
+    bool try_nature_index_to_id(
+        int nature_index,
+        int& nature_id_out
+    ) noexcept;
+
     /*
      * Pokémon
      */
@@ -61,11 +97,23 @@ namespace pkmn { namespace database {
         int game_id
     );
 
+    bool try_pokemon_id_to_index(
+        int pokemon_id,
+        int game_id,
+        int& pokemon_index_out
+    ) noexcept;
+
     int pokemon_index_to_id(
         int pokemon_index,
         int game_id
     );
 
+    bool try_pokemon_index_to_id(
+        int pokemon_index,
+        int game_id,
+        int& pokemon_id_out
+    ) noexcept;
+
 }}
 
 #endif /* PKMN_DATABASE_ID_TO_INDEX_HPP */
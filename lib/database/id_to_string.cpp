@@ -7,9 +7,12 @@
 
 #include "database_common.hpp"
 #include "id_to_string.hpp"
+#include "lookup_tables.hpp"
 
 #include <boost/config.hpp>
 
+#include <stdexcept>
+
 namespace pkmn { namespace database {
 
     std::string ability_id_to_name(
@@ -25,13 +28,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM ability_names WHERE ability_id=? AND "
             "local_language_id=9";
 
-        const std::string error_message = "Invalid ability: " + std::to_string(ability_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, ability_id
+           ))
+        {
+            throw std::invalid_argument("Invalid ability: " + std::to_string(ability_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   ability_id,
-                   error_message
-               );
+        return ret;
     }
 
     int ability_name_to_id(
@@ -46,13 +51,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT ability_id FROM ability_names WHERE name=?";
 
-        const std::string error_message = "Invalid ability: " + ability_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, ability_name
+           ))
+        {
+            throw std::invalid_argument("Invalid ability: " + ability_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   ability_name,
-                   error_message
-               );
+        return ret;
     }
 
     std::string ball_id_to_name(
@@ -67,13 +74,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT name FROM balls WHERE id=?";
 
-        const std::string error_message = "Invalid ball: " + std::to_string(ball_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, ball_id
+           ))
+        {
+            throw std::invalid_argument("Invalid ball: " + std::to_string(ball_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   ball_id,
-                   error_message
-               );
+        return ret;
     }
 
     int ball_name_to_id(
@@ -88,13 +97,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT id FROM balls WHERE name=?";
 
-        const std::string error_message = "Invalid ball: " + ball_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, ball_name
+           ))
+        {
+            throw std::invalid_argument("Invalid ball: " + ball_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   ball_name,
-                   error_message
-               );
+        return ret;
     }
 
     std::string egg_group_id_to_name(
@@ -110,13 +121,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM egg_group_prose WHERE egg_group_id=? AND "
             "local_language_id=9";
 
-        const std::string error_message = "Invalid egg group: " + std::to_string(egg_group_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, egg_group_id
+           ))
+        {
+            throw std::invalid_argument("Invalid egg group: " + std::to_string(egg_group_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   egg_group_id,
-                   error_message
-               );
+        return ret;
     }
 
     int egg_group_name_to_id(
@@ -131,13 +144,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT egg_group_id FROM egg_group_prose WHERE name=?";
 
-        const std::string error_message = "Invalid egg group: " + egg_group_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, egg_group_name
+           ))
+        {
+            throw std::invalid_argument("Invalid egg group: " + egg_group_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   egg_group_name,
-                   error_message
-               );
+        return ret;
     }
 
     std::string game_id_to_name(
@@ -153,13 +168,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM version_names WHERE version_id=? AND "
             "local_language_id=9";
 
-        const std::string error_message = "Invalid game: " + std::to_string(game_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, game_id
+           ))
+        {
+            throw std::invalid_argument("Invalid game: " + std::to_string(game_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   game_id,
-                   error_message
-               );
+        return ret;
     }
 
     int game_name_to_id(
@@ -174,13 +191,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT version_id FROM version_names WHERE name=?";
 
-        const std::string error_message = "Invalid game: " + game_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, game_name
+           ))
+        {
+            throw std::invalid_argument("Invalid game: " + game_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   game_name,
-                   error_message
-               );
+        return ret;
     }
 
     std::string item_id_to_name(
@@ -205,7 +224,15 @@ namespace pkmn { namespace database {
         BOOST_STATIC_CONSTEXPR int RS   = 5;
         BOOST_STATIC_CONSTEXPR int XY   = 25;
         BOOST_STATIC_CONSTEXPR int ORAS = 26;
-        if(version_group_id != XY and version_group_id != ORAS)
+        if(version_group_id == XY or version_group_id == ORAS)
+        {
+            const std::string* p_item_name = lookup_item_name(item_id);
+            if(p_item_name)
+            {
+                return *p_item_name;
+            }
+        }
+        else
         {
             static BOOST_CONSTEXPR const char* old_name_query =
                 "SELECT name FROM old_item_names WHERE item_id=? AND "
@@ -231,14 +258,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM item_names WHERE item_id=? AND "
             "local_language_id=9";
 
-        std::string error_message = "Invalid item: ";
-        error_message += std::to_string(item_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               main_query, ret, item_id
+           ))
+        {
+            throw std::invalid_argument("Invalid item: " + std::to_string(item_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   main_query,
-                   item_id,
-                   error_message
-               );
+        return ret;
     }
 
     int item_name_to_id(
@@ -264,12 +292,15 @@ namespace pkmn { namespace database {
         static BOOST_CONSTEXPR const char* main_query =
             "SELECT item_id FROM item_names WHERE name=?";
 
-        std::string error_message = "Invalid item: ";
-        error_message += item_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               main_query, ret, item_name
+           ))
+        {
+            throw std::invalid_argument("Invalid item: " + item_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   main_query, item_name, error_message
-               );
+        return ret;
     }
 
     std::string item_list_id_to_name(
@@ -331,12 +362,15 @@ namespace pkmn { namespace database {
         static BOOST_CONSTEXPR const char* query =
             "SELECT location_id FROM location_names WHERE name=?";
 
-        std::string error_message = "Invalid location: ";
-        error_message += location_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query, ret, location_name
+           ))
+        {
+            throw std::invalid_argument("Invalid location: " + location_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query, location_name, error_message
-               );
+        return ret;
     }
 
     std::string move_id_to_name(
@@ -349,6 +383,13 @@ namespace pkmn { namespace database {
             return "None";
         }
 
+        const move_row* p_move_row = lookup_move(move_id);
+        if(p_move_row)
+        {
+            return ((generation < 6) && !p_move_row->old_name.empty()) ? p_move_row->old_name
+                                                                        : p_move_row->name;
+        }
+
         if(generation < 6)
         {
             static BOOST_CONSTEXPR const char* old_name_query =
@@ -367,14 +408,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM move_names WHERE move_id=? AND "
             "local_language_id=9";
 
-        std::string error_message = "Invalid move: ";
-        error_message += std::to_string(move_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               main_query, ret, move_id
+           ))
+        {
+            throw std::invalid_argument("Invalid move: " + std::to_string(move_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   main_query,
-                   move_id,
-                   error_message
-               );
+        return ret;
     }
 
     int move_name_to_id(
@@ -400,12 +442,15 @@ namespace pkmn { namespace database {
         static BOOST_CONSTEXPR const char* main_query =
             "SELECT move_id FROM move_names WHERE local_language_id=9 AND name=?";
 
-        std::string error_message = "Invalid move: ";
-        error_message += move_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               main_query, ret, move_name
+           ))
+        {
+            throw std::invalid_argument("Invalid move: " + move_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   main_query, move_name, error_message
-               );
+        return ret;
     }
 
     std::string nature_id_to_name(
@@ -421,13 +466,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM nature_names WHERE nature_id=? AND "
             "local_language_id=9";
 
-        const std::string error_message = "Invalid nature: " + std::to_string(nature_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, nature_id
+           ))
+        {
+            throw std::invalid_argument("Invalid nature: " + std::to_string(nature_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   nature_id,
-                   error_message
-               );
+        return ret;
     }
 
     int nature_name_to_id(
@@ -442,13 +489,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT nature_id FROM nature_names WHERE name=?";
 
-        const std::string error_message = "Invalid nature: " + nature_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, nature_name
+           ))
+        {
+            throw std::invalid_argument("Invalid nature: " + nature_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   nature_name,
-                   error_message
-               );
+        return ret;
     }
 
     std::string species_id_to_name(
@@ -460,17 +509,25 @@ namespace pkmn { namespace database {
             return "None";
         }
 
+        const species_row* p_species_row = lookup_species(species_id);
+        if(p_species_row)
+        {
+            return p_species_row->name;
+        }
+
         static const std::string query =
             "SELECT name FROM pokemon_species_names WHERE "
             "pokemon_species_id=? AND local_language_id=9";
 
-        const std::string error_message = "Invalid species: " + std::to_string(species_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, species_id
+           ))
+        {
+            throw std::invalid_argument("Invalid species: " + std::to_string(species_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   species_id,
-                   error_message
-               );
+        return ret;
     }
 
     int species_name_to_id(
@@ -485,12 +542,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT pokemon_species_id FROM pokemon_species_names WHERE name=?";
 
-        std::string error_message = "Invalid species: ";
-        error_message += species_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, species_name
+           ))
+        {
+            throw std::invalid_argument("Invalid species: " + species_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(), species_name, error_message
-               );
+        return ret;
     }
 
     std::string type_id_to_name(
@@ -506,13 +566,15 @@ namespace pkmn { namespace database {
             "SELECT name FROM type_names WHERE type_id=? AND "
             "local_language_id=9";
 
-        const std::string error_message = "Invalid type: " + std::to_string(type_id);
+        std::string ret;
+        if(!pkmn::database::maybe_query_db_bind1<std::string, int>(
+               query.c_str(), ret, type_id
+           ))
+        {
+            throw std::invalid_argument("Invalid type: " + std::to_string(type_id));
+        }
 
-        return pkmn::database::query_db_bind1<std::string, int>(
-                   query.c_str(),
-                   type_id,
-                   error_message
-               );
+        return ret;
     }
 
     int type_name_to_id(
@@ -527,13 +589,15 @@ namespace pkmn { namespace database {
         static const std::string query =
             "SELECT type_id FROM type_names WHERE name=?";
 
-        const std::string error_message = "Invalid type: " + type_name;
+        int ret = 0;
+        if(!pkmn::database::maybe_query_db_bind1<int, const std::string&>(
+               query.c_str(), ret, type_name
+           ))
+        {
+            throw std::invalid_argument("Invalid type: " + type_name);
+        }
 
-        return pkmn::database::query_db_bind1<int, const std::string&>(
-                   query.c_str(),
-                   type_name,
-                   error_message
-               );
+        return ret;
     }
 
 }}
@@ -9,6 +9,7 @@
 #include "enum_conversions.hpp"
 #include "id_to_index.hpp"
 #include "id_to_string.hpp"
+#include "query_instrumentation.hpp"
 #include "../utils/misc.hpp"
 
 #include <pkmn/config.hpp>
@@ -219,6 +220,8 @@ namespace pkmn { namespace database {
         _none(item == pkmn::e_item::NONE),
         _invalid(false)
     {
+        query_entry_point entry_point("pkmn::database::item_entry::item_entry");
+
         /*
          * Get version information. This validates the game input and gives
          * us the information we need to get version-specific information.
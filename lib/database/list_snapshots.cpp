@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pkmn/exception.hpp>
+#include <pkmn/database/list_snapshots.hpp>
+#include <pkmn/database/lists.hpp>
+
+#include <boost/config.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace pkmn { namespace database {
+
+    /*
+     * Each slot is written at most once, after which it's never changed.
+     * Readers only need an acquire load to see a finished snapshot, and the
+     * mutex only serializes writers on a miss.
+     */
+    template <typename T, size_t num_keys>
+    class snapshot_cache
+    {
+        public:
+            typedef list_snapshot<T> snapshot_t;
+
+            snapshot_cache(): _owned_snapshots()
+            {
+                for(std::atomic<const snapshot_t*>& r_slot: _slots)
+                {
+                    r_slot.store(nullptr);
+                }
+            }
+
+            template <typename list_fcn_t>
+            snapshot_t get(
+                size_t key,
+                list_fcn_t list_fcn
+            )
+            {
+                // The underlying function will throw for invalid inputs.
+                if(key >= num_keys)
+                {
+                    return std::make_shared<const std::vector<T>>(list_fcn());
+                }
+
+                const snapshot_t* p_snapshot = _slots[key].load(std::memory_order_acquire);
+                if(!p_snapshot)
+                {
+                    boost::mutex::scoped_lock lock(_mutex);
+
+                    p_snapshot = _slots[key].load(std::memory_order_relaxed);
+                    if(!p_snapshot)
+                    {
+                        _owned_snapshots[key].reset(
+                            new snapshot_t(std::make_shared<const std::vector<T>>(list_fcn()))
+                        );
+                        p_snapshot = _owned_snapshots[key].get();
+
+                        _slots[key].store(p_snapshot, std::memory_order_release);
+                    }
+                }
+
+                return *p_snapshot;
+            }
+
+        private:
+            std::atomic<const snapshot_t*> _slots[num_keys];
+            std::unique_ptr<snapshot_t> _owned_snapshots[num_keys];
+            boost::mutex _mutex;
+    };
+
+    // Generations are used as indices directly, so index 0 goes unused.
+    BOOST_STATIC_CONSTEXPR size_t NUM_GENERATION_KEYS = 7;
+    BOOST_STATIC_CONSTEXPR size_t NUM_GAME_KEYS = size_t(pkmn::e_game::ALPHA_SAPPHIRE) + 1;
+
+    static inline size_t generation_key(
+        int generation
+    )
+    {
+        return (generation > 0) ? size_t(generation) : NUM_GENERATION_KEYS;
+    }
+
+    static inline size_t generation_key(
+        int generation,
+        bool flag
+    )
+    {
+        return (generation > 0) ? ((size_t(generation) * 2) + (flag ? 1 : 0))
+                                : (NUM_GENERATION_KEYS * 2);
+    }
+
+    static inline size_t game_key(
+        pkmn::e_game game
+    )
+    {
+        return (int(game) > 0) ? size_t(game) : NUM_GAME_KEYS;
+    }
+
+    static inline size_t game_key(
+        pkmn::e_game game,
+        bool flag
+    )
+    {
+        return (int(game) > 0) ? ((size_t(game) * 2) + (flag ? 1 : 0))
+                               : (NUM_GAME_KEYS * 2);
+    }
+
+    list_snapshot<pkmn::e_ability> get_ability_list_snapshot(
+        int generation
+    )
+    {
+        static snapshot_cache<pkmn::e_ability, NUM_GENERATION_KEYS> cache;
+
+        return cache.get(
+                   generation_key(generation),
+                   std::bind(get_ability_list, generation)
+               );
+    }
+
+    list_snapshot<std::string> get_ability_name_list_snapshot(
+        int generation
+    )
+    {
+        static snapshot_cache<std::string, NUM_GENERATION_KEYS> cache;
+
+        return cache.get(
+                   generation_key(generation),
+                   std::bind(get_ability_name_list, generation)
+               );
+    }
+
+    list_snapshot<pkmn::e_game> get_game_list_snapshot(
+        int generation,
+        bool include_previous
+    )
+    {
+        static snapshot_cache<pkmn::e_game, NUM_GENERATION_KEYS*2> cache;
+
+        return cache.get(
+                   generation_key(generation, include_previous),
+                   std::bind(get_game_list, generation, include_previous)
+               );
+    }
+
+    list_snapshot<std::string> get_game_name_list_snapshot(
+        int generation,
+        bool include_previous
+    )
+    {
+        static snapshot_cache<std::string, NUM_GENERATION_KEYS*2> cache;
+
+        return cache.get(
+                   generation_key(generation, include_previous),
+                   std::bind(get_game_name_list, generation, include_previous)
+               );
+    }
+
+    list_snapshot<pkmn::e_species> get_gamecube_shadow_pokemon_list_snapshot(
+        bool colosseum
+    )
+    {
+        static snapshot_cache<pkmn::e_species, 2> cache;
+
+        return cache.get(
+                   (colosseum ? 1 : 0),
+                   std::bind(get_gamecube_shadow_pokemon_list, colosseum)
+               );
+    }
+
+    list_snapshot<std::string> get_gamecube_shadow_pokemon_name_list_snapshot(
+        bool colosseum
+    )
+    {
+        static snapshot_cache<std::string, 2> cache;
+
+        return cache.get(
+                   (colosseum ? 1 : 0),
+                   std::bind(get_gamecube_shadow_pokemon_name_list, colosseum)
+               );
+    }
+
+    list_snapshot<pkmn::e_move> get_hm_move_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<pkmn::e_move, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_hm_move_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_hm_move_name_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_hm_move_name_list, game)
+               );
+    }
+
+    list_snapshot<pkmn::e_item> get_item_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<pkmn::e_item, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_item_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_item_name_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_item_name_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_location_name_list_snapshot(
+        pkmn::e_game game,
+        bool whole_generation
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS*2> cache;
+
+        return cache.get(
+                   game_key(game, whole_generation),
+                   std::bind(get_location_name_list, game, whole_generation)
+               );
+    }
+
+    list_snapshot<pkmn::e_move> get_move_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<pkmn::e_move, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_move_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_move_name_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_move_name_list, game)
+               );
+    }
+
+    list_snapshot<pkmn::e_nature> get_nature_list_snapshot()
+    {
+        static snapshot_cache<pkmn::e_nature, 1> cache;
+
+        return cache.get(0, get_nature_list);
+    }
+
+    list_snapshot<std::string> get_nature_name_list_snapshot()
+    {
+        static snapshot_cache<std::string, 1> cache;
+
+        return cache.get(0, get_nature_name_list);
+    }
+
+    list_snapshot<pkmn::e_species> get_pokemon_list_snapshot(
+        int generation,
+        bool include_previous
+    )
+    {
+        static snapshot_cache<pkmn::e_species, NUM_GENERATION_KEYS*2> cache;
+
+        return cache.get(
+                   generation_key(generation, include_previous),
+                   std::bind(get_pokemon_list, generation, include_previous)
+               );
+    }
+
+    list_snapshot<std::string> get_pokemon_name_list_snapshot(
+        int generation,
+        bool include_previous
+    )
+    {
+        static snapshot_cache<std::string, NUM_GENERATION_KEYS*2> cache;
+
+        return cache.get(
+                   generation_key(generation, include_previous),
+                   std::bind(get_pokemon_name_list, generation, include_previous)
+               );
+    }
+
+    list_snapshot<std::string> get_region_name_list_snapshot()
+    {
+        static snapshot_cache<std::string, 1> cache;
+
+        return cache.get(0, get_region_name_list);
+    }
+
+    list_snapshot<std::string> get_ribbon_name_list_snapshot(
+        int generation
+    )
+    {
+        static snapshot_cache<std::string, NUM_GENERATION_KEYS> cache;
+
+        return cache.get(
+                   generation_key(generation),
+                   std::bind(get_ribbon_name_list, generation)
+               );
+    }
+
+    list_snapshot<std::string> get_super_training_medal_name_list_snapshot()
+    {
+        static snapshot_cache<std::string, 1> cache;
+
+        return cache.get(0, get_super_training_medal_name_list);
+    }
+
+    list_snapshot<pkmn::e_move> get_tm_move_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<pkmn::e_move, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_tm_move_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_tm_move_name_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_tm_move_name_list, game)
+               );
+    }
+
+    list_snapshot<pkmn::e_type> get_type_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<pkmn::e_type, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_type_list, game)
+               );
+    }
+
+    list_snapshot<std::string> get_type_name_list_snapshot(
+        pkmn::e_game game
+    )
+    {
+        static snapshot_cache<std::string, NUM_GAME_KEYS> cache;
+
+        return cache.get(
+                   game_key(game),
+                   std::bind(get_type_name_list, game)
+               );
+    }
+
+    // Some lists don't exist for every game or generation, so skip those.
+    static void warm_snapshot(
+        const std::function<void(void)>& snapshot_fcn
+    )
+    {
+        try
+        {
+            snapshot_fcn();
+        }
+        catch(const pkmn::feature_not_in_game_error&)
+        {
+        }
+        catch(const pkmn::unimplemented_error&)
+        {
+        }
+    }
+
+    void warm_list_snapshots()
+    {
+        for(int generation = 1; generation <= 6; ++generation)
+        {
+            for(bool include_previous: {false, true})
+            {
+                get_game_list_snapshot(generation, include_previous);
+                get_game_name_list_snapshot(generation, include_previous);
+                get_pokemon_list_snapshot(generation, include_previous);
+                get_pokemon_name_list_snapshot(generation, include_previous);
+            }
+
+            if(generation >= 3)
+            {
+                get_ability_list_snapshot(generation);
+                get_ability_name_list_snapshot(generation);
+                warm_snapshot(std::bind(get_ribbon_name_list_snapshot, generation));
+            }
+        }
+
+        for(bool colosseum: {false, true})
+        {
+            get_gamecube_shadow_pokemon_list_snapshot(colosseum);
+            get_gamecube_shadow_pokemon_name_list_snapshot(colosseum);
+        }
+
+        for(pkmn::e_game game: *get_game_list_snapshot(6, true))
+        {
+            warm_snapshot(std::bind(get_hm_move_list_snapshot, game));
+            warm_snapshot(std::bind(get_hm_move_name_list_snapshot, game));
+            warm_snapshot(std::bind(get_item_list_snapshot, game));
+            warm_snapshot(std::bind(get_item_name_list_snapshot, game));
+            warm_snapshot(std::bind(get_location_name_list_snapshot, game, false));
+            warm_snapshot(std::bind(get_location_name_list_snapshot, game, true));
+            warm_snapshot(std::bind(get_move_list_snapshot, game));
+            warm_snapshot(std::bind(get_move_name_list_snapshot, game));
+            warm_snapshot(std::bind(get_tm_move_list_snapshot, game));
+            warm_snapshot(std::bind(get_tm_move_name_list_snapshot, game));
+            warm_snapshot(std::bind(get_type_list_snapshot, game));
+            warm_snapshot(std::bind(get_type_name_list_snapshot, game));
+        }
+
+        get_nature_list_snapshot();
+        get_nature_name_list_snapshot();
+        get_region_name_list_snapshot();
+        get_super_training_medal_name_list_snapshot();
+    }
+}}
@@ -481,34 +481,33 @@ namespace pkmn { namespace database {
 
                 for(int i = 0; i < (version_group_has_single_region(version_group_id) ? 1 : 2); ++i)
                 {
-                    SQLite::Statement stmt(
-                        get_connection(),
+                    cached_statement stmt(
                         queries[num_ranges_in_version_group[version_group_id]]
                     );
-                    stmt.bind(1, generation);
-                    stmt.bind(2, version_group_region_ids[version_group_id][i]);
+                    stmt->bind(1, generation);
+                    stmt->bind(2, version_group_region_ids[version_group_id][i]);
 
-                    stmt.bind(3, version_group_location_index_bounds[version_group_id][0][0]);
-                    stmt.bind(4, version_group_location_index_bounds[version_group_id][0][1]);
+                    stmt->bind(3, version_group_location_index_bounds[version_group_id][0][0]);
+                    stmt->bind(4, version_group_location_index_bounds[version_group_id][0][1]);
                     if(num_ranges_in_version_group[version_group_id] > 1)
                     {
-                        stmt.bind(5, version_group_location_index_bounds[version_group_id][1][0]);
-                        stmt.bind(6, version_group_location_index_bounds[version_group_id][1][1]);
+                        stmt->bind(5, version_group_location_index_bounds[version_group_id][1][0]);
+                        stmt->bind(6, version_group_location_index_bounds[version_group_id][1][1]);
                     }
                     if(num_ranges_in_version_group[version_group_id] > 2)
                     {
-                        stmt.bind(7, version_group_location_index_bounds[version_group_id][2][0]);
-                        stmt.bind(8, version_group_location_index_bounds[version_group_id][2][1]);
+                        stmt->bind(7, version_group_location_index_bounds[version_group_id][2][0]);
+                        stmt->bind(8, version_group_location_index_bounds[version_group_id][2][1]);
                     }
                     if(num_ranges_in_version_group[version_group_id] > 3)
                     {
-                        stmt.bind(9, version_group_location_index_bounds[version_group_id][3][0]);
-                        stmt.bind(10, version_group_location_index_bounds[version_group_id][3][1]);
+                        stmt->bind(9, version_group_location_index_bounds[version_group_id][3][0]);
+                        stmt->bind(10, version_group_location_index_bounds[version_group_id][3][1]);
                     }
 
-                    while(stmt.executeStep())
+                    while(stmt->executeStep())
                     {
-                        ret.push_back(static_cast<const char*>(stmt.getColumn(0)));
+                        ret.push_back(static_cast<const char*>(stmt->getColumn(0)));
                     }
                 }
             }
@@ -0,0 +1,525 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "database_common.hpp"
+#include "lookup_tables.hpp"
+
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace pkmn { namespace database {
+
+    /*
+     * Table construction
+     */
+
+    static id_table<game_row> _build_game_table()
+    {
+        static BOOST_CONSTEXPR const char* query =
+            "SELECT versions.id,versions.version_group_id,version_groups.generation_id "
+            "FROM versions INNER JOIN version_groups ON "
+            "(versions.version_group_id=version_groups.id)";
+
+        id_table<game_row> ret;
+
+        cached_statement stmt(query);
+        while(stmt->executeStep())
+        {
+            game_row row;
+            row.version_group_id = stmt->getColumn(1);
+            row.generation       = stmt->getColumn(2);
+
+            ret.insert(stmt->getColumn(0), row);
+        }
+
+        return ret;
+    }
+
+    static id_table<species_row> _build_species_table()
+    {
+        static BOOST_CONSTEXPR const char* query =
+            "SELECT pokemon_species.id,pokemon_species_names.name,"
+            "pokemon_species.gender_rate,pokemon_species.growth_rate_id,"
+            "pokemon_species.base_happiness,pokemon_species.has_gender_differences "
+            "FROM pokemon_species INNER JOIN pokemon_species_names ON "
+            "(pokemon_species.id=pokemon_species_names.pokemon_species_id) "
+            "WHERE pokemon_species_names.local_language_id=9";
+
+        id_table<species_row> ret;
+
+        cached_statement stmt(query);
+        while(stmt->executeStep())
+        {
+            species_row row;
+            row.name                   = stmt->getColumn(1).getText();
+            row.gender_rate            = stmt->getColumn(2);
+            row.growth_rate_id         = stmt->getColumn(3);
+            row.base_happiness         = stmt->getColumn(4);
+            row.has_gender_differences = (int(stmt->getColumn(5)) > 0);
+
+            ret.insert(stmt->getColumn(0), row);
+        }
+
+        return ret;
+    }
+
+    static pokemon_row* _get_or_insert_pokemon_row(
+        id_table<pokemon_row>& r_table,
+        int pokemon_id
+    )
+    {
+        pokemon_row* p_row = r_table.find_mutable(pokemon_id);
+        if(!p_row)
+        {
+            pokemon_row row;
+            row.base_stats.fill(0);
+            row.EV_yields.fill(0);
+            row.num_stats = 0;
+            row.gen1_special = 0;
+            row.has_gen1_special = false;
+            row.first_type_id = 0;
+            row.second_type_id = 0;
+
+            r_table.insert(pokemon_id, row);
+            p_row = r_table.find_mutable(pokemon_id);
+        }
+
+        return p_row;
+    }
+
+    static id_table<pokemon_row> _build_pokemon_table()
+    {
+        BOOST_STATIC_CONSTEXPR int GEN1_SPECIAL_STAT_ID = 9;
+
+        static BOOST_CONSTEXPR const char* stats_query =
+            "SELECT pokemon_id,stat_id,base_stat,effort FROM pokemon_stats";
+
+        static BOOST_CONSTEXPR const char* types_query =
+            "SELECT pokemon_id,type_id,slot FROM pokemon_types";
+
+        id_table<pokemon_row> ret;
+
+        cached_statement stats_stmt(stats_query);
+        while(stats_stmt->executeStep())
+        {
+            pokemon_row* p_row = _get_or_insert_pokemon_row(
+                                     ret,
+                                     stats_stmt->getColumn(0)
+                                 );
+
+            int stat_id = stats_stmt->getColumn(1);
+            if((stat_id >= 1) && (stat_id <= 6))
+            {
+                p_row->base_stats[stat_id-1] = stats_stmt->getColumn(2);
+                p_row->EV_yields[stat_id-1]  = stats_stmt->getColumn(3);
+                ++p_row->num_stats;
+            }
+            else if(stat_id == GEN1_SPECIAL_STAT_ID)
+            {
+                p_row->gen1_special = stats_stmt->getColumn(2);
+                p_row->has_gen1_special = true;
+            }
+        }
+
+        cached_statement types_stmt(types_query);
+        while(types_stmt->executeStep())
+        {
+            pokemon_row* p_row = _get_or_insert_pokemon_row(
+                                     ret,
+                                     types_stmt->getColumn(0)
+                                 );
+
+            int slot = types_stmt->getColumn(2);
+            if(slot == 1)
+            {
+                p_row->first_type_id = types_stmt->getColumn(1);
+            }
+            else if(slot == 2)
+            {
+                p_row->second_type_id = types_stmt->getColumn(1);
+            }
+        }
+
+        return ret;
+    }
+
+    static id_table<move_row> _build_move_table()
+    {
+        static BOOST_CONSTEXPR const char* main_query =
+            "SELECT moves.id,move_names.name,moves.type_id,moves.power,moves.pp "
+            "FROM moves INNER JOIN move_names ON (moves.id=move_names.move_id) "
+            "WHERE move_names.local_language_id=9";
+
+        static BOOST_CONSTEXPR const char* old_names_query =
+            "SELECT move_id,name FROM old_move_names";
+
+        static BOOST_CONSTEXPR const char* old_powers_query =
+            "SELECT move_id,gen1_power,gen2_power,gen3_power,gen4_power,gen5_power "
+            "FROM old_move_powers";
+
+        static BOOST_CONSTEXPR const char* old_pps_query =
+            "SELECT move_id,gen1_pp,gen2_pp,gen3_pp,gen4_pp,gen5_pp "
+            "FROM old_move_pps";
+
+        id_table<move_row> ret;
+
+        cached_statement main_stmt(main_query);
+        while(main_stmt->executeStep())
+        {
+            move_row row;
+            row.name    = main_stmt->getColumn(1).getText();
+            row.type_id = main_stmt->getColumn(2);
+            row.power   = main_stmt->getColumn(3);
+            row.pp      = main_stmt->getColumn(4);
+            row.old_powers.fill(0);
+            row.has_old_powers = false;
+            row.old_pps.fill(0);
+            row.has_old_pps = false;
+
+            ret.insert(main_stmt->getColumn(0), row);
+        }
+
+        // The single-move queries these replace take the first matching
+        // row, so do the same here.
+
+        cached_statement old_names_stmt(old_names_query);
+        while(old_names_stmt->executeStep())
+        {
+            move_row* p_row = ret.find_mutable(old_names_stmt->getColumn(0));
+            if(p_row && p_row->old_name.empty())
+            {
+                p_row->old_name = old_names_stmt->getColumn(1).getText();
+            }
+        }
+
+        cached_statement old_powers_stmt(old_powers_query);
+        while(old_powers_stmt->executeStep())
+        {
+            move_row* p_row = ret.find_mutable(old_powers_stmt->getColumn(0));
+            if(p_row && !p_row->has_old_powers)
+            {
+                for(int generation = 1; generation <= 5; ++generation)
+                {
+                    p_row->old_powers[generation] = old_powers_stmt->getColumn(generation);
+                }
+                p_row->has_old_powers = true;
+            }
+        }
+
+        cached_statement old_pps_stmt(old_pps_query);
+        while(old_pps_stmt->executeStep())
+        {
+            move_row* p_row = ret.find_mutable(old_pps_stmt->getColumn(0));
+            if(p_row && !p_row->has_old_pps)
+            {
+                for(int generation = 1; generation <= 5; ++generation)
+                {
+                    p_row->old_pps[generation] = old_pps_stmt->getColumn(generation);
+                }
+                p_row->has_old_pps = true;
+            }
+        }
+
+        return ret;
+    }
+
+    static id_table<std::string> _build_item_name_table()
+    {
+        static BOOST_CONSTEXPR const char* query =
+            "SELECT item_id,name FROM item_names WHERE local_language_id=9";
+
+        id_table<std::string> ret;
+
+        cached_statement stmt(query);
+        while(stmt->executeStep())
+        {
+            int item_id = stmt->getColumn(0);
+            if(!ret.find(item_id))
+            {
+                ret.insert(item_id, stmt->getColumn(1).getText());
+            }
+        }
+
+        return ret;
+    }
+
+    // Indexed by growth rate ID, then level. Level 0 is unused.
+    typedef std::vector<std::vector<int>> experience_table_t;
+
+    static experience_table_t _build_experience_table()
+    {
+        static BOOST_CONSTEXPR const char* query =
+            "SELECT growth_rate_id,level,experience FROM experience";
+
+        experience_table_t ret;
+
+        cached_statement stmt(query);
+        while(stmt->executeStep())
+        {
+            int growth_rate_id = stmt->getColumn(0);
+            int level = stmt->getColumn(1);
+
+            if((growth_rate_id > 0) && (level > 0))
+            {
+                if(size_t(growth_rate_id) >= ret.size())
+                {
+                    ret.resize(growth_rate_id + 1);
+                }
+
+                std::vector<int>& r_levels = ret[growth_rate_id];
+                if(size_t(level) >= r_levels.size())
+                {
+                    r_levels.resize(level + 1, -1);
+                }
+
+                r_levels[level] = stmt->getColumn(2);
+            }
+        }
+
+        // Only keep growth rates with no gaps, so a binary search over the
+        // levels is valid.
+        for(std::vector<int>& r_levels: ret)
+        {
+            if(std::find(r_levels.begin()+1, r_levels.end(), -1) != r_levels.end())
+            {
+                r_levels.clear();
+            }
+        }
+
+        return ret;
+    }
+
+    /*
+     * Types are dense from 1, plus ??? and Shadow at 10001 and 10002, so
+     * both ranges fit in one small square table. Missing matchups are -1.
+     */
+    BOOST_STATIC_CONSTEXPR int NUM_TYPE_IDS = 18;
+    BOOST_STATIC_CONSTEXPR int EXTENDED_TYPE_ID_START = 10001;
+    BOOST_STATIC_CONSTEXPR int NUM_EXTENDED_TYPE_IDS = 2;
+    BOOST_STATIC_CONSTEXPR int TYPE_TABLE_SIZE = NUM_TYPE_IDS + NUM_EXTENDED_TYPE_IDS + 1;
+
+    typedef std::array<std::array<int, TYPE_TABLE_SIZE>, TYPE_TABLE_SIZE> type_efficacy_table_t;
+
+    static int _type_id_to_table_index(
+        int type_id
+    )
+    {
+        int ret = -1;
+
+        if((type_id > 0) && (type_id <= NUM_TYPE_IDS))
+        {
+            ret = type_id;
+        }
+        else if((type_id >= EXTENDED_TYPE_ID_START) &&
+                (type_id < (EXTENDED_TYPE_ID_START + NUM_EXTENDED_TYPE_IDS)))
+        {
+            ret = NUM_TYPE_IDS + 1 + (type_id - EXTENDED_TYPE_ID_START);
+        }
+
+        return ret;
+    }
+
+    static type_efficacy_table_t _build_type_efficacy_table(
+        const char* query
+    )
+    {
+        type_efficacy_table_t ret;
+        for(std::array<int, TYPE_TABLE_SIZE>& r_row: ret)
+        {
+            r_row.fill(-1);
+        }
+
+        cached_statement stmt(query);
+        while(stmt->executeStep())
+        {
+            int damage_type_index = _type_id_to_table_index(stmt->getColumn(0));
+            int target_type_index = _type_id_to_table_index(stmt->getColumn(1));
+
+            if((damage_type_index > 0) && (target_type_index > 0))
+            {
+                ret[damage_type_index][target_type_index] = stmt->getColumn(2);
+            }
+        }
+
+        return ret;
+    }
+
+    /*
+     * Lookups
+     */
+
+    const game_row* lookup_game(
+        int game_id
+    )
+    {
+        static const id_table<game_row> GAME_TABLE = _build_game_table();
+
+        return GAME_TABLE.find(game_id);
+    }
+
+    const species_row* lookup_species(
+        int species_id
+    )
+    {
+        static const id_table<species_row> SPECIES_TABLE = _build_species_table();
+
+        return SPECIES_TABLE.find(species_id);
+    }
+
+    const pokemon_row* lookup_pokemon(
+        int pokemon_id
+    )
+    {
+        static const id_table<pokemon_row> POKEMON_TABLE = _build_pokemon_table();
+
+        return POKEMON_TABLE.find(pokemon_id);
+    }
+
+    const move_row* lookup_move(
+        int move_id
+    )
+    {
+        static const id_table<move_row> MOVE_TABLE = _build_move_table();
+
+        return MOVE_TABLE.find(move_id);
+    }
+
+    bool lookup_move_pps(
+        int move_id,
+        int generation,
+        std::array<int, 4>* p_PPs_out
+    )
+    {
+        const move_row* p_move_row = lookup_move(move_id);
+
+        bool ret = false;
+        if(p_move_row && (generation > 0) && (generation <= 6))
+        {
+            int base_pp = ((generation < 6) && p_move_row->has_old_pps) ? p_move_row->old_pps[generation]
+                                                                        : p_move_row->pp;
+
+            // Each PP Up adds a fifth of the base PP, rounded down.
+            int PP_up_bonus = int(base_pp * 0.2);
+            for(int num_PP_ups = 0; num_PP_ups < 4; ++num_PP_ups)
+            {
+                (*p_PPs_out)[num_PP_ups] = base_pp + (num_PP_ups * PP_up_bonus);
+            }
+
+            ret = true;
+        }
+
+        return ret;
+    }
+
+    const std::string* lookup_item_name(
+        int item_id
+    )
+    {
+        static const id_table<std::string> ITEM_NAME_TABLE = _build_item_name_table();
+
+        return ITEM_NAME_TABLE.find(item_id);
+    }
+
+    static const experience_table_t& _get_experience_table()
+    {
+        static const experience_table_t EXPERIENCE_TABLE = _build_experience_table();
+
+        return EXPERIENCE_TABLE;
+    }
+
+    bool lookup_experience_at_level(
+        int growth_rate_id,
+        int level,
+        int* p_experience_out
+    )
+    {
+        const experience_table_t& experience_table = _get_experience_table();
+
+        bool ret = false;
+        if((growth_rate_id > 0) && (size_t(growth_rate_id) < experience_table.size()))
+        {
+            const std::vector<int>& r_levels = experience_table[growth_rate_id];
+            if((level > 0) && (size_t(level) < r_levels.size()))
+            {
+                *p_experience_out = r_levels[level];
+                ret = true;
+            }
+        }
+
+        return ret;
+    }
+
+    bool lookup_level_at_experience(
+        int growth_rate_id,
+        int experience,
+        int* p_level_out
+    )
+    {
+        const experience_table_t& experience_table = _get_experience_table();
+
+        bool ret = false;
+        if((growth_rate_id > 0) && (size_t(growth_rate_id) < experience_table.size()))
+        {
+            const std::vector<int>& r_levels = experience_table[growth_rate_id];
+            if(r_levels.size() > 1)
+            {
+                // The highest level whose experience is <= the given value
+                int num_levels_reached = int(
+                                             std::upper_bound(
+                                                 r_levels.begin()+1,
+                                                 r_levels.end(),
+                                                 experience
+                                             ) - (r_levels.begin()+1)
+                                         );
+                if(num_levels_reached > 0)
+                {
+                    *p_level_out = num_levels_reached;
+                    ret = true;
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    bool lookup_type_efficacy(
+        int generation,
+        int damage_type_id,
+        int target_type_id,
+        int* p_damage_factor_out
+    )
+    {
+        static const type_efficacy_table_t GEN1_TYPE_EFFICACY_TABLE = _build_type_efficacy_table(
+            "SELECT damage_type_id,target_type_id,damage_factor FROM gen1_type_efficacy"
+        );
+        static const type_efficacy_table_t TYPE_EFFICACY_TABLE = _build_type_efficacy_table(
+            "SELECT damage_type_id,target_type_id,damage_factor FROM type_efficacy"
+        );
+
+        const type_efficacy_table_t& type_efficacy_table = (generation == 1) ? GEN1_TYPE_EFFICACY_TABLE
+                                                                             : TYPE_EFFICACY_TABLE;
+
+        int damage_type_index = _type_id_to_table_index(damage_type_id);
+        int target_type_index = _type_id_to_table_index(target_type_id);
+
+        bool ret = false;
+        if((damage_type_index > 0) && (target_type_index > 0))
+        {
+            int damage_factor = type_efficacy_table[damage_type_index][target_type_index];
+            if(damage_factor >= 0)
+            {
+                *p_damage_factor_out = damage_factor;
+                ret = true;
+            }
+        }
+
+        return ret;
+    }
+
+}}
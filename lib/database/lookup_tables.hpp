@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+#ifndef PKMN_DATABASE_LOOKUP_TABLES_HPP
+#define PKMN_DATABASE_LOOKUP_TABLES_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+
+/*
+ * Tables for values that are looked up constantly. Each table is filled with
+ * a single query the first time it's needed and indexed by database ID from
+ * then on.
+ *
+ * Each lookup function returns nullptr (or false) if the table doesn't have
+ * the given value, in which case the caller should fall back to querying the
+ * database directly so that errors are reported the same way.
+ */
+
+namespace pkmn { namespace database {
+
+    /*
+     * Veekun IDs are dense from 1, plus a second dense range starting at
+     * 10001 for alternate forms and Gamecube-only entries.
+     */
+    template <typename row_type>
+    class id_table
+    {
+        public:
+            id_table(): _rows(), _extended_rows() {}
+
+            void insert(
+                int id,
+                const row_type& row
+            )
+            {
+                std::vector<table_entry>& r_rows = get_rows(id);
+                size_t index = get_index(id);
+
+                if(index >= r_rows.size())
+                {
+                    r_rows.resize(index + 1);
+                }
+
+                r_rows[index].row = row;
+                r_rows[index].is_present = true;
+            }
+
+            // Returns nullptr if the row isn't present, so callers can
+            // modify a row while filling the table.
+            row_type* find_mutable(
+                int id
+            )
+            {
+                return const_cast<row_type*>(
+                           static_cast<const id_table*>(this)->find(id)
+                       );
+            }
+
+            const row_type* find(
+                int id
+            ) const
+            {
+                const row_type* ret = nullptr;
+
+                if(id > 0)
+                {
+                    const std::vector<table_entry>& r_rows = get_rows(id);
+                    size_t index = get_index(id);
+
+                    if((index < r_rows.size()) && r_rows[index].is_present)
+                    {
+                        ret = &r_rows[index].row;
+                    }
+                }
+
+                return ret;
+            }
+
+        private:
+            static const int EXTENDED_ID_START = 10001;
+
+            struct table_entry
+            {
+                table_entry(): row(), is_present(false) {}
+
+                row_type row;
+                bool is_present;
+            };
+
+            std::vector<table_entry> _rows;
+            std::vector<table_entry> _extended_rows;
+
+            static inline size_t get_index(
+                int id
+            )
+            {
+                return (id >= EXTENDED_ID_START) ? size_t(id - EXTENDED_ID_START)
+                                                 : size_t(id);
+            }
+
+            inline std::vector<table_entry>& get_rows(
+                int id
+            )
+            {
+                return (id >= EXTENDED_ID_START) ? _extended_rows : _rows;
+            }
+
+            inline const std::vector<table_entry>& get_rows(
+                int id
+            ) const
+            {
+                return (id >= EXTENDED_ID_START) ? _extended_rows : _rows;
+            }
+    };
+
+    struct game_row
+    {
+        int version_group_id;
+        int generation;
+    };
+
+    struct species_row
+    {
+        std::string name;
+
+        // As stored in the database, -1 for genderless
+        int gender_rate;
+        int growth_rate_id;
+        int base_happiness;
+        bool has_gender_differences;
+    };
+
+    struct pokemon_row
+    {
+        // Ordered by Veekun stat ID: HP, Attack, Defense, Special Attack,
+        // Special Defense, Speed
+        std::array<int, 6> base_stats;
+        std::array<int, 6> EV_yields;
+        int num_stats;
+
+        // Generation I's Special stat, if this Pokémon existed then
+        int gen1_special;
+        bool has_gen1_special;
+
+        // 0 if not present
+        int first_type_id;
+        int second_type_id;
+    };
+
+    struct move_row
+    {
+        std::string name;
+
+        // Empty if the name never changed
+        std::string old_name;
+
+        int type_id;
+        int power;
+        int pp;
+
+        // Indexed by generation (1-5). Only valid if the flag is set, which
+        // means the database has an older value for this move.
+        std::array<int, 6> old_powers;
+        bool has_old_powers;
+        std::array<int, 6> old_pps;
+        bool has_old_pps;
+    };
+
+    const game_row* lookup_game(
+        int game_id
+    );
+
+    const species_row* lookup_species(
+        int species_id
+    );
+
+    const pokemon_row* lookup_pokemon(
+        int pokemon_id
+    );
+
+    const move_row* lookup_move(
+        int move_id
+    );
+
+    // A move's PP with 0-3 PP Ups, as of the given generation
+    bool lookup_move_pps(
+        int move_id,
+        int generation,
+        std::array<int, 4>* p_PPs_out
+    );
+
+    // Latest (Generation VI) spelling
+    const std::string* lookup_item_name(
+        int item_id
+    );
+
+    bool lookup_experience_at_level(
+        int growth_rate_id,
+        int level,
+        int* p_experience_out
+    );
+
+    bool lookup_level_at_experience(
+        int growth_rate_id,
+        int experience,
+        int* p_level_out
+    );
+
+    // Generation I has its own type chart, and every later generation
+    // shares the modern one.
+    bool lookup_type_efficacy(
+        int generation,
+        int damage_type_id,
+        int target_type_id,
+        int* p_damage_factor_out
+    );
+
+}}
+
+#endif /* PKMN_DATABASE_LOOKUP_TABLES_HPP */
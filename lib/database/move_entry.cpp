@@ -10,6 +10,8 @@
 #include "enum_conversions.hpp"
 #include "database_common.hpp"
 #include "id_to_string.hpp"
+#include "lookup_tables.hpp"
+#include "query_instrumentation.hpp"
 
 #include <pkmn/exception.hpp>
 #include <pkmn/database/move_entry.hpp>
@@ -17,6 +19,7 @@
 #include <boost/config.hpp>
 #include <boost/format.hpp>
 
+#include <array>
 #include <sstream>
 #include <stdexcept>
 
@@ -96,6 +99,8 @@ namespace pkmn { namespace database {
         _none(move == pkmn::e_move::NONE),
         _invalid(move == pkmn::e_move::INVALID)
     {
+        query_entry_point entry_point("pkmn::database::move_entry::move_entry");
+
         // Input validation
         _game_id = pkmn::database::game_enum_to_id(game);
         _generation = pkmn::database::game_id_to_generation(
@@ -199,7 +204,12 @@ namespace pkmn { namespace database {
                 }
             }
 
-            if(ret == pkmn::e_type::NONE)
+            const move_row* p_move_row = lookup_move(_move_id);
+            if((ret == pkmn::e_type::NONE) && p_move_row)
+            {
+                ret = static_cast<pkmn::e_type>(p_move_row->type_id);
+            }
+            else if(ret == pkmn::e_type::NONE)
             {
                 static const std::string query =
                     "SELECT type_id FROM moves WHERE id=?";
@@ -305,6 +315,12 @@ namespace pkmn { namespace database {
         else if(_move_id == 10001 and _game_id == 19) {
             // Edge case not worth putting in a database
             ret = 90;
+        } else if(const move_row* p_move_row = lookup_move(_move_id)) {
+            if((_generation < 6) && p_move_row->has_old_powers) {
+                ret = p_move_row->old_powers[_generation];
+            } else {
+                ret = p_move_row->power;
+            }
         } else {
             static BOOST_CONSTEXPR const char* main_query = \
                 "SELECT power FROM moves WHERE id=?";
@@ -373,34 +389,42 @@ namespace pkmn { namespace database {
                 "SELECT gen5_pp FROM old_move_pps WHERE move_id=?",
             };
 
-            /*
-             * If this entry is for an older game, check if it had an older
-             * base PP. If not, fall back to the default query.
-             */
-            int base_pp = -1;
-            if(_generation < 6)
+            std::array<int, 4> PPs;
+            if(lookup_move_pps(_move_id, _generation, &PPs))
             {
-                (void)pkmn::database::maybe_query_db_bind1<int, int>(
-                          old_queries[_generation],
-                          base_pp, _move_id
-                      );
+                ret = PPs[num_pp_ups];
             }
-
-            if(base_pp == -1)
+            else
             {
-                base_pp = pkmn::database::query_db_bind1<int, int>(
-                              main_query, _move_id
+                /*
+                 * If this entry is for an older game, check if it had an older
+                 * base PP. If not, fall back to the default query.
+                 */
+                int base_pp = -1;
+                if(_generation < 6)
+                {
+                    (void)pkmn::database::maybe_query_db_bind1<int, int>(
+                              old_queries[_generation],
+                              base_pp, _move_id
                           );
-            }
+                }
 
-            if(num_pp_ups == 0)
-            {
-                ret = base_pp;
-            }
-            else
-            {
-                int _20p = int(base_pp * 0.2);
-                ret = (base_pp + (num_pp_ups * _20p));
+                if(base_pp == -1)
+                {
+                    base_pp = pkmn::database::query_db_bind1<int, int>(
+                                  main_query, _move_id
+                              );
+                }
+
+                if(num_pp_ups == 0)
+                {
+                    ret = base_pp;
+                }
+                else
+                {
+                    int _20p = int(base_pp * 0.2);
+                    ret = (base_pp + (num_pp_ups * _20p));
+                }
             }
         }
 
@@ -12,6 +12,8 @@
 #include "enum_conversions.hpp"
 #include "id_to_index.hpp"
 #include "id_to_string.hpp"
+#include "lookup_tables.hpp"
+#include "query_instrumentation.hpp"
 
 #include <pkmn/exception.hpp>
 #include <pkmn/database/pokemon_entry.hpp>
@@ -101,18 +103,18 @@ namespace pkmn { namespace database {
         bool tmhm
     )
     {
-        SQLite::Statement stmt(get_connection(), query);
-        stmt.bind(1, pokemon_id);
-        stmt.bind(2, version_group_id);
+        cached_statement stmt(query);
+        stmt->bind(1, pokemon_id);
+        stmt->bind(2, version_group_id);
         if(tmhm)
         {
-            stmt.bind(3, version_group_id);
+            stmt->bind(3, version_group_id);
         }
 
-        while(stmt.executeStep())
+        while(stmt->executeStep())
         {
             move_list_out.emplace_back(
-                static_cast<pkmn::e_move>(int(stmt.getColumn(0)))
+                static_cast<pkmn::e_move>(int(stmt->getColumn(0)))
             );
         }
     }
@@ -248,6 +250,8 @@ namespace pkmn { namespace database {
         _invalid(species == pkmn::e_species::INVALID),
         _shadow(false)
     {
+        query_entry_point entry_point("pkmn::database::pokemon_entry::pokemon_entry");
+
         /*
          * Game-related info
          */
@@ -455,19 +459,31 @@ namespace pkmn { namespace database {
         (8,  0.0f)
     ;
 
+    static int _get_gender_rate(
+        int species_id
+    )
+    {
+        const species_row* p_species_row = lookup_species(species_id);
+        if(p_species_row)
+        {
+            return p_species_row->gender_rate;
+        }
+
+        static BOOST_CONSTEXPR const char* query = \
+            "SELECT gender_rate FROM pokemon_species WHERE id=?";
+
+        return pkmn::database::query_db_bind1<int, int>(
+                   query, species_id
+               );
+    }
+
     float pokemon_entry::get_chance_male() const {
         float ret = 0.0f;
 
         if(_none or _invalid) {
             ret = -1.0f;
         } else {
-            static BOOST_CONSTEXPR const char* query = \
-                "SELECT gender_rate FROM pokemon_species WHERE id=?";
-
-            int gender_rate_from_db = pkmn::database::query_db_bind1<int, int>(
-                                          query, _species_id
-                                      );
-            ret = _veekun_gender_rates.at(gender_rate_from_db);
+            ret = _veekun_gender_rates.at(_get_gender_rate(_species_id));
         }
 
         return ret;
@@ -479,12 +495,7 @@ namespace pkmn { namespace database {
         if(_none or _invalid) {
             ret = -1.0f;
         } else {
-            static BOOST_CONSTEXPR const char* query = \
-                "SELECT gender_rate FROM pokemon_species WHERE id=?";
-
-            int gender_rate_from_db = pkmn::database::query_db_bind1<int, int>(
-                                          query, _species_id
-                                      );
+            int gender_rate_from_db = _get_gender_rate(_species_id);
             if(gender_rate_from_db == -1) {
                 ret = 0.0f;
             } else {
@@ -501,6 +512,8 @@ namespace pkmn { namespace database {
         // Physical gender differences started in Generation IV
         if(_none or _invalid or _generation < 4) {
             ret = false;
+        } else if(const species_row* p_species_row = lookup_species(_species_id)) {
+            ret = p_species_row->has_gender_differences;
         } else {
             static BOOST_CONSTEXPR const char* query = \
                 "SELECT has_gender_differences FROM pokemon_species WHERE id=?";
@@ -520,6 +533,8 @@ namespace pkmn { namespace database {
         // Happiness was introduced in Generation II
         if(_none or _invalid or _generation == 1) {
             ret = -1;
+        } else if(const species_row* p_species_row = lookup_species(_species_id)) {
+            ret = p_species_row->base_happiness;
         } else {
             static BOOST_CONSTEXPR const char* query = \
                 "SELECT base_happiness FROM pokemon_species WHERE id=?";
@@ -584,26 +599,35 @@ namespace pkmn { namespace database {
             }
             else
             {
-                static const std::string first_type_query =
-                    "SELECT type_id FROM pokemon_types WHERE pokemon_id=? AND slot=1";
-
-                ret.first = static_cast<pkmn::e_type>(int(
-                                pkmn::database::query_db_bind1<int, int>(
-                                    first_type_query.c_str(),
-                                    _pokemon_id
-                                )));
-
-                static const std::string second_type_query =
-                    "SELECT type_id FROM pokemon_types WHERE pokemon_id=? AND slot=2";
-                int second_type_as_int = 0;
-
-                if(pkmn::database::maybe_query_db_bind1<int, int>(
-                       second_type_query.c_str(),
-                       second_type_as_int,
-                       _pokemon_id
-                   ))
+                const pokemon_row* p_pokemon_row = lookup_pokemon(_pokemon_id);
+                if(p_pokemon_row && (p_pokemon_row->first_type_id > 0))
                 {
-                    ret.second = static_cast<pkmn::e_type>(second_type_as_int);
+                    ret.first = static_cast<pkmn::e_type>(p_pokemon_row->first_type_id);
+                    ret.second = static_cast<pkmn::e_type>(p_pokemon_row->second_type_id);
+                }
+                else
+                {
+                    static const std::string first_type_query =
+                        "SELECT type_id FROM pokemon_types WHERE pokemon_id=? AND slot=1";
+
+                    ret.first = static_cast<pkmn::e_type>(int(
+                                    pkmn::database::query_db_bind1<int, int>(
+                                        first_type_query.c_str(),
+                                        _pokemon_id
+                                    )));
+
+                    static const std::string second_type_query =
+                        "SELECT type_id FROM pokemon_types WHERE pokemon_id=? AND slot=2";
+                    int second_type_as_int = 0;
+
+                    if(pkmn::database::maybe_query_db_bind1<int, int>(
+                           second_type_query.c_str(),
+                           second_type_as_int,
+                           _pokemon_id
+                       ))
+                    {
+                        ret.second = static_cast<pkmn::e_type>(second_type_as_int);
+                    }
                 }
 
                 if((_generation < 6) && species_id_had_normal_primary(_species_id))
@@ -701,14 +725,14 @@ namespace pkmn { namespace database {
             static const std::string query =
                 "SELECT egg_group_id FROM pokemon_egg_groups WHERE species_id=? ORDER BY egg_group_id";
 
-            SQLite::Statement stmt(get_connection(), query);
-            stmt.bind(1, _species_id);
+            cached_statement stmt(query);
+            stmt->bind(1, _species_id);
 
-            stmt.executeStep();
-            ret.first = static_cast<pkmn::e_egg_group>(int(stmt.getColumn(0)));
-            if(stmt.executeStep())
+            stmt->executeStep();
+            ret.first = static_cast<pkmn::e_egg_group>(int(stmt->getColumn(0)));
+            if(stmt->executeStep())
             {
-                ret.second = static_cast<pkmn::e_egg_group>(int(stmt.getColumn(0)));
+                ret.second = static_cast<pkmn::e_egg_group>(int(stmt->getColumn(0)));
             }
             else
             {
@@ -748,6 +772,15 @@ namespace pkmn { namespace database {
         r_ret[key] = r_stmt.getColumn(0);
     }
 
+    static inline bool _can_use_pokemon_row(
+        const pokemon_row* p_pokemon_row,
+        int generation
+    )
+    {
+        return p_pokemon_row && (p_pokemon_row->num_stats == 6) &&
+               ((generation > 1) || p_pokemon_row->has_gen1_special);
+    }
+
     std::map<pkmn::e_stat, int> pokemon_entry::get_base_stats() const
     {
         std::map<pkmn::e_stat, int> ret;
@@ -757,6 +790,24 @@ namespace pkmn { namespace database {
             ret = (_generation == 1) ? _bad_stat_map_old
                                      : _bad_stat_map;
         }
+        else if(_can_use_pokemon_row(lookup_pokemon(_pokemon_id), _generation))
+        {
+            const pokemon_row* p_pokemon_row = lookup_pokemon(_pokemon_id);
+
+            ret[pkmn::e_stat::HP]      = p_pokemon_row->base_stats[0];
+            ret[pkmn::e_stat::ATTACK]  = p_pokemon_row->base_stats[1];
+            ret[pkmn::e_stat::DEFENSE] = p_pokemon_row->base_stats[2];
+            ret[pkmn::e_stat::SPEED]   = p_pokemon_row->base_stats[5];
+            if(_generation == 1)
+            {
+                ret[pkmn::e_stat::SPECIAL] = p_pokemon_row->gen1_special;
+            }
+            else
+            {
+                ret[pkmn::e_stat::SPECIAL_ATTACK]  = p_pokemon_row->base_stats[3];
+                ret[pkmn::e_stat::SPECIAL_DEFENSE] = p_pokemon_row->base_stats[4];
+            }
+        }
         else
         {
             static BOOST_CONSTEXPR const char* old_query = \
@@ -767,22 +818,21 @@ namespace pkmn { namespace database {
                 "SELECT base_stat FROM pokemon_stats WHERE pokemon_id=? AND "
                 "stat_id IN (1,2,3,4,5,6)";
 
-            SQLite::Statement stmt(
-                get_connection(),
+            cached_statement stmt(
                 ((_generation == 1) ? old_query : main_query)
             );
-            stmt.bind(1, _pokemon_id);
+            stmt->bind(1, _pokemon_id);
 
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::HP);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::ATTACK);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::DEFENSE);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::HP);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::ATTACK);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::DEFENSE);
             if(_generation == 1) {
-                execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPEED);
-                execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPECIAL);
+                execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPEED);
+                execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPECIAL);
             } else {
-                execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPECIAL_ATTACK);
-                execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPECIAL_DEFENSE);
-                execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPEED);
+                execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPECIAL_ATTACK);
+                execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPECIAL_DEFENSE);
+                execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPEED);
             }
         }
 
@@ -811,21 +861,32 @@ namespace pkmn { namespace database {
             ret.erase(pkmn::e_stat::SPECIAL_ATTACK);
             ret.erase(pkmn::e_stat::SPECIAL_DEFENSE);
         }
+        else if(_can_use_pokemon_row(lookup_pokemon(_pokemon_id), _generation))
+        {
+            const pokemon_row* p_pokemon_row = lookup_pokemon(_pokemon_id);
+
+            ret[pkmn::e_stat::HP]              = p_pokemon_row->EV_yields[0];
+            ret[pkmn::e_stat::ATTACK]          = p_pokemon_row->EV_yields[1];
+            ret[pkmn::e_stat::DEFENSE]         = p_pokemon_row->EV_yields[2];
+            ret[pkmn::e_stat::SPECIAL_ATTACK]  = p_pokemon_row->EV_yields[3];
+            ret[pkmn::e_stat::SPECIAL_DEFENSE] = p_pokemon_row->EV_yields[4];
+            ret[pkmn::e_stat::SPEED]           = p_pokemon_row->EV_yields[5];
+        }
         else
         {
             static BOOST_CONSTEXPR const char* query = \
                 "SELECT effort FROM pokemon_stats WHERE pokemon_id=? AND "
                 "stat_id IN (1,2,3,4,5,6)";
 
-            SQLite::Statement stmt(get_connection(), query);
-            stmt.bind(1, _pokemon_id);
+            cached_statement stmt(query);
+            stmt->bind(1, _pokemon_id);
 
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::HP);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::ATTACK);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::DEFENSE);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPECIAL_ATTACK);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPECIAL_DEFENSE);
-            execute_stat_stmt_and_get(stmt, ret, pkmn::e_stat::SPEED);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::HP);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::ATTACK);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::DEFENSE);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPECIAL_ATTACK);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPECIAL_DEFENSE);
+            execute_stat_stmt_and_get(*stmt, ret, pkmn::e_stat::SPEED);
         }
 
         return ret;
@@ -876,6 +937,16 @@ namespace pkmn { namespace database {
         return ret;
     }
 
+    // Returns 0 if the species isn't in the lookup table.
+    static int _get_growth_rate_id(
+        int species_id
+    )
+    {
+        const species_row* p_species_row = lookup_species(species_id);
+
+        return p_species_row ? p_species_row->growth_rate_id : 0;
+    }
+
     int pokemon_entry::get_experience_at_level(
         int level
     ) const
@@ -894,6 +965,10 @@ namespace pkmn { namespace database {
         {
             ret = -1;
         }
+        else if(lookup_experience_at_level(_get_growth_rate_id(_species_id), level, &ret))
+        {
+            // Found in the lookup table
+        }
         else
         {
             static BOOST_CONSTEXPR const char* query = \
@@ -927,6 +1002,10 @@ namespace pkmn { namespace database {
         {
             ret = -1;
         }
+        else if(lookup_level_at_experience(_get_growth_rate_id(_species_id), experience, &ret))
+        {
+            // Found in the lookup table
+        }
         else
         {
             static BOOST_CONSTEXPR const char* query = \
@@ -955,14 +1034,14 @@ namespace pkmn { namespace database {
                 "SELECT move_id,level FROM pokemon_moves WHERE pokemon_id=? "
                 "AND version_group_id=? AND pokemon_move_method_id=1 ORDER BY level";
 
-            SQLite::Statement stmt(get_connection(), query);
-            stmt.bind(1, _pokemon_id);
-            stmt.bind(2, _version_group_id);
-            while(stmt.executeStep())
+            cached_statement stmt(query);
+            stmt->bind(1, _pokemon_id);
+            stmt->bind(2, _version_group_id);
+            while(stmt->executeStep())
             {
                 ret.emplace_back(
-                    static_cast<pkmn::e_move>(int(stmt.getColumn(0))),
-                    int(stmt.getColumn(1))
+                    static_cast<pkmn::e_move>(int(stmt->getColumn(0))),
+                    int(stmt->getColumn(1))
                 );
             }
         }
@@ -1019,19 +1098,19 @@ namespace pkmn { namespace database {
                 "pokemon_id=? AND version_group_id=?";
 
             int species_id = _species_id;
-            SQLite::Statement stmt(get_connection(), evolution_query.c_str());
-            stmt.bind(1, species_id);
-            while(stmt.executeStep())
+            cached_statement stmt(evolution_query.c_str());
+            stmt->bind(1, species_id);
+            while(stmt->executeStep())
             {
                 // The final query will be valid but return 0, which we can't use
-                if(int(stmt.getColumn(0)) == 0)
+                if(int(stmt->getColumn(0)) == 0)
                 {
                     break;
                 }
-                species_id = stmt.getColumn(0);
-                stmt.reset();
-                stmt.clearBindings();
-                stmt.bind(1, species_id);
+                species_id = stmt->getColumn(0);
+                stmt->reset();
+                stmt->clearBindings();
+                stmt->bind(1, species_id);
             }
 
             // Gamecube results match Ruby/Sapphire, so use that instead
@@ -1131,13 +1210,13 @@ namespace pkmn { namespace database {
                 "SELECT id FROM pokemon_species WHERE evolves_from_species_id=? "
                 "AND generation_id<=?";
 
-            SQLite::Statement stmt(get_connection(), query);
-            stmt.bind(1, _species_id);
-            stmt.bind(2, _generation);
-            while(stmt.executeStep())
+            cached_statement stmt(query);
+            stmt->bind(1, _species_id);
+            stmt->bind(2, _generation);
+            while(stmt->executeStep())
             {
                 ret.emplace_back(
-                    static_cast<pkmn::e_species>(int(stmt.getColumn(0)))
+                    static_cast<pkmn::e_species>(int(stmt->getColumn(0)))
                 );
             }
         }
@@ -1188,15 +1267,15 @@ namespace pkmn { namespace database {
                             "(SELECT form_id FROM libpkmn_pokemon_form_names WHERE name=?) "
                             "AND pokemon_id IN (SELECT id FROM pokemon WHERE species_id=?)";
 
-                        SQLite::Statement stmt(get_connection(), query);
-                        stmt.bind(1, form_name);
-                        stmt.bind(2, _species_id);
-                        stmt.executeStep();
+                        cached_statement stmt(query);
+                        stmt->bind(1, form_name);
+                        stmt->bind(2, _species_id);
+                        stmt->executeStep();
                         /*
                          * Now that we have the form ID, check some of the hardcoded cases
                          * before assigning the proper IDs.
                          */
-                        int form_id = stmt.getColumn(0);
+                        int form_id = stmt->getColumn(0);
 
                         if(_generation == 3 and _species_id == DEOXYS_ID) {
                             switch(_game_id) {
@@ -1246,8 +1325,8 @@ namespace pkmn { namespace database {
                             );
                         }
 
-                        _form_id    = stmt.getColumn(0);
-                        _pokemon_id = stmt.getColumn(1);
+                        _form_id    = stmt->getColumn(0);
+                        _pokemon_id = stmt->getColumn(1);
                     }
                 }
             }
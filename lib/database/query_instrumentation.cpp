@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "query_instrumentation.hpp"
+
+#include <boost/config.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace pkmn { namespace database {
+
+    /*
+     * Durations are counted in logarithmic buckets, four per power of two, so
+     * recording a query takes constant time and memory no matter how many
+     * times it's made. Each bucket is about 19% wider than the last.
+     */
+    BOOST_STATIC_CONSTEXPR size_t NUM_BUCKETS_PER_POWER_OF_TWO = 4;
+    BOOST_STATIC_CONSTEXPR size_t NUM_BUCKETS = 64 * NUM_BUCKETS_PER_POWER_OF_TWO;
+
+    struct query_histogram
+    {
+        uint64_t num_queries;
+        uint64_t total_duration_ns;
+        uint64_t max_duration_ns;
+        std::array<uint64_t, NUM_BUCKETS> bucket_counts;
+    };
+
+    // Keyed by SQL text, then entry point.
+    typedef std::map<std::pair<std::string, std::string>, query_histogram> query_histogram_map_t;
+
+    struct thread_query_state
+    {
+        const char* entry_point;
+        bool is_in_callback;
+    };
+
+    static std::atomic_bool _is_enabled(false);
+
+    static query_histogram_map_t _query_histograms;
+    static boost::mutex _query_histograms_mutex;
+
+    // The callback is swapped out as a whole so it can be called without
+    // holding the lock.
+    static std::shared_ptr<query_callback_t> _callback_sptr;
+    static boost::mutex _callback_mutex;
+
+    static boost::thread_specific_ptr<thread_query_state> _thread_query_state;
+
+    static thread_query_state& _get_thread_query_state()
+    {
+        thread_query_state* p_state = _thread_query_state.get();
+        if(!p_state)
+        {
+            p_state = new thread_query_state{nullptr, false};
+            _thread_query_state.reset(p_state);
+        }
+
+        return *p_state;
+    }
+
+    static size_t _duration_to_bucket(
+        uint64_t duration_ns
+    )
+    {
+        size_t bucket = 0;
+        if(duration_ns > 1)
+        {
+            bucket = size_t(
+                         std::log2(double(duration_ns))
+                       * double(NUM_BUCKETS_PER_POWER_OF_TWO)
+                     );
+        }
+
+        return std::min(bucket, NUM_BUCKETS - 1);
+    }
+
+    // Report the upper bound of a bucket, so percentiles are never
+    // underestimated.
+    static uint64_t _bucket_to_duration(
+        size_t bucket
+    )
+    {
+        return uint64_t(
+                   std::exp2(
+                       double(bucket + 1) / double(NUM_BUCKETS_PER_POWER_OF_TWO)
+                   )
+               );
+    }
+
+    static uint64_t _get_percentile(
+        const query_histogram& histogram,
+        double percentile
+    )
+    {
+        const uint64_t num_queries_at_percentile = std::max<uint64_t>(
+            1ULL,
+            uint64_t(std::ceil(double(histogram.num_queries) * percentile))
+        );
+
+        uint64_t num_queries_so_far = 0;
+        for(size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket)
+        {
+            num_queries_so_far += histogram.bucket_counts[bucket];
+            if(num_queries_so_far >= num_queries_at_percentile)
+            {
+                return std::min(
+                           _bucket_to_duration(bucket),
+                           histogram.max_duration_ns
+                       );
+            }
+        }
+
+        return histogram.max_duration_ns;
+    }
+
+    void set_query_instrumentation_enabled(
+        bool enabled
+    )
+    {
+        _is_enabled = enabled;
+    }
+
+    bool is_query_instrumentation_enabled()
+    {
+        return _is_enabled.load(std::memory_order_relaxed);
+    }
+
+    std::vector<query_stats> get_query_stats()
+    {
+        std::vector<query_stats> ret;
+
+        {
+            boost::lock_guard<boost::mutex> lock(_query_histograms_mutex);
+
+            ret.reserve(_query_histograms.size());
+            for(const auto& histogram_pair: _query_histograms)
+            {
+                const query_histogram& histogram = histogram_pair.second;
+
+                query_stats stats;
+                stats.query = histogram_pair.first.first;
+                stats.entry_point = histogram_pair.first.second;
+                stats.num_queries = histogram.num_queries;
+                stats.total_duration_ns = histogram.total_duration_ns;
+                stats.median_duration_ns = _get_percentile(histogram, 0.5);
+                stats.p90_duration_ns = _get_percentile(histogram, 0.9);
+                stats.p99_duration_ns = _get_percentile(histogram, 0.99);
+                stats.max_duration_ns = histogram.max_duration_ns;
+
+                ret.emplace_back(std::move(stats));
+            }
+        }
+
+        std::stable_sort(
+            ret.begin(),
+            ret.end(),
+            [](const query_stats& lhs, const query_stats& rhs)
+            {
+                return (lhs.total_duration_ns > rhs.total_duration_ns);
+            }
+        );
+
+        return ret;
+    }
+
+    void reset_query_stats()
+    {
+        boost::lock_guard<boost::mutex> lock(_query_histograms_mutex);
+
+        _query_histograms.clear();
+    }
+
+    void set_query_callback(
+        const query_callback_t& callback
+    )
+    {
+        std::shared_ptr<query_callback_t> callback_sptr;
+        if(callback)
+        {
+            callback_sptr = std::make_shared<query_callback_t>(callback);
+        }
+
+        boost::lock_guard<boost::mutex> lock(_callback_mutex);
+        _callback_sptr.swap(callback_sptr);
+    }
+
+    query_entry_point::query_entry_point(
+        const char* name
+    ): _is_outermost(false)
+    {
+        if(is_query_instrumentation_enabled())
+        {
+            thread_query_state& r_state = _get_thread_query_state();
+            if(!r_state.entry_point)
+            {
+                r_state.entry_point = name;
+                _is_outermost = true;
+            }
+        }
+    }
+
+    query_entry_point::~query_entry_point()
+    {
+        if(_is_outermost)
+        {
+            _get_thread_query_state().entry_point = nullptr;
+        }
+    }
+
+    void record_query(
+        const char* query,
+        uint64_t duration_ns
+    )
+    {
+        thread_query_state& r_state = _get_thread_query_state();
+        if(r_state.is_in_callback)
+        {
+            return;
+        }
+
+        const std::string entry_point = r_state.entry_point ? r_state.entry_point : "";
+
+        {
+            boost::lock_guard<boost::mutex> lock(_query_histograms_mutex);
+
+            // operator[] value-initializes new histograms, zeroing them.
+            query_histogram& r_histogram = _query_histograms[
+                                               std::make_pair(std::string(query), entry_point)
+                                           ];
+            ++r_histogram.num_queries;
+            r_histogram.total_duration_ns += duration_ns;
+            r_histogram.max_duration_ns = std::max(r_histogram.max_duration_ns, duration_ns);
+            ++r_histogram.bucket_counts[_duration_to_bucket(duration_ns)];
+        }
+
+        std::shared_ptr<query_callback_t> callback_sptr;
+        {
+            boost::lock_guard<boost::mutex> lock(_callback_mutex);
+            callback_sptr = _callback_sptr;
+        }
+
+        if(callback_sptr)
+        {
+            query_event event = {query, entry_point, duration_ns};
+
+            // Don't record anything the callback itself looks up.
+            r_state.is_in_callback = true;
+            try
+            {
+                (*callback_sptr)(event);
+            }
+            catch(...)
+            {
+            }
+            r_state.is_in_callback = false;
+        }
+    }
+
+}}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef INCLUDED_PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP
+#define INCLUDED_PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP
+
+#include <pkmn/database/query_instrumentation.hpp>
+
+#include <cstdint>
+
+namespace pkmn { namespace database {
+
+    /*
+     * Marks the public API call that the queries in its scope are attributed
+     * to. Scopes nest, but only the outermost one counts, so a query made while
+     * constructing a pokemon_entry inside pokemon::make is attributed to
+     * pokemon::make.
+     *
+     * This does nothing if instrumentation is disabled when it's constructed.
+     */
+    class query_entry_point
+    {
+        public:
+            explicit query_entry_point(
+                const char* name
+            );
+
+            ~query_entry_point();
+
+        private:
+            bool _is_outermost;
+
+            query_entry_point(const query_entry_point&) = delete;
+            query_entry_point& operator=(const query_entry_point&) = delete;
+    };
+
+    // Called by cached_statement once it's done with a statement.
+    void record_query(
+        const char* query,
+        uint64_t duration_ns
+    );
+
+}}
+
+#endif /* INCLUDED_PKMN_DATABASE_QUERY_INSTRUMENTATION_HPP */
@@ -13,6 +13,10 @@
 #include "pokemon_party_gbaimpl.hpp"
 #include "pokemon_pc_gbaimpl.hpp"
 
+#include "database/enum_conversions.hpp"
+
+#include "io/read_write.hpp"
+
 #include "pksav/enum_maps.hpp"
 #include "pksav/pksav_call.hpp"
 
@@ -22,6 +26,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/thread/lock_guard.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -39,26 +44,18 @@ namespace pkmn {
     BOOST_STATIC_CONSTEXPR int EMERALD_PC_ID = 26;
     BOOST_STATIC_CONSTEXPR int FRLG_PC_ID    = 32;
 
-    game_save_gbaimpl::game_save_gbaimpl(
-        const std::string& filepath,
-        std::vector<uint8_t>&& raw
-    ): game_save_impl(filepath, std::move(raw))
+    static int _get_game_id(
+        enum pksav_gba_save_type save_type,
+        const std::string& filepath
+    )
     {
-        PKSAV_CALL(
-            pksav_gba_load_save_from_buffer(
-                _raw.data(),
-                _raw.size(),
-                &_pksav_save
-            );
-        )
-
-        int item_pc_id = 0;
+        int ret = 0;
 
         std::string filename = boost::algorithm::to_lower_copy(
                                    fs::path(filepath).stem().string()
                                );
         boost::erase_all(filename, " ");
-        switch(_pksav_save.save_type)
+        switch(save_type)
         {
             case PKSAV_GBA_SAVE_TYPE_RS:
                 /*
@@ -69,19 +66,18 @@ namespace pkmn {
                  */
                 if(filename.find("ruby") != std::string::npos)
                 {
-                    _game_id = RUBY_GAME_ID;
+                    ret = RUBY_GAME_ID;
                 }
                 else if(filename.find("sapphire") != std::string::npos)
                 {
-                    _game_id = SAPPHIRE_GAME_ID;
+                    ret = SAPPHIRE_GAME_ID;
                 }
                 else
                 {
                     // Default to Ruby, doesn't practically matter within a version group
-                    _game_id = RUBY_GAME_ID;
+                    ret = RUBY_GAME_ID;
                 }
 
-                item_pc_id = RS_PC_ID;
                 break;
 
             case PKSAV_GBA_SAVE_TYPE_FRLG:
@@ -95,24 +91,57 @@ namespace pkmn {
                    filename.find("fr") != std::string::npos
                 )
                 {
-                    _game_id = FIRERED_GAME_ID;
+                    ret = FIRERED_GAME_ID;
                 }
                 else if(filename.find("leafgreen") != std::string::npos or
                         filename.find("lg") != std::string::npos)
                 {
-                    _game_id = LEAFGREEN_GAME_ID;
+                    ret = LEAFGREEN_GAME_ID;
                 }
                 else
                 {
                     // Default to FireRed, doesn't practically matter within a version group
-                    _game_id = FIRERED_GAME_ID;
+                    ret = FIRERED_GAME_ID;
                 }
 
+                break;
+
+            default: // Emerald
+                ret = EMERALD_GAME_ID;
+                break;
+        }
+
+        return ret;
+    }
+
+    game_save_gbaimpl::game_save_gbaimpl(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    ): game_save_impl(filepath)
+    {
+        PKSAV_CALL(
+            pksav_gba_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &_pksav_save
+            );
+        )
+
+        _game_id = _get_game_id(_pksav_save.save_type, filepath);
+
+        int item_pc_id = 0;
+        switch(_pksav_save.save_type)
+        {
+            case PKSAV_GBA_SAVE_TYPE_RS:
+                item_pc_id = RS_PC_ID;
+                break;
+
+            case PKSAV_GBA_SAVE_TYPE_FRLG:
                 item_pc_id = FRLG_PC_ID;
                 break;
 
             default: // Emerald
-                _game_id = EMERALD_GAME_ID;
                 item_pc_id = EMERALD_PC_ID;
                 break;
         }
@@ -170,6 +199,7 @@ namespace pkmn {
 
         p_party_impl->set_pokedex(_pokedex);
         p_pc_impl->set_pokedex(_pokedex);
+        p_pc_impl->set_arena(_pokemon_arena);
 
         _register_attributes();
     }
@@ -179,30 +209,142 @@ namespace pkmn {
         pksav_gba_free_save(&_pksav_save);
     }
 
+    pkmn::game_save_summary game_save_gbaimpl::summarize(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    )
+    {
+        struct pksav_gba_save pksav_save;
+        PKSAV_CALL(
+            pksav_gba_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &pksav_save
+            );
+        )
+
+        pkmn::game_save_summary ret;
+
+        try
+        {
+            int game_id = _get_game_id(pksav_save.save_type, filepath);
+            ret.game = pkmn::database::game_id_to_enum(game_id);
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_name != nullptr);
+            char trainer_name[PKSAV_GBA_TRAINER_NAME_LENGTH + 1] = {0};
+            PKSAV_CALL(
+                pksav_gba_import_text(
+                    pksav_save.trainer_info.p_name,
+                    trainer_name,
+                    PKSAV_GBA_TRAINER_NAME_LENGTH
+                );
+            )
+            ret.trainer_name = trainer_name;
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_id != nullptr);
+            ret.trainer_id = pksav_littleendian32(pksav_save.trainer_info.p_id->id);
+
+            BOOST_ASSERT(pksav_save.p_time_played != nullptr);
+            ret.time_played = pkmn::time_duration(
+                                  pksav_littleendian16(pksav_save.p_time_played->hours),
+                                  pksav_save.p_time_played->minutes,
+                                  pksav_save.p_time_played->seconds,
+                                  pksav_save.p_time_played->frames
+                              );
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_money != nullptr);
+            ret.money = int(pksav_littleendian32(*pksav_save.trainer_info.p_money));
+
+            // The count field may not be reliable, so stop at the first
+            // empty slot.
+            const struct pksav_gba_pokemon_party* p_party =
+                pksav_save.pokemon_storage.p_party;
+            BOOST_ASSERT(p_party != nullptr);
+            size_t num_party_pokemon = std::min<size_t>(
+                                           pksav_littleendian32(p_party->count),
+                                           sizeof(p_party->party)/sizeof(p_party->party[0])
+                                       );
+            for(size_t party_index = 0;
+                (party_index < num_party_pokemon) &&
+                (pksav_littleendian16(p_party->party[party_index].pc_data.blocks.growth.species) > 0);
+                ++party_index)
+            {
+                _add_party_pokemon_to_summary(
+                    pksav_littleendian16(p_party->party[party_index].pc_data.blocks.growth.species),
+                    p_party->party[party_index].party_data.level,
+                    game_id,
+                    ret
+                );
+            }
+
+            // The three seen lists should match.
+            BOOST_ASSERT(pksav_save.pokedex.p_seenA != nullptr);
+            BOOST_ASSERT(pksav_save.pokedex.p_owned != nullptr);
+            ret.num_pokedex_seen = _count_pokedex_entries(
+                                       pksav_save.pokedex.p_seenA,
+                                       3
+                                   );
+            ret.num_pokedex_caught = _count_pokedex_entries(
+                                         pksav_save.pokedex.p_owned,
+                                         3
+                                     );
+        }
+        catch(...)
+        {
+            pksav_gba_free_save(&pksav_save);
+            throw;
+        }
+
+        pksav_gba_free_save(&pksav_save);
+
+        return ret;
+    }
+
     void game_save_gbaimpl::save_as(
         const std::string& filepath
     )
     {
         boost::lock_guard<game_save_gbaimpl> lock(*this);
 
-        // These get_native() calls will call the mutex for every subclass
-        // it copies, so we don't need to worry about that here.
-        pkmn::rcast_equal<union pksav_gba_item_bag>(
-            _item_bag->get_native(),
-            _pksav_save.item_storage.p_bag
-        );
-        pkmn::rcast_equal<struct pksav_gba_item_pc>(
-            _item_pc->get_native(),
-            _pksav_save.item_storage.p_pc
-        );
-        pkmn::rcast_equal<struct pksav_gba_pokemon_party>(
-            _pokemon_party->get_native(),
-            _pksav_save.pokemon_storage.p_party
-        );
-        pkmn::rcast_equal<struct pksav_gba_pokemon_pc>(
-            _pokemon_pc->get_native(),
-            _pksav_save.pokemon_storage.p_pc
-        );
+        // Only what has changed since the last save is copied. These calls
+        // lock every subclass they copy, so we don't need to worry about
+        // that here.
+        void* p_item_bag_native = _get_item_bag_native_if_dirty();
+        if(p_item_bag_native != nullptr)
+        {
+            pkmn::rcast_equal<union pksav_gba_item_bag>(
+                p_item_bag_native,
+                _pksav_save.item_storage.p_bag
+            );
+        }
+
+        void* p_item_pc_native = _get_item_pc_native_if_dirty();
+        if(p_item_pc_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gba_item_pc>(
+                p_item_pc_native,
+                _pksav_save.item_storage.p_pc
+            );
+        }
+
+        void* p_party_native = _get_pokemon_party_native_if_dirty();
+        if(p_party_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gba_pokemon_party>(
+                p_party_native,
+                _pksav_save.pokemon_storage.p_party
+            );
+        }
+
+        void* p_pc_native = _get_pokemon_pc_native_if_dirty();
+        if(p_pc_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gba_pokemon_pc>(
+                p_pc_native,
+                _pksav_save.pokemon_storage.p_pc
+            );
+        }
 
         // TODO: put this in PKSav header
         static const size_t num_pokedex_bytes = ((386 / 8) + 1);
@@ -232,12 +374,18 @@ namespace pkmn {
             num_pokedex_bytes
         );
 
-        PKSAV_CALL(
-            pksav_gba_save_save(
-                filepath.c_str(),
-                &_pksav_save
-            );
-        )
+        pkmn::io::write_file_atomically(
+            filepath,
+            [this](const std::string& temp_filepath)
+            {
+                PKSAV_CALL(
+                    pksav_gba_save_save(
+                        temp_filepath.c_str(),
+                        &_pksav_save
+                    );
+                )
+            }
+        );
 
         _filepath = fs::absolute(filepath).string();
     }
@@ -859,51 +1007,71 @@ namespace pkmn {
 
     void game_save_gbaimpl::_register_attributes()
     {
-        using std::placeholders::_1;
+        static const pkmn::attribute_registry<int> NUMERIC_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<int> registry;
+            registry.register_attribute_fcns(
+                "Casino coins",
+                &game_save_gbaimpl::get_casino_coins,
+                &game_save_gbaimpl::set_casino_coins
+            );
+            registry.register_attribute_fcns(
+                "Textbox frame",
+                &game_save_gbaimpl::get_textbox_frame_index,
+                &game_save_gbaimpl::set_textbox_frame_index
+            );
 
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Casino coins",
-            std::bind(&game_save_gbaimpl::get_casino_coins, this),
-            std::bind(&game_save_gbaimpl::set_casino_coins, this, _1)
-        );
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Textbox frame",
-            std::bind(&game_save_gbaimpl::get_textbox_frame_index, this),
-            std::bind(&game_save_gbaimpl::set_textbox_frame_index, this, _1)
-        );
+            return registry;
+        }();
 
-        _string_attribute_engine.register_attribute_fcns(
-            "Button mode",
-            std::bind(&game_save_gbaimpl::get_button_mode, this),
-            std::bind(&game_save_gbaimpl::set_button_mode, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Text speed",
-            std::bind(&game_save_gbaimpl::get_text_speed, this),
-            std::bind(&game_save_gbaimpl::set_text_speed, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Sound output",
-            std::bind(&game_save_gbaimpl::get_sound_output, this),
-            std::bind(&game_save_gbaimpl::set_sound_output, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Battle style",
-            std::bind(&game_save_gbaimpl::get_battle_style, this),
-            std::bind(&game_save_gbaimpl::set_battle_style, this, _1)
-        );
+        static const pkmn::attribute_registry<std::string> STRING_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<std::string> registry;
+            registry.register_attribute_fcns(
+                "Button mode",
+                &game_save_gbaimpl::get_button_mode,
+                &game_save_gbaimpl::set_button_mode
+            );
+            registry.register_attribute_fcns(
+                "Text speed",
+                &game_save_gbaimpl::get_text_speed,
+                &game_save_gbaimpl::set_text_speed
+            );
+            registry.register_attribute_fcns(
+                "Sound output",
+                &game_save_gbaimpl::get_sound_output,
+                &game_save_gbaimpl::set_sound_output
+            );
+            registry.register_attribute_fcns(
+                "Battle style",
+                &game_save_gbaimpl::get_battle_style,
+                &game_save_gbaimpl::set_battle_style
+            );
 
-        // Don't use the whole word "Pokédex" to make life easier for
-        // Python users.
-        _boolean_attribute_engine.register_attribute_fcns(
-            "National Dex unlocked?",
-            std::bind(&game_save_gbaimpl::get_is_national_dex_unlocked, this),
-            std::bind(&game_save_gbaimpl::set_is_national_dex_unlocked, this, _1)
-        );
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Enable battle scene?",
-            std::bind(&game_save_gbaimpl::get_is_battle_scene_enabled, this),
-            std::bind(&game_save_gbaimpl::set_is_battle_scene_enabled, this, _1)
-        );
+            return registry;
+        }();
+
+        static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<bool> registry;
+            // Don't use the whole word "Pokédex" to make life easier for
+            // Python users.
+            registry.register_attribute_fcns(
+                "National Dex unlocked?",
+                &game_save_gbaimpl::get_is_national_dex_unlocked,
+                &game_save_gbaimpl::set_is_national_dex_unlocked
+            );
+            registry.register_attribute_fcns(
+                "Enable battle scene?",
+                &game_save_gbaimpl::get_is_battle_scene_enabled,
+                &game_save_gbaimpl::set_is_battle_scene_enabled
+            );
+
+            return registry;
+        }();
+
+        _p_numeric_attribute_registry = &NUMERIC_ATTRIBUTE_REGISTRY;
+        _p_string_attribute_registry = &STRING_ATTRIBUTE_REGISTRY;
+        _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
     }
 }
@@ -18,12 +18,19 @@ namespace pkmn {
         public:
             game_save_gbaimpl() {};
             game_save_gbaimpl(
-                const std::string &filepath,
-                std::vector<uint8_t>&& raw
+                const std::string& filepath,
+                const uint8_t* p_raw,
+                size_t raw_size
             );
 
             ~game_save_gbaimpl();
 
+            static pkmn::game_save_summary summarize(
+                const std::string& filepath,
+                const uint8_t* p_raw,
+                size_t raw_size
+            );
+
             void save_as(
                 const std::string& filepath
             ) final;
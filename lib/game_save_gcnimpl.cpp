@@ -13,6 +13,8 @@
 #include "pokemon_party_gcnimpl.hpp"
 #include "pokemon_pc_gcnimpl.hpp"
 
+#include "database/enum_conversions.hpp"
+
 #include "io/read_write.hpp"
 
 #include "utils/misc.hpp"
@@ -40,8 +42,10 @@ namespace pkmn {
 
     game_save_gcnimpl::game_save_gcnimpl(
         const std::string& filepath,
-        std::vector<uint8_t>&& raw
-    ): game_save_impl(filepath, std::move(raw))
+        const uint8_t* p_raw,
+        size_t raw_size
+    ): game_save_impl(filepath),
+       _raw(p_raw, p_raw + raw_size)
     {
         size_t save_size = _raw.size();
 
@@ -85,6 +89,10 @@ namespace pkmn {
                           _current_slot->PC->boxes
                       );
 
+        pokemon_pc_impl* p_pc_impl = dynamic_cast<pokemon_pc_impl*>(_pokemon_pc.get());
+        BOOST_ASSERT(p_pc_impl != nullptr);
+        p_pc_impl->set_arena(_pokemon_arena);
+
         _item_bag = std::make_shared<item_bag_gcnimpl>(
                         _game_id,
                         _current_slot->player->bag
@@ -95,54 +103,145 @@ namespace pkmn {
                    );
     }
 
+    pkmn::game_save_summary game_save_gcnimpl::summarize(
+        const uint8_t* p_raw,
+        size_t raw_size
+    )
+    {
+        size_t save_size = raw_size;
+
+        int game_id = 0;
+        std::unique_ptr<LibPkmGC::GC::SaveEditing::Save> libpkmgc_save_uptr;
+        if(save_size == GCN_COLOSSEUM_BIN_SIZE or save_size == GCN_COLOSSEUM_GCI_SIZE)
+        {
+            game_id = COLOSSEUM_ID;
+            libpkmgc_save_uptr.reset(
+                new LibPkmGC::Colosseum::SaveEditing::Save(
+                        p_raw,
+                        (save_size == GCN_COLOSSEUM_GCI_SIZE)
+                    )
+            );
+        }
+        else if(save_size == GCN_XD_BIN_SIZE or save_size == GCN_XD_GCI_SIZE)
+        {
+            game_id = XD_ID;
+            libpkmgc_save_uptr.reset(
+                new LibPkmGC::XD::SaveEditing::Save(
+                        p_raw,
+                        (save_size == GCN_XD_GCI_SIZE)
+                    )
+            );
+        }
+        else
+        {
+            throw std::invalid_argument("Not a valid Gamecube save.");
+        }
+
+        size_t index = 0;
+        const LibPkmGC::GC::SaveEditing::SaveSlot* p_current_slot =
+            libpkmgc_save_uptr->getMostRecentValidSlot(0, &index);
+        if(!p_current_slot)
+        {
+            throw std::invalid_argument("Could not find a save slot.");
+        }
+
+        // The time played and Pokédex aren't implemented for these games,
+        // so they're left at their defaults.
+        pkmn::game_save_summary ret;
+        ret.game = pkmn::database::game_id_to_enum(game_id);
+        ret.trainer_name = p_current_slot->player->trainer->trainerName->toUTF8();
+        ret.trainer_id = p_current_slot->player->trainer->TID |
+                         (uint32_t(p_current_slot->player->trainer->SID) << 16);
+        ret.money = int(p_current_slot->player->pokeDollars);
+
+        for(int party_index = 0;
+            (party_index < PARTY_SIZE) &&
+            (p_current_slot->player->trainer->party[party_index]->species > LibPkmGC::NoSpecies);
+            ++party_index)
+        {
+            const LibPkmGC::GC::Pokemon* p_libpkmgc_pokemon =
+                p_current_slot->player->trainer->party[party_index];
+
+            _add_party_pokemon_to_summary(
+                int(p_libpkmgc_pokemon->species),
+                int(p_libpkmgc_pokemon->partyData.level),
+                game_id,
+                ret
+            );
+        }
+
+        return ret;
+    }
+
     void game_save_gcnimpl::save_as(
         const std::string& filepath
     )
     {
         boost::lock_guard<game_save_gcnimpl> lock(*this);
 
+        // Only what has changed since the last save is copied.
         const std::unique_ptr<LibPkmGC::GC::Pokemon>* p_libpkmgc_party_uptrs =
             static_cast<const std::unique_ptr<LibPkmGC::GC::Pokemon>*>(
-                _pokemon_party->get_native()
+                _get_pokemon_party_native_if_dirty()
             );
-        for(int party_index = 0; party_index < PARTY_SIZE; ++party_index)
+        if(p_libpkmgc_party_uptrs != nullptr)
         {
-            pkmn::rcast_equal<LibPkmGC::GC::Pokemon>(
-                p_libpkmgc_party_uptrs[party_index].get(),
-                _current_slot->player->trainer->party[party_index]
-            );
+            for(int party_index = 0; party_index < PARTY_SIZE; ++party_index)
+            {
+                pkmn::rcast_equal<LibPkmGC::GC::Pokemon>(
+                    p_libpkmgc_party_uptrs[party_index].get(),
+                    _current_slot->player->trainer->party[party_index]
+                );
+            }
         }
 
-        std::memcpy(
-            _current_slot->PC->items,
-            _item_pc->get_native(),
-            sizeof(_current_slot->PC->items)
-        );
+        void* p_item_pc_native = _get_item_pc_native_if_dirty();
+        if(p_item_pc_native != nullptr)
+        {
+            std::memcpy(
+                _current_slot->PC->items,
+                p_item_pc_native,
+                sizeof(_current_slot->PC->items)
+            );
+        }
 
+        void* p_item_bag_native = _get_item_bag_native_if_dirty();
         if(_game_id == COLOSSEUM_ID)
         {
             save_native_pokemon_boxes<LibPkmGC::Colosseum::PokemonBox>();
 
-            pkmn::rcast_equal<LibPkmGC::Colosseum::BagData>(
-                _item_bag->get_native(),
-                _current_slot->player->bag
-            );
+            if(p_item_bag_native != nullptr)
+            {
+                pkmn::rcast_equal<LibPkmGC::Colosseum::BagData>(
+                    p_item_bag_native,
+                    _current_slot->player->bag
+                );
+            }
         }
         else
         {
             save_native_pokemon_boxes<LibPkmGC::XD::PokemonBox>();
 
-            pkmn::rcast_equal<LibPkmGC::XD::BagData>(
-                _item_bag->get_native(),
-                _current_slot->player->bag
-            );
+            if(p_item_bag_native != nullptr)
+            {
+                pkmn::rcast_equal<LibPkmGC::XD::BagData>(
+                    p_item_bag_native,
+                    _current_slot->player->bag
+                );
+            }
         }
 
         _libpkmgc_save_uptr->saveEncrypted(_raw.data(), _has_gci_data);
 
-        pkmn::io::write_file(
+        pkmn::io::write_file_atomically(
             filepath,
-            _raw
+            [this](const std::string& temp_filepath)
+            {
+                pkmn::io::write_file(
+                    temp_filepath,
+                    _raw
+                );
+            }
         );
 
         _filepath = fs::absolute(filepath).string();
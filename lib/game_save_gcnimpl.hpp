@@ -20,10 +20,16 @@ namespace pkmn {
         public:
             game_save_gcnimpl(
                 const std::string& filepath,
-                std::vector<uint8_t>&& raw
+                const uint8_t* p_raw,
+                size_t raw_size
             );
             ~game_save_gcnimpl() = default;
 
+            static pkmn::game_save_summary summarize(
+                const uint8_t* p_raw,
+                size_t raw_size
+            );
+
             void save_as(
                 const std::string& filepath
             ) final;
@@ -77,6 +83,9 @@ namespace pkmn {
             ) final;
 
         private:
+            // LibPkmGC re-encrypts the whole save into this buffer when saving.
+            std::vector<uint8_t> _raw;
+
             std::unique_ptr<LibPkmGC::GC::SaveEditing::Save> _libpkmgc_save_uptr;
             LibPkmGC::GC::SaveEditing::SaveSlot* _current_slot;
 
@@ -91,8 +100,13 @@ namespace pkmn {
             {
                 const std::unique_ptr<libpkmgc_box_type>* p_libpkmgc_box_uptrs =
                     static_cast<const std::unique_ptr<libpkmgc_box_type>*>(
-                        _pokemon_pc->get_native()
+                        _get_pokemon_pc_native_if_dirty()
                     );
+                if(p_libpkmgc_box_uptrs == nullptr)
+                {
+                    return;
+                }
+
                 for(size_t box_index = 0;
                     box_index < _current_slot->PC->nbBoxes;
                     ++box_index)
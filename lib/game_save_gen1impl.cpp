@@ -12,6 +12,10 @@
 #include "pokemon_party_gbimpl.hpp"
 #include "pokemon_pc_gen1impl.hpp"
 
+#include "database/enum_conversions.hpp"
+
+#include "io/read_write.hpp"
+
 #include "pksav/enum_maps.hpp"
 #include "pksav/pksav_call.hpp"
 
@@ -26,6 +30,7 @@
 
 #include <boost/thread/lock_guard.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace fs = boost::filesystem;
@@ -39,22 +44,16 @@ namespace pkmn {
     BOOST_STATIC_CONSTEXPR int RB_PC_ID = 2;
     BOOST_STATIC_CONSTEXPR int YELLOW_PC_ID = 4;
 
-    game_save_gen1impl::game_save_gen1impl(
-        const std::string& filepath,
-        std::vector<uint8_t>&& raw
-    ): game_save_impl(filepath, std::move(raw))
+    static int _get_game_id(
+        enum pksav_gen1_save_type save_type,
+        const std::string& filepath
+    )
     {
-        PKSAV_CALL(
-            pksav_gen1_load_save_from_buffer(
-                _raw.data(),
-                _raw.size(),
-                &_pksav_save
-            );
-        )
+        int ret = 0;
 
-        if(_pksav_save.save_type == PKSAV_GEN1_SAVE_TYPE_YELLOW)
+        if(save_type == PKSAV_GEN1_SAVE_TYPE_YELLOW)
         {
-            _game_id = YELLOW_GAME_ID;
+            ret = YELLOW_GAME_ID;
         }
         else
         {
@@ -69,19 +68,38 @@ namespace pkmn {
                                          );
             if(filename_lower.find("red") != std::string::npos)
             {
-                _game_id = RED_GAME_ID;
+                ret = RED_GAME_ID;
             }
             else if(filename_lower.find("blue") != std::string::npos)
             {
-                _game_id = BLUE_GAME_ID;
+                ret = BLUE_GAME_ID;
             }
             else
             {
                 // Default to Red, doesn't practically matter within a version group
-                _game_id = RED_GAME_ID;
+                ret = RED_GAME_ID;
             }
         }
 
+        return ret;
+    }
+
+    game_save_gen1impl::game_save_gen1impl(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    ): game_save_impl(filepath)
+    {
+        PKSAV_CALL(
+            pksav_gen1_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &_pksav_save
+            );
+        )
+
+        _game_id = _get_game_id(_pksav_save.save_type, filepath);
+
         BOOST_ASSERT(_pksav_save.pokedex_lists.p_seen != nullptr);
         BOOST_ASSERT(_pksav_save.pokedex_lists.p_owned != nullptr);
         _pokedex = std::make_shared<pokedex_gen1impl>(
@@ -124,6 +142,7 @@ namespace pkmn {
 
         p_party_impl->set_pokedex(_pokedex);
         p_pc_impl->set_pokedex(_pokedex);
+        p_pc_impl->set_arena(_pokemon_arena);
 
         _register_attributes();
     }
@@ -133,55 +152,178 @@ namespace pkmn {
         pksav_gen1_free_save(&_pksav_save);
     }
 
+    pkmn::game_save_summary game_save_gen1impl::summarize(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    )
+    {
+        struct pksav_gen1_save pksav_save;
+        PKSAV_CALL(
+            pksav_gen1_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &pksav_save
+            );
+        )
+
+        pkmn::game_save_summary ret;
+
+        try
+        {
+            int game_id = _get_game_id(pksav_save.save_type, filepath);
+            ret.game = pkmn::database::game_id_to_enum(game_id);
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_name != nullptr);
+            char trainer_name[PKSAV_GEN1_TRAINER_NAME_LENGTH + 1] = {0};
+            PKSAV_CALL(
+                pksav_gen1_import_text(
+                    pksav_save.trainer_info.p_name,
+                    trainer_name,
+                    PKSAV_GEN1_TRAINER_NAME_LENGTH
+                );
+            )
+            ret.trainer_name = trainer_name;
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_id != nullptr);
+            ret.trainer_id = pksav_bigendian16(*pksav_save.trainer_info.p_id);
+
+            BOOST_ASSERT(pksav_save.p_time_played != nullptr);
+            ret.time_played = pkmn::time_duration(
+                                  pksav_littleendian16(pksav_save.p_time_played->hours),
+                                  pksav_save.p_time_played->minutes,
+                                  pksav_save.p_time_played->seconds,
+                                  0 // frames
+                              );
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_money != nullptr);
+            size_t money_from_pksav = 0;
+            PKSAV_CALL(
+                pksav_import_bcd(
+                    pksav_save.trainer_info.p_money,
+                    PKSAV_GEN1_SAVE_MONEY_BUFFER_SIZE_BYTES,
+                    &money_from_pksav
+                );
+            )
+            ret.money = int(money_from_pksav);
+
+            // The count field may not be reliable, so stop at the first
+            // empty slot.
+            const struct pksav_gen1_pokemon_party* p_party =
+                pksav_save.pokemon_storage.p_party;
+            BOOST_ASSERT(p_party != nullptr);
+            size_t num_party_pokemon = std::min<size_t>(
+                                           p_party->count,
+                                           sizeof(p_party->party)/sizeof(p_party->party[0])
+                                       );
+            for(size_t party_index = 0;
+                (party_index < num_party_pokemon) &&
+                (p_party->party[party_index].pc_data.species > 0);
+                ++party_index)
+            {
+                _add_party_pokemon_to_summary(
+                    p_party->party[party_index].pc_data.species,
+                    p_party->party[party_index].party_data.level,
+                    game_id,
+                    ret
+                );
+            }
+
+            BOOST_ASSERT(pksav_save.pokedex_lists.p_seen != nullptr);
+            BOOST_ASSERT(pksav_save.pokedex_lists.p_owned != nullptr);
+            ret.num_pokedex_seen = _count_pokedex_entries(
+                                       pksav_save.pokedex_lists.p_seen,
+                                       1
+                                   );
+            ret.num_pokedex_caught = _count_pokedex_entries(
+                                         pksav_save.pokedex_lists.p_owned,
+                                         1
+                                     );
+        }
+        catch(...)
+        {
+            pksav_gen1_free_save(&pksav_save);
+            throw;
+        }
+
+        pksav_gen1_free_save(&pksav_save);
+
+        return ret;
+    }
+
     void game_save_gen1impl::save_as(
         const std::string& filepath
     )
     {
         boost::lock_guard<game_save_gen1impl> lock(*this);
 
-        // These get_native() calls will call the mutex for every subclass
-        // it copies, so we don't need to worry about that here.
-        pkmn::rcast_equal<struct pksav_gen1_item_bag>(
-            _item_bag->get_native(),
-            _pksav_save.item_storage.p_item_bag
-        );
-        pkmn::rcast_equal<struct pksav_gen1_item_pc>(
-            _item_pc->get_native(),
-            _pksav_save.item_storage.p_item_pc
-        );
-        pkmn::rcast_equal<struct pksav_gen1_pokemon_party>(
-            _pokemon_party->get_native(),
-            _pksav_save.pokemon_storage.p_party
-        );
+        // Only what has changed since the last save is copied. These calls
+        // lock every subclass they copy, so we don't need to worry about
+        // that here.
+        void* p_item_bag_native = _get_item_bag_native_if_dirty();
+        if(p_item_bag_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen1_item_bag>(
+                p_item_bag_native,
+                _pksav_save.item_storage.p_item_bag
+            );
+        }
+
+        void* p_item_pc_native = _get_item_pc_native_if_dirty();
+        if(p_item_pc_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen1_item_pc>(
+                p_item_pc_native,
+                _pksav_save.item_storage.p_item_pc
+            );
+        }
+
+        void* p_party_native = _get_pokemon_party_native_if_dirty();
+        if(p_party_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen1_pokemon_party>(
+                p_party_native,
+                _pksav_save.pokemon_storage.p_party
+            );
+        }
 
         // The PC is stored in multiple pointers, so this is more manual.
         const struct pksav_gen1_pokemon_storage* p_pokemon_storage =
             static_cast<const struct pksav_gen1_pokemon_storage*>(
-                _pokemon_pc->get_native()
+                _get_pokemon_pc_native_if_dirty()
             );
-        for(size_t box_index = 0;
-            box_index < PKSAV_GEN1_NUM_POKEMON_BOXES;
-            ++box_index)
+        if(p_pokemon_storage != nullptr)
         {
-            *(_pksav_save.pokemon_storage.pp_boxes[box_index]) =
-                *(p_pokemon_storage->pp_boxes[box_index]);
+            for(size_t box_index = 0;
+                box_index < PKSAV_GEN1_NUM_POKEMON_BOXES;
+                ++box_index)
+            {
+                *(_pksav_save.pokemon_storage.pp_boxes[box_index]) =
+                    *(p_pokemon_storage->pp_boxes[box_index]);
+            }
+            *(_pksav_save.pokemon_storage.p_current_box_num) =
+                *(p_pokemon_storage->p_current_box_num);
+            *(_pksav_save.pokemon_storage.p_current_box) =
+                *(p_pokemon_storage->p_current_box);
         }
-        *(_pksav_save.pokemon_storage.p_current_box_num) =
-            *(p_pokemon_storage->p_current_box_num);
-        *(_pksav_save.pokemon_storage.p_current_box) =
-            *(p_pokemon_storage->p_current_box);
 
         save_gb_pokedex(
             &_pksav_save.pokedex_lists,
             PKSAV_GEN1_POKEDEX_BUFFER_SIZE_BYTES
         );
 
-        PKSAV_CALL(
-            pksav_gen1_save_save(
-                filepath.c_str(),
-                &_pksav_save
-            );
-        )
+        pkmn::io::write_file_atomically(
+            filepath,
+            [this](const std::string& temp_filepath)
+            {
+                PKSAV_CALL(
+                    pksav_gen1_save_save(
+                        temp_filepath.c_str(),
+                        &_pksav_save
+                    );
+                )
+            }
+        );
 
         _filepath = fs::absolute(filepath).string();
     }
@@ -685,46 +827,81 @@ namespace pkmn {
 
     void game_save_gen1impl::_register_attributes()
     {
-        using std::placeholders::_1;
+        // Red/Blue and Yellow have different attributes, so each gets its
+        // own registries.
+        static const pkmn::attribute_registry<int> RB_NUMERIC_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<int> registry;
+            registry.register_attribute_fcns(
+                "Casino coins",
+                &game_save_gen1impl::get_casino_coins,
+                &game_save_gen1impl::set_casino_coins
+            );
 
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Casino coins",
-            std::bind(&game_save_gen1impl::get_casino_coins, this),
-            std::bind(&game_save_gen1impl::set_casino_coins, this, _1)
-        );
+            return registry;
+        }();
+        static const pkmn::attribute_registry<int> YELLOW_NUMERIC_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<int> registry = RB_NUMERIC_ATTRIBUTE_REGISTRY;
+            registry.register_attribute_fcns(
+                "Pikachu friendship",
+                &game_save_gen1impl::get_pikachu_friendship,
+                &game_save_gen1impl::set_pikachu_friendship
+            );
 
-        _string_attribute_engine.register_attribute_fcns(
-            "Sound output",
-            std::bind(&game_save_gen1impl::get_sound_output, this),
-            std::bind(&game_save_gen1impl::set_sound_output, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Battle style",
-            std::bind(&game_save_gen1impl::get_battle_style, this),
-            std::bind(&game_save_gen1impl::set_battle_style, this, _1)
-        );
+            return registry;
+        }();
 
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Enable battle effects?",
-            std::bind(&game_save_gen1impl::get_are_battle_effects_enabled, this),
-            std::bind(&game_save_gen1impl::set_are_battle_effects_enabled, this, _1)
-        );
+        static const pkmn::attribute_registry<std::string> YELLOW_STRING_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<std::string> registry;
+            registry.register_attribute_fcns(
+                "Sound output",
+                &game_save_gen1impl::get_sound_output,
+                &game_save_gen1impl::set_sound_output
+            );
+            registry.register_attribute_fcns(
+                "Battle style",
+                &game_save_gen1impl::get_battle_style,
+                &game_save_gen1impl::set_battle_style
+            );
 
-        if(_game_id == YELLOW_GAME_ID)
+            return registry;
+        }();
+        static const pkmn::attribute_registry<std::string> RB_STRING_ATTRIBUTE_REGISTRY = []()
         {
-            _numeric_attribute_engine.register_attribute_fcns(
-                "Pikachu friendship",
-                std::bind(&game_save_gen1impl::get_pikachu_friendship, this),
-                std::bind(&game_save_gen1impl::set_pikachu_friendship, this, _1)
+            pkmn::attribute_registry<std::string> registry = YELLOW_STRING_ATTRIBUTE_REGISTRY;
+            registry.register_attribute_fcns(
+                "Text speed",
+                &game_save_gen1impl::get_text_speed,
+                &game_save_gen1impl::set_text_speed
+            );
+
+            return registry;
+        }();
+
+        static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<bool> registry;
+            registry.register_attribute_fcns(
+                "Enable battle effects?",
+                &game_save_gen1impl::get_are_battle_effects_enabled,
+                &game_save_gen1impl::set_are_battle_effects_enabled
             );
+
+            return registry;
+        }();
+
+        if(_game_id == YELLOW_GAME_ID)
+        {
+            _p_numeric_attribute_registry = &YELLOW_NUMERIC_ATTRIBUTE_REGISTRY;
+            _p_string_attribute_registry = &YELLOW_STRING_ATTRIBUTE_REGISTRY;
         }
         else
         {
-            _string_attribute_engine.register_attribute_fcns(
-                "Text speed",
-                std::bind(&game_save_gen1impl::get_text_speed, this),
-                std::bind(&game_save_gen1impl::set_text_speed, this, _1)
-            );
+            _p_numeric_attribute_registry = &RB_NUMERIC_ATTRIBUTE_REGISTRY;
+            _p_string_attribute_registry = &RB_STRING_ATTRIBUTE_REGISTRY;
         }
+        _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
     }
 }
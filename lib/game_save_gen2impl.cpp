@@ -13,6 +13,10 @@
 #include "pokemon_party_gbimpl.hpp"
 #include "pokemon_pc_gen2impl.hpp"
 
+#include "database/enum_conversions.hpp"
+
+#include "io/read_write.hpp"
+
 #include "pksav/enum_maps.hpp"
 #include "pksav/pksav_call.hpp"
 
@@ -28,6 +32,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/thread/lock_guard.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace fs = boost::filesystem;
@@ -41,29 +46,16 @@ namespace pkmn {
     BOOST_STATIC_CONSTEXPR int GS_PC_ID = 9;
     BOOST_STATIC_CONSTEXPR int CRYSTAL_PC_ID = 14;
 
-    game_save_gen2impl::game_save_gen2impl(
-        const std::string& filepath,
-        std::vector<uint8_t>&& raw
-    ): game_save_impl(filepath, std::move(raw))
+    static int _get_game_id(
+        enum pksav_gen2_save_type save_type,
+        const std::string& filepath
+    )
     {
-        PKSAV_CALL(
-            pksav_gen2_load_save_from_buffer(
-                _raw.data(),
-                _raw.size(),
-                &_pksav_save
-            );
-        )
+        int ret = 0;
 
-        if(_pksav_save.save_type == PKSAV_GEN2_SAVE_TYPE_CRYSTAL)
+        if(save_type == PKSAV_GEN2_SAVE_TYPE_CRYSTAL)
         {
-            _game_id = CRYSTAL_GAME_ID;
-
-            BOOST_ASSERT(_pksav_save.item_storage.p_item_pc != nullptr);
-            _item_pc = std::make_shared<item_list_gen2_pcimpl>(
-                            CRYSTAL_PC_ID,
-                            _game_id,
-                            _pksav_save.item_storage.p_item_pc
-                       );
+            ret = CRYSTAL_GAME_ID;
         }
         else
         {
@@ -78,26 +70,45 @@ namespace pkmn {
                                          );
             if(filename_lower.find("gold") != std::string::npos)
             {
-                _game_id = GOLD_GAME_ID;
+                ret = GOLD_GAME_ID;
             }
             else if(filename_lower.find("silver") != std::string::npos)
             {
-                _game_id = SILVER_GAME_ID;
+                ret = SILVER_GAME_ID;
             }
             else
             {
                 // Default to Gold, doesn't practically matter within a version group
-                _game_id = GOLD_GAME_ID;
+                ret = GOLD_GAME_ID;
             }
-
-            BOOST_ASSERT(_pksav_save.item_storage.p_item_pc != nullptr);
-            _item_pc = std::make_shared<item_list_gen2_pcimpl>(
-                            GS_PC_ID,
-                            _game_id,
-                            _pksav_save.item_storage.p_item_pc
-                       );
         }
 
+        return ret;
+    }
+
+    game_save_gen2impl::game_save_gen2impl(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    ): game_save_impl(filepath)
+    {
+        PKSAV_CALL(
+            pksav_gen2_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &_pksav_save
+            );
+        )
+
+        _game_id = _get_game_id(_pksav_save.save_type, filepath);
+
+        BOOST_ASSERT(_pksav_save.item_storage.p_item_pc != nullptr);
+        _item_pc = std::make_shared<item_list_gen2_pcimpl>(
+                        (_game_id == CRYSTAL_GAME_ID) ? CRYSTAL_PC_ID : GS_PC_ID,
+                        _game_id,
+                        _pksav_save.item_storage.p_item_pc
+                   );
+
         BOOST_ASSERT(_pksav_save.pokedex_lists.p_seen != nullptr);
         BOOST_ASSERT(_pksav_save.pokedex_lists.p_owned != nullptr);
         _pokedex = std::make_shared<pokedex_gen2impl>(
@@ -134,6 +145,7 @@ namespace pkmn {
 
         p_party_impl->set_pokedex(_pokedex);
         p_pc_impl->set_pokedex(_pokedex);
+        p_pc_impl->set_arena(_pokemon_arena);
 
         _register_attributes();
     }
@@ -143,55 +155,178 @@ namespace pkmn {
         pksav_gen2_free_save(&_pksav_save);
     }
 
+    pkmn::game_save_summary game_save_gen2impl::summarize(
+        const std::string& filepath,
+        const uint8_t* p_raw,
+        size_t raw_size
+    )
+    {
+        struct pksav_gen2_save pksav_save;
+        PKSAV_CALL(
+            pksav_gen2_load_save_from_buffer(
+                p_raw,
+                raw_size,
+                &pksav_save
+            );
+        )
+
+        pkmn::game_save_summary ret;
+
+        try
+        {
+            int game_id = _get_game_id(pksav_save.save_type, filepath);
+            ret.game = pkmn::database::game_id_to_enum(game_id);
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_name != nullptr);
+            char trainer_name[PKSAV_GEN2_TRAINER_NAME_LENGTH + 1] = {0};
+            PKSAV_CALL(
+                pksav_gen2_import_text(
+                    pksav_save.trainer_info.p_name,
+                    trainer_name,
+                    PKSAV_GEN2_TRAINER_NAME_LENGTH
+                );
+            )
+            ret.trainer_name = trainer_name;
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_id != nullptr);
+            ret.trainer_id = pksav_bigendian16(*pksav_save.trainer_info.p_id);
+
+            BOOST_ASSERT(pksav_save.save_time.p_time_played != nullptr);
+            ret.time_played = pkmn::time_duration(
+                                  pksav_save.save_time.p_time_played->hours,
+                                  pksav_save.save_time.p_time_played->minutes,
+                                  pksav_save.save_time.p_time_played->seconds,
+                                  pksav_save.save_time.p_time_played->frames
+                              );
+
+            BOOST_ASSERT(pksav_save.trainer_info.p_money != nullptr);
+            size_t money_from_pksav = 0;
+            PKSAV_CALL(
+                pksav_import_base256(
+                    pksav_save.trainer_info.p_money,
+                    PKSAV_GEN2_SAVE_MONEY_BUFFER_SIZE_BYTES,
+                    &money_from_pksav
+                );
+            )
+            ret.money = int(money_from_pksav);
+
+            // The count field may not be reliable, so stop at the first
+            // empty slot. Eggs are reported as the species inside.
+            const struct pksav_gen2_pokemon_party* p_party =
+                pksav_save.pokemon_storage.p_party;
+            BOOST_ASSERT(p_party != nullptr);
+            size_t num_party_pokemon = std::min<size_t>(
+                                           p_party->count,
+                                           sizeof(p_party->party)/sizeof(p_party->party[0])
+                                       );
+            for(size_t party_index = 0;
+                (party_index < num_party_pokemon) &&
+                (p_party->party[party_index].pc_data.species > 0);
+                ++party_index)
+            {
+                _add_party_pokemon_to_summary(
+                    p_party->party[party_index].pc_data.species,
+                    p_party->party[party_index].pc_data.level,
+                    game_id,
+                    ret
+                );
+            }
+
+            BOOST_ASSERT(pksav_save.pokedex_lists.p_seen != nullptr);
+            BOOST_ASSERT(pksav_save.pokedex_lists.p_owned != nullptr);
+            ret.num_pokedex_seen = _count_pokedex_entries(
+                                       pksav_save.pokedex_lists.p_seen,
+                                       2
+                                   );
+            ret.num_pokedex_caught = _count_pokedex_entries(
+                                         pksav_save.pokedex_lists.p_owned,
+                                         2
+                                     );
+        }
+        catch(...)
+        {
+            pksav_gen2_free_save(&pksav_save);
+            throw;
+        }
+
+        pksav_gen2_free_save(&pksav_save);
+
+        return ret;
+    }
+
     void game_save_gen2impl::save_as(
         const std::string& filepath
     )
     {
         boost::lock_guard<game_save_gen2impl> lock(*this);
 
-        // These get_native() calls will call the mutex for every subclass
-        // it copies, so we don't need to worry about that here.
-        pkmn::rcast_equal<struct pksav_gen2_item_bag>(
-            _item_bag->get_native(),
-            _pksav_save.item_storage.p_item_bag
-        );
-        pkmn::rcast_equal<struct pksav_gen2_item_pc>(
-            _item_pc->get_native(),
-            _pksav_save.item_storage.p_item_pc
-        );
-        pkmn::rcast_equal<struct pksav_gen2_pokemon_party>(
-            _pokemon_party->get_native(),
-            _pksav_save.pokemon_storage.p_party
-        );
+        // Only what has changed since the last save is copied. These calls
+        // lock every subclass they copy, so we don't need to worry about
+        // that here.
+        void* p_item_bag_native = _get_item_bag_native_if_dirty();
+        if(p_item_bag_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen2_item_bag>(
+                p_item_bag_native,
+                _pksav_save.item_storage.p_item_bag
+            );
+        }
+
+        void* p_item_pc_native = _get_item_pc_native_if_dirty();
+        if(p_item_pc_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen2_item_pc>(
+                p_item_pc_native,
+                _pksav_save.item_storage.p_item_pc
+            );
+        }
+
+        void* p_party_native = _get_pokemon_party_native_if_dirty();
+        if(p_party_native != nullptr)
+        {
+            pkmn::rcast_equal<struct pksav_gen2_pokemon_party>(
+                p_party_native,
+                _pksav_save.pokemon_storage.p_party
+            );
+        }
 
         // The PC is stored in multiple pointers, so this is more manual.
         const struct pksav_gen2_pokemon_storage* p_pokemon_storage =
             static_cast<const struct pksav_gen2_pokemon_storage*>(
-                _pokemon_pc->get_native()
+                _get_pokemon_pc_native_if_dirty()
             );
-        for(size_t box_index = 0;
-            box_index < PKSAV_GEN2_NUM_POKEMON_BOXES;
-            ++box_index)
+        if(p_pokemon_storage != nullptr)
         {
-            *(_pksav_save.pokemon_storage.pp_boxes[box_index]) =
-                *(p_pokemon_storage->pp_boxes[box_index]);
+            for(size_t box_index = 0;
+                box_index < PKSAV_GEN2_NUM_POKEMON_BOXES;
+                ++box_index)
+            {
+                *(_pksav_save.pokemon_storage.pp_boxes[box_index]) =
+                    *(p_pokemon_storage->pp_boxes[box_index]);
+            }
+            *(_pksav_save.pokemon_storage.p_current_box_num) =
+                *(p_pokemon_storage->p_current_box_num);
+            *(_pksav_save.pokemon_storage.p_current_box) =
+                *(p_pokemon_storage->p_current_box);
         }
-        *(_pksav_save.pokemon_storage.p_current_box_num) =
-            *(p_pokemon_storage->p_current_box_num);
-        *(_pksav_save.pokemon_storage.p_current_box) =
-            *(p_pokemon_storage->p_current_box);
 
         save_gb_pokedex(
             &_pksav_save.pokedex_lists,
             PKSAV_GEN2_POKEDEX_BUFFER_SIZE_BYTES
         );
 
-        PKSAV_CALL(
-            pksav_gen2_save_save(
-                filepath.c_str(),
-                &_pksav_save
-            );
-        )
+        pkmn::io::write_file_atomically(
+            filepath,
+            [this](const std::string& temp_filepath)
+            {
+                PKSAV_CALL(
+                    pksav_gen2_save_save(
+                        temp_filepath.c_str(),
+                        &_pksav_save
+                    );
+                )
+            }
+        );
 
         _filepath = fs::absolute(filepath).string();
     }
@@ -948,69 +1083,89 @@ namespace pkmn {
 
     void game_save_gen2impl::_register_attributes()
     {
-        using std::placeholders::_1;
+        static const pkmn::attribute_registry<int> NUMERIC_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<int> registry;
+            registry.register_attribute_fcns(
+                "Textbox frame",
+                &game_save_gen2impl::get_textbox_frame_index,
+                &game_save_gen2impl::set_textbox_frame_index
+            );
+            registry.register_attribute_fcns(
+                "Money with Mom",
+                &game_save_gen2impl::get_money_with_mom,
+                &game_save_gen2impl::set_money_with_mom
+            );
+            registry.register_attribute_fcns(
+                "Casino coins",
+                &game_save_gen2impl::get_casino_coins,
+                &game_save_gen2impl::set_casino_coins
+            );
 
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Textbox frame",
-            std::bind(&game_save_gen2impl::get_textbox_frame_index, this),
-            std::bind(&game_save_gen2impl::set_textbox_frame_index, this, _1)
-        );
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Money with Mom",
-            std::bind(&game_save_gen2impl::get_money_with_mom, this),
-            std::bind(&game_save_gen2impl::set_money_with_mom, this, _1)
-        );
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Casino coins",
-            std::bind(&game_save_gen2impl::get_casino_coins, this),
-            std::bind(&game_save_gen2impl::set_casino_coins, this, _1)
-        );
+            return registry;
+        }();
 
-        _string_attribute_engine.register_attribute_fcns(
-            "Player palette",
-            std::bind(&game_save_gen2impl::get_palette, this),
-            std::bind(&game_save_gen2impl::set_palette, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Text speed",
-            std::bind(&game_save_gen2impl::get_text_speed, this),
-            std::bind(&game_save_gen2impl::set_text_speed, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Sound output",
-            std::bind(&game_save_gen2impl::get_sound_output, this),
-            std::bind(&game_save_gen2impl::set_sound_output, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Battle style",
-            std::bind(&game_save_gen2impl::get_battle_style, this),
-            std::bind(&game_save_gen2impl::set_battle_style, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Game Boy Printer brightness",
-            std::bind(&game_save_gen2impl::get_gameboy_printer_brightness, this),
-            std::bind(&game_save_gen2impl::set_gameboy_printer_brightness, this, _1)
-        );
-        _string_attribute_engine.register_attribute_fcns(
-            "Mom money policy",
-            std::bind(&game_save_gen2impl::get_mom_money_policy, this),
-            std::bind(&game_save_gen2impl::set_mom_money_policy, this, _1)
-        );
+        static const pkmn::attribute_registry<std::string> STRING_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<std::string> registry;
+            registry.register_attribute_fcns(
+                "Player palette",
+                &game_save_gen2impl::get_palette,
+                &game_save_gen2impl::set_palette
+            );
+            registry.register_attribute_fcns(
+                "Text speed",
+                &game_save_gen2impl::get_text_speed,
+                &game_save_gen2impl::set_text_speed
+            );
+            registry.register_attribute_fcns(
+                "Sound output",
+                &game_save_gen2impl::get_sound_output,
+                &game_save_gen2impl::set_sound_output
+            );
+            registry.register_attribute_fcns(
+                "Battle style",
+                &game_save_gen2impl::get_battle_style,
+                &game_save_gen2impl::set_battle_style
+            );
+            registry.register_attribute_fcns(
+                "Game Boy Printer brightness",
+                &game_save_gen2impl::get_gameboy_printer_brightness,
+                &game_save_gen2impl::set_gameboy_printer_brightness
+            );
+            registry.register_attribute_fcns(
+                "Mom money policy",
+                &game_save_gen2impl::get_mom_money_policy,
+                &game_save_gen2impl::set_mom_money_policy
+            );
 
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Daylight savings time?",
-            std::bind(&game_save_gen2impl::get_is_daylight_savings, this),
-            std::bind(&game_save_gen2impl::set_is_daylight_savings, this, _1)
-        );
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Enable battle scene?",
-            std::bind(&game_save_gen2impl::get_is_battle_scene_enabled, this),
-            std::bind(&game_save_gen2impl::set_is_battle_scene_enabled, this, _1)
-        );
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Enable menu account?",
-            std::bind(&game_save_gen2impl::get_is_menu_account_enabled, this),
-            std::bind(&game_save_gen2impl::set_is_menu_account_enabled, this, _1)
-        );
+            return registry;
+        }();
+
+        static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<bool> registry;
+            registry.register_attribute_fcns(
+                "Daylight savings time?",
+                &game_save_gen2impl::get_is_daylight_savings,
+                &game_save_gen2impl::set_is_daylight_savings
+            );
+            registry.register_attribute_fcns(
+                "Enable battle scene?",
+                &game_save_gen2impl::get_is_battle_scene_enabled,
+                &game_save_gen2impl::set_is_battle_scene_enabled
+            );
+            registry.register_attribute_fcns(
+                "Enable menu account?",
+                &game_save_gen2impl::get_is_menu_account_enabled,
+                &game_save_gen2impl::set_is_menu_account_enabled
+            );
+
+            return registry;
+        }();
+
+        _p_numeric_attribute_registry = &NUMERIC_ATTRIBUTE_REGISTRY;
+        _p_string_attribute_registry = &STRING_ATTRIBUTE_REGISTRY;
+        _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
     }
 }
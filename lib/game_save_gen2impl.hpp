@@ -19,11 +19,18 @@ namespace pkmn {
             game_save_gen2impl() {};
             game_save_gen2impl(
                 const std::string& filepath,
-                std::vector<uint8_t>&& raw
+                const uint8_t* p_raw,
+                size_t raw_size
             );
 
             ~game_save_gen2impl();
 
+            static pkmn::game_save_summary summarize(
+                const std::string& filepath,
+                const uint8_t* p_raw,
+                size_t raw_size
+            );
+
             void save_as(
                 const std::string& filepath
             ) final;
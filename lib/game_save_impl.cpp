@@ -10,22 +10,32 @@
 #include "game_save_gen2impl.hpp"
 #include "game_save_gbaimpl.hpp"
 #include "game_save_gcnimpl.hpp"
+#include "item_bag_impl.hpp"
+#include "item_list_impl.hpp"
+#include "pokemon_party_impl.hpp"
+#include "pokemon_pc_impl.hpp"
 
 #include "database/enum_conversions.hpp"
 #include "database/id_to_string.hpp"
+#include "database/query_instrumentation.hpp"
 
 #include "io/read_write.hpp"
 
 #include "pkmgc/includes.hpp"
 #include "pksav/pksav_call.hpp"
 
+#include <pkmn/database/pokemon_entry.hpp>
+#include <pkmn/types/species_set.hpp>
+
 #include <pksav/gen1/save.h>
 #include <pksav/gen2/save.h>
 #include <pksav/gba/save.h>
 
 #include <boost/filesystem.hpp>
+#include <boost/thread/thread.hpp>
 
-#include <fstream>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <stdexcept>
 
@@ -63,88 +73,232 @@ namespace pkmn {
         {PKSAV_GBA_SAVE_TYPE_FRLG,    pkmn::e_game_save_type::FIRERED_LEAFGREEN}
     };
 
-    static pkmn::e_game_save_type _detect_save_type(
-        const std::vector<uint8_t>& data
+    /*
+     * Cheap signature checks, so only the formats a buffer could plausibly be
+     * are validated. Validation means checksum work over most of the buffer
+     * (or decrypting the whole thing, for Gamecube saves), so this keeps
+     * junk input from being fully parsed several times over.
+     */
+
+    // Generation I-II saves are 32 KiB. Some emulators append a real-time
+    // clock footer or pad the file, so allow for that.
+    BOOST_STATIC_CONSTEXPR size_t GB_SAVE_SIZE = 0x8000;
+    BOOST_STATIC_CONSTEXPR size_t GB_MAX_FILE_SIZE = 0x10000;
+
+    // Every 4 KiB section of a Generation III save ends in a footer with the
+    // section ID and a constant validation value.
+    BOOST_STATIC_CONSTEXPR size_t GBA_SECTION_SIZE = 0x1000;
+    BOOST_STATIC_CONSTEXPR size_t GBA_NUM_SECTIONS = 14;
+    BOOST_STATIC_CONSTEXPR size_t GBA_SAVE_SLOT_SIZE = GBA_SECTION_SIZE * GBA_NUM_SECTIONS;
+    BOOST_STATIC_CONSTEXPR size_t GBA_SECTION_ID_OFFSET = 0xFF4;
+    BOOST_STATIC_CONSTEXPR size_t GBA_VALIDATION_OFFSET = 0xFF8;
+    BOOST_STATIC_CONSTEXPR uint32_t GBA_VALIDATION_MAGIC = 0x08012025;
+
+    // GCI files start with the game code, whose first three characters
+    // identify the game regardless of region.
+    static BOOST_CONSTEXPR const char* GCN_COLOSSEUM_GAME_CODE = "GC6";
+    static BOOST_CONSTEXPR const char* GCN_XD_GAME_CODE = "GXX";
+    BOOST_STATIC_CONSTEXPR size_t GCN_GAME_CODE_PREFIX_SIZE = 3;
+
+    static inline uint32_t _read_little_endian32(
+        const uint8_t* p_data
     )
     {
-        pkmn::e_game_save_type ret = pkmn::e_game_save_type::NONE;
+        return uint32_t(p_data[0]) |
+               (uint32_t(p_data[1]) << 8) |
+               (uint32_t(p_data[2]) << 16) |
+               (uint32_t(p_data[3]) << 24);
+    }
+
+    static bool _has_gba_section_footer(
+        const uint8_t* p_data,
+        size_t data_size,
+        size_t section_offset
+    )
+    {
+        bool ret = false;
+
+        if((section_offset + GBA_SECTION_SIZE) <= data_size)
+        {
+            const uint8_t* p_section = p_data + section_offset;
+            size_t section_id = size_t(p_section[GBA_SECTION_ID_OFFSET]) |
+                                (size_t(p_section[GBA_SECTION_ID_OFFSET+1]) << 8);
+
+            ret = (section_id < GBA_NUM_SECTIONS) &&
+                  (_read_little_endian32(p_section + GBA_VALIDATION_OFFSET) == GBA_VALIDATION_MAGIC);
+        }
+
+        return ret;
+    }
+
+    static bool _matches_gba_signature(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        // A new save may only have one of its two slots written.
+        return _has_gba_section_footer(p_data, data_size, 0) ||
+               _has_gba_section_footer(p_data, data_size, GBA_SAVE_SLOT_SIZE);
+    }
+
+    static bool _matches_gcn_signature(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        bool ret = false;
+
+        if((data_size == GCN_COLOSSEUM_GCI_SIZE) or (data_size == GCN_XD_GCI_SIZE))
+        {
+            const char* game_code = (data_size == GCN_COLOSSEUM_GCI_SIZE) ? GCN_COLOSSEUM_GAME_CODE
+                                                                           : GCN_XD_GAME_CODE;
+
+            ret = std::equal(
+                      p_data,
+                      p_data + GCN_GAME_CODE_PREFIX_SIZE,
+                      reinterpret_cast<const uint8_t*>(game_code)
+                  );
+        }
+        else
+        {
+            // Raw memory card dumps have no header to check.
+            ret = (data_size == GCN_COLOSSEUM_BIN_SIZE) or (data_size == GCN_XD_BIN_SIZE);
+        }
+
+        return ret;
+    }
+
+    static bool _matches_gb_signature(
+        size_t data_size
+    )
+    {
+        return (data_size >= GB_SAVE_SIZE) && (data_size <= GB_MAX_FILE_SIZE);
+    }
 
-        size_t data_size = data.size();
+    /*
+     * Full validation, only called for buffers that passed the matching
+     * signature check above.
+     */
+
+    static pkmn::e_game_save_type _validate_gcn_save(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        pkmn::e_game_save_type ret = pkmn::e_game_save_type::NONE;
 
         std::unique_ptr<LibPkmGC::GC::SaveEditing::Save> gcn_save_uptr;
         if((data_size == GCN_COLOSSEUM_BIN_SIZE) or (data_size == GCN_COLOSSEUM_GCI_SIZE))
         {
             gcn_save_uptr.reset(
                 new LibPkmGC::Colosseum::SaveEditing::Save(
-                        data.data(),
+                        p_data,
                         (data_size == GCN_COLOSSEUM_GCI_SIZE)
                     )
             );
         }
-        else if((data_size == GCN_XD_BIN_SIZE) or (data_size == GCN_XD_GCI_SIZE))
+        else
         {
             gcn_save_uptr.reset(
                 new LibPkmGC::XD::SaveEditing::Save(
-                        data.data(),
+                        p_data,
                         (data_size == GCN_XD_GCI_SIZE)
                     )
             );
         }
 
-        if(gcn_save_uptr.get() != nullptr)
+        size_t save_index = 0;
+        if(gcn_save_uptr->getMostRecentValidSlot(0, &save_index))
         {
-            size_t save_index = 0;
-            if(gcn_save_uptr->getMostRecentValidSlot(0, &save_index))
-            {
-                ret = pkmn::e_game_save_type::COLOSSEUM_XD;
-            }
+            ret = pkmn::e_game_save_type::COLOSSEUM_XD;
         }
 
+        return ret;
+    }
+
+    static pkmn::e_game_save_type _validate_gba_save(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        enum pksav_gba_save_type gba_save_type = PKSAV_GBA_SAVE_TYPE_NONE;
+        PKSAV_CALL(
+            pksav_gba_get_buffer_save_type(
+                p_data,
+                data_size,
+                &gba_save_type
+            );
+        );
+
+        BOOST_ASSERT(PKSAV_GBA_ENUM_MAP.count(gba_save_type) > 0);
+        return PKSAV_GBA_ENUM_MAP.at(gba_save_type);
+    }
+
+    static pkmn::e_game_save_type _validate_gb_save(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        // Checking Gen I before Gen II tends to remove Generation II saves
+        // registering as Generation I.
+        enum pksav_gen1_save_type gen1_save_type = PKSAV_GEN1_SAVE_TYPE_NONE;
+        PKSAV_CALL(
+            pksav_gen1_get_buffer_save_type(
+                p_data,
+                data_size,
+                &gen1_save_type
+            );
+        );
+
+        BOOST_ASSERT(PKSAV_GEN1_ENUM_MAP.count(gen1_save_type) > 0);
+        pkmn::e_game_save_type ret = PKSAV_GEN1_ENUM_MAP.at(gen1_save_type);
+
         if(ret == pkmn::e_game_save_type::NONE)
         {
-            enum pksav_gba_save_type gba_save_type = PKSAV_GBA_SAVE_TYPE_NONE;
+            enum pksav_gen2_save_type gen2_save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
             PKSAV_CALL(
-                pksav_gba_get_buffer_save_type(
-                    data.data(),
+                pksav_gen2_get_buffer_save_type(
+                    p_data,
                     data_size,
-                    &gba_save_type
+                    &gen2_save_type
                 );
             );
 
-            BOOST_ASSERT(PKSAV_GBA_ENUM_MAP.count(gba_save_type) > 0);
-            ret = PKSAV_GBA_ENUM_MAP.at(gba_save_type);
+            BOOST_ASSERT(PKSAV_GEN2_ENUM_MAP.count(gen2_save_type) > 0);
+            ret = PKSAV_GEN2_ENUM_MAP.at(gen2_save_type);
+        }
 
-            // Checking Gen I before Gen II tends to remove Generation II saves
-            // registering as Generation I.
-            if(ret == pkmn::e_game_save_type::NONE)
-            {
-                enum pksav_gen1_save_type gen1_save_type = PKSAV_GEN1_SAVE_TYPE_NONE;
-                PKSAV_CALL(
-                    pksav_gen1_get_buffer_save_type(
-                        data.data(),
-                        data_size,
-                        &gen1_save_type
-                    );
-                );
+        return ret;
+    }
 
-                BOOST_ASSERT(PKSAV_GEN1_ENUM_MAP.count(gen1_save_type) > 0);
-                ret = PKSAV_GEN1_ENUM_MAP.at(gen1_save_type);
+    static pkmn::game_save_detection _detect_save_type(
+        const uint8_t* p_data,
+        size_t data_size
+    )
+    {
+        pkmn::game_save_detection ret;
 
-                if(ret == pkmn::e_game_save_type::NONE)
-                {
-                    enum pksav_gen2_save_type gen2_save_type = PKSAV_GEN2_SAVE_TYPE_NONE;
-                    PKSAV_CALL(
-                        pksav_gen2_get_buffer_save_type(
-                            data.data(),
-                            data_size,
-                            &gen2_save_type
-                        );
-                    );
-
-                    BOOST_ASSERT(PKSAV_GEN2_ENUM_MAP.count(gen2_save_type) > 0);
-                    ret = PKSAV_GEN2_ENUM_MAP.at(gen2_save_type);
-                }
-            }
+        if(_matches_gcn_signature(p_data, data_size))
+        {
+            ret.confidence = pkmn::e_game_save_detection_confidence::SIGNATURE_MATCH;
+            ret.save_type = _validate_gcn_save(p_data, data_size);
+        }
+        if((ret.save_type == pkmn::e_game_save_type::NONE) &&
+           _matches_gba_signature(p_data, data_size))
+        {
+            ret.confidence = pkmn::e_game_save_detection_confidence::SIGNATURE_MATCH;
+            ret.save_type = _validate_gba_save(p_data, data_size);
+        }
+        if((ret.save_type == pkmn::e_game_save_type::NONE) &&
+           _matches_gb_signature(data_size))
+        {
+            ret.confidence = pkmn::e_game_save_detection_confidence::SIGNATURE_MATCH;
+            ret.save_type = _validate_gb_save(p_data, data_size);
+        }
+
+        if(ret.save_type != pkmn::e_game_save_type::NONE)
+        {
+            ret.confidence = pkmn::e_game_save_detection_confidence::VALIDATED;
         }
 
         return ret;
@@ -153,72 +307,276 @@ namespace pkmn {
     pkmn::e_game_save_type game_save::detect_type(
         const std::string& filepath
     )
+    {
+        return detect_type_with_confidence(filepath).save_type;
+    }
+
+    pkmn::game_save_detection game_save::detect_type_with_confidence(
+        const std::string& filepath
+    )
     {
         if(!fs::exists(filepath))
         {
             throw std::invalid_argument("The given filepath does not exist.");
         }
 
-        size_t filesize = size_t(fs::file_size(filepath));
-        std::vector<uint8_t> raw(filesize);
+        pkmn::io::mapped_file save_file(filepath);
+
+        return _detect_save_type(save_file.data(), save_file.size());
+    }
+
+    // Files that aren't valid saves are reported through the return value
+    // so try_from_file() doesn't need to catch anything for them. Anything
+    // else that goes wrong still throws.
+    static pkmn::e_load_status _load_game_save_file(
+        const std::string& filepath,
+        game_save::sptr& game_save_out
+    )
+    {
+        pkmn::database::query_entry_point entry_point("pkmn::game_save::from_file");
+
+        boost::system::error_code error_code;
+        if(!fs::is_regular_file(filepath, error_code))
+        {
+            return pkmn::e_load_status::FILE_NOT_FOUND;
+        }
+
+        // Every implementation copies what it needs out of the file, so it
+        // only needs to be mapped while the save is loaded.
+        pkmn::io::mapped_file save_file(filepath);
+
+        pkmn::e_game_save_type save_type = _detect_save_type(
+                                               save_file.data(),
+                                               save_file.size()
+                                           ).save_type;
+
+        switch(save_type)
+        {
+            case pkmn::e_game_save_type::RED_BLUE:
+            case pkmn::e_game_save_type::YELLOW:
+                game_save_out = std::make_shared<game_save_gen1impl>(
+                                    filepath,
+                                    save_file.data(),
+                                    save_file.size()
+                                );
+                break;
+
+            case pkmn::e_game_save_type::GOLD_SILVER:
+            case pkmn::e_game_save_type::CRYSTAL:
+                game_save_out = std::make_shared<game_save_gen2impl>(
+                                    filepath,
+                                    save_file.data(),
+                                    save_file.size()
+                                );
+                break;
+
+            case pkmn::e_game_save_type::RUBY_SAPPHIRE:
+            case pkmn::e_game_save_type::EMERALD:
+            case pkmn::e_game_save_type::FIRERED_LEAFGREEN:
+                game_save_out = std::make_shared<game_save_gbaimpl>(
+                                    filepath,
+                                    save_file.data(),
+                                    save_file.size()
+                                );
+                break;
 
-        std::ifstream ifile(filepath.c_str(), std::ios::binary);
-        ifile.read(reinterpret_cast<char*>(raw.data()), filesize);
-        ifile.close();
+            case pkmn::e_game_save_type::COLOSSEUM_XD:
+                game_save_out = std::make_shared<game_save_gcnimpl>(
+                                    filepath,
+                                    save_file.data(),
+                                    save_file.size()
+                                );
+                break;
+
+            case pkmn::e_game_save_type::NONE:
+            default:
+                return pkmn::e_load_status::INVALID_FILE;
+        }
 
-        return _detect_save_type(raw);
+        return pkmn::e_load_status::SUCCESS;
     }
 
     game_save::sptr game_save::from_file(
         const std::string& filepath
     )
     {
-        std::vector<uint8_t> raw = pkmn::io::read_file(filepath);
+        game_save::sptr ret;
+
+        switch(_load_game_save_file(filepath, ret))
+        {
+            case pkmn::e_load_status::SUCCESS:
+                break;
+
+            case pkmn::e_load_status::FILE_NOT_FOUND:
+                throw std::invalid_argument("The given filepath does not exist.");
+
+            default:
+                throw std::invalid_argument("Invalid save (or unimplemented).");
+        }
+
+        return ret;
+    }
+
+    pkmn::e_load_status game_save::try_from_file(
+        const std::string& filepath,
+        game_save::sptr& game_save_out
+    ) noexcept
+    {
+        try
+        {
+            return _load_game_save_file(filepath, game_save_out);
+        }
+        catch(...)
+        {
+            return pkmn::e_load_status::LOAD_ERROR;
+        }
+    }
+
+    std::vector<pkmn::game_save_load_result> game_save::from_files(
+        const std::vector<std::string>& filepaths,
+        const pkmn::game_save_load_options& options
+    )
+    {
+        std::vector<pkmn::game_save_load_result> results(filepaths.size());
+
+        size_t num_workers = options.num_workers;
+        if(num_workers == 0)
+        {
+            num_workers = std::max<size_t>(1, boost::thread::hardware_concurrency());
+        }
+        num_workers = std::min(num_workers, filepaths.size());
+
+        // Each worker takes the next file no one has claimed, so one large
+        // or slow file doesn't hold up the rest. Every file has its own
+        // result, so workers never write to the same one.
+        std::atomic<size_t> next_file_index(0);
+        auto load_files = [&]()
+        {
+            size_t file_index = 0;
+            while((file_index = next_file_index++) < filepaths.size())
+            {
+                pkmn::game_save_load_result& r_result = results[file_index];
+                r_result.filepath = filepaths[file_index];
+
+                try
+                {
+                    r_result.save = from_file(filepaths[file_index]);
+                }
+                catch(const std::exception& e)
+                {
+                    r_result.error = e.what();
+                }
+                catch(...)
+                {
+                    r_result.error = "Unknown error";
+                }
+            }
+        };
+
+        // This thread is also a worker.
+        boost::thread_group worker_threads;
+        try
+        {
+            for(size_t worker_index = 1; worker_index < num_workers; ++worker_index)
+            {
+                worker_threads.create_thread(load_files);
+            }
+            load_files();
+        }
+        catch(...)
+        {
+            worker_threads.join_all();
+            throw;
+        }
+        worker_threads.join_all();
+
+        return results;
+    }
+
+    pkmn::game_save_summary game_save::peek(
+        const std::string& filepath
+    )
+    {
+        pkmn::io::mapped_file save_file(filepath);
 
-        pkmn::e_game_save_type save_type = _detect_save_type(raw);
+        pkmn::e_game_save_type save_type = _detect_save_type(
+                                               save_file.data(),
+                                               save_file.size()
+                                           ).save_type;
 
+        pkmn::game_save_summary ret;
         switch(save_type)
         {
             case pkmn::e_game_save_type::RED_BLUE:
             case pkmn::e_game_save_type::YELLOW:
-                return std::make_shared<game_save_gen1impl>(
-                           filepath,
-                           std::move(raw)
-                       );
+                ret = game_save_gen1impl::summarize(filepath, save_file.data(), save_file.size());
+                break;
 
             case pkmn::e_game_save_type::GOLD_SILVER:
             case pkmn::e_game_save_type::CRYSTAL:
-                return std::make_shared<game_save_gen2impl>(
-                           filepath,
-                           std::move(raw)
-                       );
+                ret = game_save_gen2impl::summarize(filepath, save_file.data(), save_file.size());
+                break;
 
             case pkmn::e_game_save_type::RUBY_SAPPHIRE:
             case pkmn::e_game_save_type::EMERALD:
             case pkmn::e_game_save_type::FIRERED_LEAFGREEN:
-                return std::make_shared<game_save_gbaimpl>(
-                           filepath,
-                           std::move(raw)
-                       );
+                ret = game_save_gbaimpl::summarize(filepath, save_file.data(), save_file.size());
+                break;
 
             case pkmn::e_game_save_type::COLOSSEUM_XD:
-                return std::make_shared<game_save_gcnimpl>(
-                           filepath,
-                           std::move(raw)
-                       );
+                ret = game_save_gcnimpl::summarize(save_file.data(), save_file.size());
+                break;
 
             case pkmn::e_game_save_type::NONE:
             default:
                 throw std::invalid_argument("Invalid save (or unimplemented).");
         }
+
+        ret.save_type = save_type;
+
+        return ret;
+    }
+
+    void game_save_impl::_add_party_pokemon_to_summary(
+        int pokemon_index,
+        int level,
+        int game_id,
+        pkmn::game_save_summary& r_summary
+    )
+    {
+        // Only the database entry is needed for the species, which avoids
+        // creating a full Pokémon.
+        pkmn::database::pokemon_entry entry(pokemon_index, game_id);
+
+        r_summary.party_species.emplace_back(entry.get_species());
+        r_summary.party_levels.emplace_back(level);
+    }
+
+    int game_save_impl::_count_pokedex_entries(
+        const uint8_t* p_native_list,
+        int generation
+    )
+    {
+        static const std::vector<uint16_t> GENERATION_POKEDEX_SIZES =
+        {
+            0, 151, 251, 386
+        };
+
+        BOOST_ASSERT(p_native_list != nullptr);
+
+        return int(
+                   pkmn::species_set(
+                       p_native_list,
+                       GENERATION_POKEDEX_SIZES.at(generation)
+                   ).size()
+               );
     }
 
     game_save_impl::game_save_impl(
-        const std::string& filepath,
-        std::vector<uint8_t>&& raw
+        const std::string& filepath
     ): game_save(),
-       _game_id(0),
-       _raw(std::move(raw))
+       _pokemon_arena(std::make_shared<pkmn::arena>()),
+       _game_id(0)
     {
         if(not fs::exists(filepath))
         {
@@ -267,4 +625,36 @@ namespace pkmn {
     {
         return _item_pc;
     }
+
+    void* game_save_impl::_get_item_bag_native_if_dirty()
+    {
+        item_bag_impl* p_item_bag_impl = dynamic_cast<item_bag_impl*>(_item_bag.get());
+        BOOST_ASSERT(p_item_bag_impl != nullptr);
+
+        return p_item_bag_impl->get_native_if_dirty();
+    }
+
+    void* game_save_impl::_get_item_pc_native_if_dirty()
+    {
+        item_list_impl* p_item_pc_impl = dynamic_cast<item_list_impl*>(_item_pc.get());
+        BOOST_ASSERT(p_item_pc_impl != nullptr);
+
+        return p_item_pc_impl->get_native_if_dirty();
+    }
+
+    void* game_save_impl::_get_pokemon_party_native_if_dirty()
+    {
+        pokemon_party_impl* p_party_impl = dynamic_cast<pokemon_party_impl*>(_pokemon_party.get());
+        BOOST_ASSERT(p_party_impl != nullptr);
+
+        return p_party_impl->get_native_if_dirty();
+    }
+
+    void* game_save_impl::_get_pokemon_pc_native_if_dirty()
+    {
+        pokemon_pc_impl* p_pc_impl = dynamic_cast<pokemon_pc_impl*>(_pokemon_pc.get());
+        BOOST_ASSERT(p_pc_impl != nullptr);
+
+        return p_pc_impl->get_native_if_dirty();
+    }
 }
@@ -7,6 +7,8 @@
 #ifndef PKMN_GAME_SAVE_IMPL_HPP
 #define PKMN_GAME_SAVE_IMPL_HPP
 
+#include "types/arena.hpp"
+
 #include <pkmn/game_save.hpp>
 
 #include <boost/assert.hpp>
@@ -27,9 +29,8 @@ namespace pkmn {
     {
         public:
             game_save_impl() {};
-            game_save_impl(
-                const std::string& filepath,
-                std::vector<uint8_t>&& raw
+            explicit game_save_impl(
+                const std::string& filepath
             );
 
             virtual ~game_save_impl() {};
@@ -51,6 +52,27 @@ namespace pkmn {
             const pkmn::item_list::sptr& get_item_pc() final;
 
         protected:
+            // Used by each implementation's summarize() for game_save::peek().
+            static void _add_party_pokemon_to_summary(
+                int pokemon_index,
+                int level,
+                int game_id,
+                pkmn::game_save_summary& r_summary
+            );
+
+            // Each of these returns the subclass's updated native
+            // representation if it has changed since the last call, or
+            // nullptr if the copy in the save is already up to date.
+            void* _get_item_bag_native_if_dirty();
+            void* _get_item_pc_native_if_dirty();
+            void* _get_pokemon_party_native_if_dirty();
+            void* _get_pokemon_pc_native_if_dirty();
+
+            static int _count_pokedex_entries(
+                const uint8_t* p_native_list,
+                int generation
+            );
+
             std::string _filepath;
 
             pkmn::pokedex::sptr _pokedex;
@@ -59,9 +81,12 @@ namespace pkmn {
             pkmn::item_bag::sptr _item_bag;
             pkmn::item_list::sptr _item_pc;
 
-            int _game_id;
+            // Backs the Pokémon created from the PC's native entries, which
+            // are all freed together once the save and every Pokémon taken
+            // from it are gone.
+            pkmn::arena::sptr _pokemon_arena;
 
-            std::vector<uint8_t> _raw;
+            int _game_id;
 
             template <typename gb_pokedex_type>
             void save_gb_pokedex(
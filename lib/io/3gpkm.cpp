@@ -45,36 +45,32 @@ namespace pkmn { namespace io {
         BOOST_STATIC_CONSTEXPR int RUBY_ID = 8;
 
         // Validate species
-        try
-        {
-            (void)pkmn::database::pokemon_index_to_id(
-                      pksav_littleendian16(growth->species),
-                      RUBY_ID
-                  );
-        }
-        catch(const std::invalid_argument&)
+        int species_id = 0;
+        if(!pkmn::database::try_pokemon_index_to_id(
+                pksav_littleendian16(growth->species),
+                RUBY_ID,
+                species_id
+            ))
         {
             return false;
         }
 
         // Validate game
-        try
+        int game_id = 0;
+        if(!pkmn::database::try_game_index_to_id(
+                PKSAV_GBA_POKEMON_ORIGIN_GAME(misc->origin_info),
+                game_id
+            ) || (game_id == 0))
         {
-            int game_id = pkmn::database::game_index_to_id(
-                              PKSAV_GBA_POKEMON_ORIGIN_GAME(misc->origin_info)
-                          );
-            if(pkmn::database::game_id_to_generation(game_id) != 3)
-            {
-                return false;
-            }
-
-            *game_id_out = game_id;
+            return false;
         }
-        catch(const std::invalid_argument&)
+        if(pkmn::database::game_id_to_generation(game_id) != 3)
         {
             return false;
         }
 
+        *game_id_out = game_id;
+
         return true;
     }
 
@@ -41,19 +41,13 @@ namespace pkmn { namespace io {
         const struct pksav_gen2_pc_pokemon* native = reinterpret_cast<const struct pksav_gen2_pc_pokemon*>(buffer.data());
 
         // Validate species
-        try
-        {
-            (void)pkmn::database::pokemon_index_to_id(
-                      native->species,
-                      GOLD_ID
-                  );
-        }
-        catch(const std::invalid_argument&)
-        {
-            return false;
-        }
+        int species_id = 0;
 
-        return true;
+        return pkmn::database::try_pokemon_index_to_id(
+                   native->species,
+                   GOLD_ID,
+                   species_id
+               );
     }
 
     pkmn::pokemon::sptr load_pk2(
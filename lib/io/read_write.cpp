@@ -6,6 +6,7 @@
  */
 
 #include "3gpkm.hpp"
+#include "read_write.hpp"
 #include "../pokemon_gbaimpl.hpp"
 #include "../database/database_common.hpp"
 #include "../database/id_to_index.hpp"
@@ -13,9 +14,18 @@
 #include <pksav/gba/pokemon.h>
 #include <pksav/math/endian.h>
 
+#include <pkmn/config.hpp>
+
+#include <boost/assert.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 
+#if !defined(PKMN_PLATFORM_WIN32) && !defined(PKMN_PLATFORM_MINGW)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <fstream>
 #include <stdexcept>
 
@@ -42,4 +52,135 @@ namespace pkmn { namespace io {
 
         return buffer;
     }
+
+    void write_file(
+        const std::string& filepath,
+        const void* p_buffer,
+        size_t buffer_size
+    )
+    {
+        BOOST_ASSERT((p_buffer != nullptr) || (buffer_size == 0));
+
+        std::ofstream ofile(filepath.c_str(), std::ios::binary);
+        ofile.write(static_cast<const char*>(p_buffer), buffer_size);
+        ofile.close();
+
+        if(ofile.fail())
+        {
+            throw std::runtime_error(
+                      str(boost::format("Failed to write \"%s\".")
+                          % filepath.c_str())
+                  );
+        }
+    }
+
+    // An empty file can't be mapped, so leave the region empty.
+    mapped_file::mapped_file(
+        const std::string& filepath
+    ): _mapping(),
+       _region()
+    {
+        if(!fs::exists(filepath))
+        {
+            throw std::invalid_argument(
+                      str(boost::format("The file \"%s\" does not exist.")
+                          % filepath.c_str())
+                  );
+        }
+
+        if(fs::file_size(filepath) > 0)
+        {
+            boost::interprocess::file_mapping(
+                filepath.c_str(),
+                boost::interprocess::read_only
+            ).swap(_mapping);
+            boost::interprocess::mapped_region(
+                _mapping,
+                boost::interprocess::read_only
+            ).swap(_region);
+        }
+    }
+
+    // This also works on a directory, which is how a rename is flushed.
+    static void _flush_file_to_disk(
+        PKMN_UNUSED(const std::string& filepath)
+    )
+    {
+#if !defined(PKMN_PLATFORM_WIN32) && !defined(PKMN_PLATFORM_MINGW)
+        int fd = ::open(filepath.c_str(), O_RDONLY);
+        if(fd >= 0)
+        {
+            ::fsync(fd);
+            ::close(fd);
+        }
+#endif
+    }
+
+    // Renaming the temp file replaces the destination's metadata along with
+    // its contents, so carry over what can be carried over. Ownership can
+    // only be changed with enough privileges, so that part is best-effort.
+    static void _copy_file_metadata(
+        const fs::path& source_filepath,
+        const fs::path& destination_filepath
+    )
+    {
+        boost::system::error_code error_code;
+        fs::file_status source_status = fs::status(source_filepath, error_code);
+        if(error_code || !fs::is_regular_file(source_status))
+        {
+            return;
+        }
+
+        fs::permissions(
+            destination_filepath,
+            source_status.permissions(),
+            error_code
+        );
+
+#if !defined(PKMN_PLATFORM_WIN32) && !defined(PKMN_PLATFORM_MINGW)
+        struct stat source_stat;
+        if(::stat(source_filepath.string().c_str(), &source_stat) == 0)
+        {
+            (void)::chown(
+                destination_filepath.string().c_str(),
+                source_stat.st_uid,
+                source_stat.st_gid
+            );
+        }
+#endif
+    }
+
+    void write_file_atomically(
+        const std::string& filepath,
+        const std::function<void(const std::string&)>& write_fcn
+    )
+    {
+        fs::path destination(filepath);
+        fs::path temp_filepath = destination.parent_path() /
+                                 fs::unique_path(
+                                     destination.filename().string() + ".%%%%-%%%%.tmp"
+                                 );
+
+        try
+        {
+            write_fcn(temp_filepath.string());
+            _copy_file_metadata(destination, temp_filepath);
+            _flush_file_to_disk(temp_filepath.string());
+
+            fs::rename(temp_filepath, destination);
+        }
+        catch(...)
+        {
+            boost::system::error_code error_code;
+            fs::remove(temp_filepath, error_code);
+
+            throw;
+        }
+
+        // The rename itself isn't durable until its directory is flushed.
+        fs::path parent_path = destination.parent_path();
+        _flush_file_to_disk(
+            parent_path.empty() ? std::string(".") : parent_path.string()
+        );
+    }
 }}
@@ -8,9 +8,13 @@
 #define PKMN_IO_READ_WRITE_HPP
 
 #include <boost/assert.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
 
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -18,25 +22,61 @@ namespace pkmn { namespace io {
 
     std::vector<uint8_t> read_file(const std::string& filepath);
 
-    inline void write_file(
-        const std::string& filepath,
-        const std::vector<uint8_t>& contents
-    )
+    /*
+     * A read-only view of a file's contents, mapped into memory instead of
+     * being copied into a buffer. The view is only valid for the lifetime
+     * of this object.
+     */
+    class mapped_file: private boost::noncopyable
     {
-        std::ofstream ofile(filepath, std::ios::binary);
-        ofile.write((const char*)contents.data(), contents.size());
-    }
+        public:
+            explicit mapped_file(
+                const std::string& filepath
+            );
 
-    inline void write_file(
+            inline const uint8_t* data() const
+            {
+                return static_cast<const uint8_t*>(_region.get_address());
+            }
+
+            inline size_t size() const
+            {
+                return _region.get_size();
+            }
+
+        private:
+            boost::interprocess::file_mapping _mapping;
+            boost::interprocess::mapped_region _region;
+    };
+
+    /*
+     * Calls the given function to write a temporary file in the same
+     * directory as the given filepath, flushes it to disk, and then renames
+     * it over the given filepath. If anything fails, the existing file is
+     * left untouched, so a failed save never leaves a corrupted file behind.
+     * The given function must throw if it can't fully write the file.
+     */
+    void write_file_atomically(
+        const std::string& filepath,
+        const std::function<void(const std::string&)>& write_fcn
+    );
+
+    /*
+     * Throws if the contents can't be fully written, such as when the disk
+     * is full.
+     */
+    void write_file(
         const std::string& filepath,
         const void* p_buffer,
         size_t buffer_size
+    );
+
+    inline void write_file(
+        const std::string& filepath,
+        const std::vector<uint8_t>& contents
     )
     {
-        BOOST_ASSERT(p_buffer != nullptr);
-
-        std::ofstream ofile(filepath, std::ios::binary);
-        ofile.write((const char*)p_buffer, buffer_size);
+        write_file(filepath, contents.data(), contents.size());
     }
 
 }}
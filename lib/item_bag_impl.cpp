@@ -10,6 +10,7 @@
 #include "item_bag_gen2impl.hpp"
 #include "item_bag_gbaimpl.hpp"
 #include "item_bag_gcnimpl.hpp"
+#include "item_list_impl.hpp"
 
 #include "database/database_common.hpp"
 #include "database/enum_conversions.hpp"
@@ -21,6 +22,7 @@
 
 #include <pkmn/exception.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <boost/thread/lock_guard.hpp>
 
@@ -149,6 +151,35 @@ namespace pkmn {
         return _p_native;
     }
 
+    void* item_bag_impl::get_native_if_dirty()
+    {
+        boost::lock_guard<item_bag_impl> lock(*this);
+
+        bool is_dirty = false;
+        for(const auto& item_pocket_iter: _item_pockets)
+        {
+            item_list_impl* p_pocket_impl = dynamic_cast<item_list_impl*>(
+                                                item_pocket_iter.second.get()
+                                            );
+            BOOST_ASSERT(p_pocket_impl != nullptr);
+
+            // Every pocket's flag needs to be cleared, so don't stop early.
+            if(p_pocket_impl->get_native_if_dirty() != nullptr)
+            {
+                is_dirty = true;
+            }
+        }
+
+        if(!is_dirty)
+        {
+            return nullptr;
+        }
+
+        _to_native();
+
+        return _p_native;
+    }
+
     // Skips creating item entry
     std::string item_bag_impl::_get_pocket_name(pkmn::e_item item)
     {
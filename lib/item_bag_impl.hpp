@@ -47,6 +47,12 @@ namespace pkmn {
 
             void* get_native() final;
 
+            // For internal use
+
+            // Returns the updated native representation if any pocket has
+            // changed since the last call, or nullptr otherwise.
+            void* get_native_if_dirty();
+
         protected:
             int _game_id;
             int _generation;
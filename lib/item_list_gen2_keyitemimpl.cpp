@@ -57,6 +57,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<item_list_gen2_keyitemimpl> lock(*this);
+        _is_dirty = true;
 
         /*
          * Check if this item is already in the list. If so, it cannot
@@ -100,6 +101,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<item_list_gen2_keyitemimpl> lock(*this);
+        _is_dirty = true;
 
         /*
          * Check if this item is in the list. If so, remove that amount,
@@ -131,6 +133,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Position", position, 0, end_boundary);
 
         boost::lock_guard<item_list_gen2_keyitemimpl> lock(*this);
+        _is_dirty = true;
 
         if(item == pkmn::e_item::NONE)
         {
@@ -104,6 +104,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Amount", amount, 1, 99);
 
         boost::lock_guard<item_list_gen2_tmhmimpl> lock(*this);
+        _is_dirty = true;
 
         pkmn::database::item_entry entry(item, get_game());
         if(entry.get_pocket() != get_name())
@@ -139,6 +140,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Amount", amount, 1, 99);
 
         boost::lock_guard<item_list_gen2_tmhmimpl> lock(*this);
+        _is_dirty = true;
 
         pkmn::database::item_entry entry(item, get_game());
         if(entry.get_pocket() != get_name())
@@ -182,6 +184,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Position", position, 0, end_boundary);
 
         boost::lock_guard<item_list_gen2_tmhmimpl> lock(*this);
+        _is_dirty = true;
 
         pkmn::database::item_entry entry(item, get_game());
         if((item != pkmn::e_item::NONE) && (entry.get_pocket() != get_name()))
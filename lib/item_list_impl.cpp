@@ -168,7 +168,8 @@ namespace pkmn {
        _version_group_id(pkmn::database::game_id_to_version_group(game_id)),
        _num_items(0),
        _pc(ITEM_LIST_ID_IS_PC(item_list_id)),
-       _p_native(nullptr)
+       _p_native(nullptr),
+       _is_dirty(false)
     {
         static BOOST_CONSTEXPR const char* capacity_query = \
             "SELECT capacity FROM libpkmn_item_lists WHERE id=? AND "
@@ -236,6 +237,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Amount", amount, 1, 99);
 
         boost::lock_guard<item_list_impl> lock(*this);
+        _is_dirty = true;
 
         /*
          * Check if this item is already in the list. If so, add to
@@ -300,6 +302,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Amount", amount, 1, 99);
 
         boost::lock_guard<item_list_impl> lock(*this);
+        _is_dirty = true;
 
         /*
          * Check if this item is in the list. If so, remove that amount,
@@ -356,6 +359,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<item_list_impl> lock(*this);
+        _is_dirty = true;
 
         pkmn::item_slot temp = _item_slots[old_position];
         _item_slots.erase(_item_slots.begin()+old_position);
@@ -374,6 +378,7 @@ namespace pkmn {
         pkmn::enforce_bounds("Position", position, 0, end_boundary);
 
         boost::lock_guard<item_list_impl> lock(*this);
+        _is_dirty = true;
 
         if(item == pkmn::e_item::NONE)
         {
@@ -479,6 +484,20 @@ namespace pkmn {
         return _p_native;
     }
 
+    void* item_list_impl::get_native_if_dirty()
+    {
+        boost::lock_guard<item_list_impl> lock(*this);
+
+        if(!_is_dirty)
+        {
+            return nullptr;
+        }
+
+        _is_dirty = false;
+
+        return _p_native;
+    }
+
     void item_list_impl::_get_valid_item_lists()
     {
         boost::lock_guard<item_list_impl> lock(*this);
@@ -494,18 +513,15 @@ namespace pkmn {
                     "(item_names.item_id=item_game_indices.item_id) WHERE item_game_indices.generation_id=? "
                     "AND item_names.name LIKE '%Berry'";
 
-                SQLite::Statement stmt(
-                    pkmn::database::get_connection(),
-                    berry_list_query.c_str()
-                );
-                stmt.bind(1, pkmn::database::game_id_to_generation(_game_id));
+                pkmn::database::cached_statement stmt(berry_list_query);
+                stmt->bind(1, pkmn::database::game_id_to_generation(_game_id));
 
-                while(stmt.executeStep())
+                while(stmt->executeStep())
                 {
                     _valid_items.emplace_back(
-                        static_cast<pkmn::e_item>(int(stmt.getColumn(0)))
+                        static_cast<pkmn::e_item>(int(stmt->getColumn(0)))
                     );
-                    _valid_item_names.emplace_back(stmt.getColumn(1));
+                    _valid_item_names.emplace_back(stmt->getColumn(1));
                 }
             }
             else
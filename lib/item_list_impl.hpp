@@ -20,7 +20,7 @@ namespace pkmn {
                           public boost::basic_lockable_adapter<boost::recursive_mutex>
     {
         public:
-            item_list_impl() {};
+            item_list_impl(): _is_dirty(false) {};
             item_list_impl(
                 int item_list_id,
                 int game_id
@@ -69,6 +69,12 @@ namespace pkmn {
 
             void* get_native() final;
 
+            // For internal use
+
+            // Returns the native representation if this list has changed
+            // since the last call, or nullptr otherwise.
+            void* get_native_if_dirty();
+
         protected:
             int _item_list_id, _game_id, _version_group_id;
             int _capacity, _num_items;
@@ -82,6 +88,9 @@ namespace pkmn {
 
             void* _p_native;
 
+            // Set by every function that changes the list.
+            bool _is_dirty;
+
             void _get_valid_item_lists();
 
             virtual void _from_native(
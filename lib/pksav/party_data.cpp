@@ -16,83 +16,417 @@
 #include <pksav/math/endian.h>
 
 #include <cstring>
+#include <map>
+#include <vector>
 
 namespace pksav {
 
-    void gen1_pc_pokemon_to_party_data(
-        const pkmn::database::pokemon_entry &entry,
-        const struct pksav_gen1_pc_pokemon* pc,
-        struct pksav_gen1_pokemon_party_data* party_data_out
-    ) {
-        std::memset(party_data_out, 0, sizeof(*party_data_out));
+    typedef std::vector<const pkmn::database::pokemon_entry*> entry_ptr_list_t;
+    typedef std::vector<const std::map<pkmn::e_stat, int>*> base_stats_ptr_list_t;
 
-        std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
+    // Structure-of-arrays inputs for calculating one stat for every
+    // Pokémon in a batch.
+    struct stat_inputs
+    {
+        std::vector<int> base_stats;
+        std::vector<int> EVs;
+        std::vector<int> IVs;
 
-        size_t exp = 0;
-        PKSAV_CALL(
-            pksav_import_base256(
-                pc->exp,
-                3,
-                &exp
-            );
+        explicit stat_inputs(
+            size_t num_pokemon
+        ): base_stats(num_pokemon),
+           EVs(num_pokemon),
+           IVs(num_pokemon)
+        {}
+
+        inline void set(
+            size_t pokemon_index,
+            int base_stat,
+            int EV,
+            int IV
         )
+        {
+            base_stats[pokemon_index] = base_stat;
+            EVs[pokemon_index] = EV;
+            IVs[pokemon_index] = IV;
+        }
+    };
+
+    static inline std::vector<int> get_gb_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const stat_inputs& inputs
+    )
+    {
+        return pkmn::calculations::get_gb_stats(
+                   stat,
+                   levels,
+                   inputs.base_stats,
+                   inputs.EVs,
+                   inputs.IVs
+               );
+    }
+
+    static inline std::vector<int> get_modern_stats(
+        pkmn::e_stat stat,
+        const std::vector<int>& levels,
+        const std::vector<float>& nature_modifiers,
+        const stat_inputs& inputs
+    )
+    {
+        return pkmn::calculations::get_modern_stats(
+                   stat,
+                   levels,
+                   nature_modifiers,
+                   inputs.base_stats,
+                   inputs.EVs,
+                   inputs.IVs
+               );
+    }
+
+    /*
+     * Database entries are looked up once for each species in a batch, since
+     * a box is likely to have the same species more than once.
+     */
+    class batch_entry_cache
+    {
+        public:
+            explicit batch_entry_cache(
+                int game_id
+            ): _game_id(game_id)
+            {}
+
+            void add(
+                int pokemon_index
+            )
+            {
+                auto entry_iter = _entries.find(pokemon_index);
+                if(entry_iter == _entries.end())
+                {
+                    entry_iter = _entries.emplace(
+                                     pokemon_index,
+                                     pkmn::database::pokemon_entry(pokemon_index, _game_id)
+                                 ).first;
+                    _base_stats.emplace(
+                        pokemon_index,
+                        entry_iter->second.get_base_stats()
+                    );
+                }
+
+                p_entries.emplace_back(&entry_iter->second);
+                p_base_stats.emplace_back(&_base_stats.at(pokemon_index));
+            }
+
+            entry_ptr_list_t p_entries;
+            base_stats_ptr_list_t p_base_stats;
+
+        private:
+            int _game_id;
+
+            std::map<int, pkmn::database::pokemon_entry> _entries;
+            std::map<int, std::map<pkmn::e_stat, int>> _base_stats;
+    };
+
+    static void gen1_pc_pokemon_to_party_data_batch(
+        const entry_ptr_list_t& p_entries,
+        const base_stats_ptr_list_t& p_base_stats,
+        const struct pksav_gen1_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen1_pokemon_party_data* p_party_data_out
+    )
+    {
+        const size_t num_pokemon = p_entries.size();
+
+        std::vector<int> levels(num_pokemon);
+        stat_inputs HP_inputs(num_pokemon);
+        stat_inputs attack_inputs(num_pokemon);
+        stat_inputs defense_inputs(num_pokemon);
+        stat_inputs speed_inputs(num_pokemon);
+        stat_inputs special_inputs(num_pokemon);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            const struct pksav_gen1_pc_pokemon* pc = &p_pc_pokemon[pokemon_index];
+            const std::map<pkmn::e_stat, int>& base_stats = *p_base_stats[pokemon_index];
+
+            size_t exp = 0;
+            PKSAV_CALL(
+                pksav_import_base256(
+                    pc->exp,
+                    3,
+                    &exp
+                );
+            )
 
-        party_data_out->level = uint8_t(entry.get_level_at_experience(int(exp)));
+            // The level is stored as a byte, so calculate stats from the
+            // stored value.
+            levels[pokemon_index] = uint8_t(p_entries[pokemon_index]->get_level_at_experience(int(exp)));
 
-        uint8_t IVs[PKSAV_NUM_GB_IVS] = {0};
-        PKSAV_CALL(
-            pksav_get_gb_IVs(
-                &pc->iv_data,
-                IVs,
-                sizeof(IVs)
+            uint8_t IVs[PKSAV_NUM_GB_IVS] = {0};
+            PKSAV_CALL(
+                pksav_get_gb_IVs(
+                    &pc->iv_data,
+                    IVs,
+                    sizeof(IVs)
+                );
+            )
+
+            HP_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::HP),
+                pksav_bigendian16(pc->ev_hp),
+                IVs[PKSAV_GB_IV_HP]
             );
-        )
+            attack_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::ATTACK),
+                pksav_bigendian16(pc->ev_atk),
+                IVs[PKSAV_GB_IV_ATTACK]
+            );
+            defense_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::DEFENSE),
+                pksav_bigendian16(pc->ev_def),
+                IVs[PKSAV_GB_IV_DEFENSE]
+            );
+            speed_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPEED),
+                pksav_bigendian16(pc->ev_spd),
+                IVs[PKSAV_GB_IV_SPEED]
+            );
+            special_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPECIAL),
+                pksav_bigendian16(pc->ev_spcl),
+                IVs[PKSAV_GB_IV_SPEED]
+            );
+        }
+
+        const std::vector<int> max_hps  = get_gb_stats(pkmn::e_stat::HP, levels, HP_inputs);
+        const std::vector<int> attacks  = get_gb_stats(pkmn::e_stat::ATTACK, levels, attack_inputs);
+        const std::vector<int> defenses = get_gb_stats(pkmn::e_stat::DEFENSE, levels, defense_inputs);
+        const std::vector<int> speeds   = get_gb_stats(pkmn::e_stat::SPEED, levels, speed_inputs);
+        const std::vector<int> specials = get_gb_stats(pkmn::e_stat::SPECIAL, levels, special_inputs);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            struct pksav_gen1_pokemon_party_data* party_data_out = &p_party_data_out[pokemon_index];
+            std::memset(party_data_out, 0, sizeof(*party_data_out));
+
+            party_data_out->level  = uint8_t(levels[pokemon_index]);
+            party_data_out->max_hp = pksav_bigendian16(uint16_t(max_hps[pokemon_index]));
+            party_data_out->atk    = pksav_bigendian16(uint16_t(attacks[pokemon_index]));
+            party_data_out->def    = pksav_bigendian16(uint16_t(defenses[pokemon_index]));
+            party_data_out->spd    = pksav_bigendian16(uint16_t(speeds[pokemon_index]));
+            party_data_out->spcl   = pksav_bigendian16(uint16_t(specials[pokemon_index]));
+        }
+    }
+
+    static void gen2_pc_pokemon_to_party_data_batch(
+        const base_stats_ptr_list_t& p_base_stats,
+        const struct pksav_gen2_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen2_pokemon_party_data* p_party_data_out
+    )
+    {
+        const size_t num_pokemon = p_base_stats.size();
+
+        std::vector<int> levels(num_pokemon);
+        stat_inputs HP_inputs(num_pokemon);
+        stat_inputs attack_inputs(num_pokemon);
+        stat_inputs defense_inputs(num_pokemon);
+        stat_inputs speed_inputs(num_pokemon);
+        stat_inputs special_attack_inputs(num_pokemon);
+        stat_inputs special_defense_inputs(num_pokemon);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            const struct pksav_gen2_pc_pokemon* pc = &p_pc_pokemon[pokemon_index];
+            const std::map<pkmn::e_stat, int>& base_stats = *p_base_stats[pokemon_index];
+
+            levels[pokemon_index] = pc->level;
+
+            uint8_t IVs[PKSAV_NUM_GB_IVS] = {0};
+            PKSAV_CALL(
+                pksav_get_gb_IVs(
+                    &pc->iv_data,
+                    IVs,
+                    sizeof(IVs)
+                );
+            )
+
+            HP_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::HP),
+                pksav_bigendian16(pc->ev_hp),
+                IVs[PKSAV_GB_IV_HP]
+            );
+            attack_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::ATTACK),
+                pksav_bigendian16(pc->ev_atk),
+                IVs[PKSAV_GB_IV_ATTACK]
+            );
+            defense_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::DEFENSE),
+                pksav_bigendian16(pc->ev_def),
+                IVs[PKSAV_GB_IV_DEFENSE]
+            );
+            speed_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPEED),
+                pksav_bigendian16(pc->ev_spd),
+                IVs[PKSAV_GB_IV_SPEED]
+            );
+            special_attack_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPECIAL_ATTACK),
+                pksav_bigendian16(pc->ev_spcl),
+                IVs[PKSAV_GB_IV_SPECIAL]
+            );
+            special_defense_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPECIAL_DEFENSE),
+                pksav_bigendian16(pc->ev_spcl),
+                IVs[PKSAV_GB_IV_SPECIAL]
+            );
+        }
+
+        const std::vector<int> max_hps          = get_gb_stats(pkmn::e_stat::HP, levels, HP_inputs);
+        const std::vector<int> attacks          = get_gb_stats(pkmn::e_stat::ATTACK, levels, attack_inputs);
+        const std::vector<int> defenses         = get_gb_stats(pkmn::e_stat::DEFENSE, levels, defense_inputs);
+        const std::vector<int> speeds           = get_gb_stats(pkmn::e_stat::SPEED, levels, speed_inputs);
+        const std::vector<int> special_attacks  = get_gb_stats(pkmn::e_stat::SPECIAL_ATTACK, levels, special_attack_inputs);
+        const std::vector<int> special_defenses = get_gb_stats(pkmn::e_stat::SPECIAL_DEFENSE, levels, special_defense_inputs);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            struct pksav_gen2_pokemon_party_data* party_data_out = &p_party_data_out[pokemon_index];
+            std::memset(party_data_out, 0, sizeof(*party_data_out));
+
+            party_data_out->current_hp = pksav_bigendian16(uint16_t(max_hps[pokemon_index]));
+            party_data_out->max_hp     = party_data_out->current_hp;
+            party_data_out->atk        = pksav_bigendian16(uint16_t(attacks[pokemon_index]));
+            party_data_out->def        = pksav_bigendian16(uint16_t(defenses[pokemon_index]));
+            party_data_out->spd        = pksav_bigendian16(uint16_t(speeds[pokemon_index]));
+            party_data_out->spatk      = pksav_bigendian16(uint16_t(special_attacks[pokemon_index]));
+            party_data_out->spdef      = pksav_bigendian16(uint16_t(special_defenses[pokemon_index]));
+        }
+    }
+
+    // TODO: nature modifiers
+    static void gba_pc_pokemon_to_party_data_batch(
+        const entry_ptr_list_t& p_entries,
+        const base_stats_ptr_list_t& p_base_stats,
+        const struct pksav_gba_pc_pokemon* p_pc_pokemon,
+        struct pksav_gba_pokemon_party_data* p_party_data_out
+    )
+    {
+        const size_t num_pokemon = p_entries.size();
+
+        std::vector<int> levels(num_pokemon);
+        std::vector<float> nature_modifiers(num_pokemon, 1.0f);
+        stat_inputs HP_inputs(num_pokemon);
+        stat_inputs attack_inputs(num_pokemon);
+        stat_inputs defense_inputs(num_pokemon);
+        stat_inputs speed_inputs(num_pokemon);
+        stat_inputs special_attack_inputs(num_pokemon);
+        stat_inputs special_defense_inputs(num_pokemon);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            const struct pksav_gba_pokemon_growth_block* growth = &p_pc_pokemon[pokemon_index].blocks.growth;
+            const struct pksav_gba_pokemon_effort_block* effort = &p_pc_pokemon[pokemon_index].blocks.effort;
+            const struct pksav_gba_pokemon_misc_block* misc = &p_pc_pokemon[pokemon_index].blocks.misc;
+            const std::map<pkmn::e_stat, int>& base_stats = *p_base_stats[pokemon_index];
+
+            // The level is stored as a byte, so calculate stats from the
+            // stored value.
+            levels[pokemon_index] = uint8_t(p_entries[pokemon_index]->get_level_at_experience(int(growth->exp)));
+
+            uint8_t IVs[PKSAV_NUM_IVS] = {0};
+            PKSAV_CALL(
+                pksav_get_IVs(
+                    &misc->iv_egg_ability,
+                    IVs,
+                    sizeof(IVs)
+                );
+            )
+
+            HP_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::HP),
+                effort->ev_hp,
+                IVs[PKSAV_IV_HP]
+            );
+            attack_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::ATTACK),
+                effort->ev_atk,
+                IVs[PKSAV_IV_ATTACK]
+            );
+            defense_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::DEFENSE),
+                effort->ev_def,
+                IVs[PKSAV_IV_DEFENSE]
+            );
+            speed_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPEED),
+                effort->ev_spd,
+                IVs[PKSAV_IV_SPEED]
+            );
+            special_attack_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPECIAL_ATTACK),
+                effort->ev_spatk,
+                IVs[PKSAV_IV_SPATK]
+            );
+            special_defense_inputs.set(
+                pokemon_index,
+                base_stats.at(pkmn::e_stat::SPECIAL_DEFENSE),
+                effort->ev_spdef,
+                IVs[PKSAV_IV_SPDEF]
+            );
+        }
+
+        const std::vector<int> max_hps          = get_modern_stats(pkmn::e_stat::HP, levels, nature_modifiers, HP_inputs);
+        const std::vector<int> attacks          = get_modern_stats(pkmn::e_stat::ATTACK, levels, nature_modifiers, attack_inputs);
+        const std::vector<int> defenses         = get_modern_stats(pkmn::e_stat::DEFENSE, levels, nature_modifiers, defense_inputs);
+        const std::vector<int> speeds           = get_modern_stats(pkmn::e_stat::SPEED, levels, nature_modifiers, speed_inputs);
+        const std::vector<int> special_attacks  = get_modern_stats(pkmn::e_stat::SPECIAL_ATTACK, levels, nature_modifiers, special_attack_inputs);
+        const std::vector<int> special_defenses = get_modern_stats(pkmn::e_stat::SPECIAL_DEFENSE, levels, nature_modifiers, special_defense_inputs);
+
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            struct pksav_gba_pokemon_party_data* party_data_out = &p_party_data_out[pokemon_index];
+            std::memset(party_data_out, 0, sizeof(*party_data_out));
+
+            party_data_out->level      = uint8_t(levels[pokemon_index]);
+            party_data_out->max_hp     = pksav_littleendian16(uint16_t(max_hps[pokemon_index]));
+            party_data_out->current_hp = party_data_out->max_hp;
+            party_data_out->atk        = pksav_littleendian16(uint16_t(attacks[pokemon_index]));
+            party_data_out->def        = pksav_littleendian16(uint16_t(defenses[pokemon_index]));
+            party_data_out->spd        = pksav_littleendian16(uint16_t(speeds[pokemon_index]));
+            party_data_out->spatk      = pksav_littleendian16(uint16_t(special_attacks[pokemon_index]));
+            party_data_out->spdef      = pksav_littleendian16(uint16_t(special_defenses[pokemon_index]));
+        }
+    }
 
-        party_data_out->max_hp = pksav_bigendian16(uint16_t(
-                                     pkmn::calculations::get_gb_stat(
-                                         pkmn::e_stat::HP,
-                                         party_data_out->level,
-                                         base_stats.at(pkmn::e_stat::HP),
-                                         pksav_bigendian16(pc->ev_hp),
-                                         IVs[PKSAV_GB_IV_HP]
-                                     )
-                                 ));
-        party_data_out->atk = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::ATTACK,
-                                      party_data_out->level,
-                                      base_stats.at(pkmn::e_stat::ATTACK),
-                                      pksav_bigendian16(pc->ev_atk),
-                                      IVs[PKSAV_GB_IV_ATTACK]
-                                  )
-                              ));
-        party_data_out->def = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::DEFENSE,
-                                      party_data_out->level,
-                                      base_stats.at(pkmn::e_stat::DEFENSE),
-                                      pksav_bigendian16(pc->ev_def),
-                                      IVs[PKSAV_GB_IV_DEFENSE]
-                                  )
-                              ));
-        party_data_out->spd = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::SPEED,
-                                      party_data_out->level,
-                                      base_stats.at(pkmn::e_stat::SPEED),
-                                      pksav_bigendian16(pc->ev_spd),
-                                      IVs[PKSAV_GB_IV_SPEED]
-                                  )
-                              ));
-        party_data_out->spcl = pksav_bigendian16(uint16_t(
-                                   pkmn::calculations::get_gb_stat(
-                                       pkmn::e_stat::SPECIAL,
-                                       party_data_out->level,
-                                       base_stats.at(pkmn::e_stat::SPECIAL),
-                                       pksav_bigendian16(pc->ev_spcl),
-                                       IVs[PKSAV_GB_IV_SPEED]
-                                   )
-                               ));
+    void gen1_pc_pokemon_to_party_data(
+        const pkmn::database::pokemon_entry &entry,
+        const struct pksav_gen1_pc_pokemon* pc,
+        struct pksav_gen1_pokemon_party_data* party_data_out
+    ) {
+        const std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
+
+        gen1_pc_pokemon_to_party_data_batch(
+            entry_ptr_list_t(1, &entry),
+            base_stats_ptr_list_t(1, &base_stats),
+            pc,
+            party_data_out
+        );
     }
 
     void gen2_pc_pokemon_to_party_data(
@@ -100,161 +434,88 @@ namespace pksav {
         const struct pksav_gen2_pc_pokemon* pc,
         struct pksav_gen2_pokemon_party_data* party_data_out
     ) {
-        std::memset(party_data_out, 0, sizeof(*party_data_out));
-
-        std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
+        const std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
 
-        uint8_t IVs[PKSAV_NUM_GB_IVS] = {0};
-        PKSAV_CALL(
-            pksav_get_gb_IVs(
-                &pc->iv_data,
-                IVs,
-                sizeof(IVs)
-            );
-        )
-        party_data_out->current_hp = pksav_bigendian16(uint16_t(
-                                         pkmn::calculations::get_gb_stat(
-                                             pkmn::e_stat::HP,
-                                             pc->level,
-                                             base_stats.at(pkmn::e_stat::HP),
-                                             pksav_bigendian16(pc->ev_hp),
-                                             IVs[PKSAV_GB_IV_HP]
-                                         )
-                                     ));
-        party_data_out->max_hp = party_data_out->current_hp;
-
-        party_data_out->atk = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::ATTACK,
-                                      pc->level,
-                                      base_stats.at(pkmn::e_stat::ATTACK),
-                                      pksav_bigendian16(pc->ev_atk),
-                                      IVs[PKSAV_GB_IV_ATTACK]
-                                  )
-                              ));
-        party_data_out->def = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::DEFENSE,
-                                      pc->level,
-                                      base_stats.at(pkmn::e_stat::DEFENSE),
-                                      pksav_bigendian16(pc->ev_def),
-                                      IVs[PKSAV_GB_IV_DEFENSE]
-                                  )
-                              ));
-        party_data_out->spd = pksav_bigendian16(uint16_t(
-                                  pkmn::calculations::get_gb_stat(
-                                      pkmn::e_stat::SPEED,
-                                      pc->level,
-                                      base_stats.at(pkmn::e_stat::SPEED),
-                                      pksav_bigendian16(pc->ev_spd),
-                                      IVs[PKSAV_GB_IV_SPEED]
-                                  )
-                              ));
-        party_data_out->spatk = pksav_bigendian16(uint16_t(
-                                    pkmn::calculations::get_gb_stat(
-                                        pkmn::e_stat::SPECIAL_ATTACK,
-                                        pc->level,
-                                        base_stats.at(pkmn::e_stat::SPECIAL_ATTACK),
-                                        pksav_bigendian16(pc->ev_spcl),
-                                        IVs[PKSAV_GB_IV_SPECIAL]
-                                    )
-                                ));
-        party_data_out->spdef = pksav_bigendian16(uint16_t(
-                                    pkmn::calculations::get_gb_stat(
-                                        pkmn::e_stat::SPECIAL_DEFENSE,
-                                        pc->level,
-                                        base_stats.at(pkmn::e_stat::SPECIAL_DEFENSE),
-                                        pksav_bigendian16(pc->ev_spcl),
-                                        IVs[PKSAV_GB_IV_SPECIAL]
-                                    )
-                                ));
+        gen2_pc_pokemon_to_party_data_batch(
+            base_stats_ptr_list_t(1, &base_stats),
+            pc,
+            party_data_out
+        );
     }
 
-    // TODO: nature modifiers
     void gba_pc_pokemon_to_party_data(
         const pkmn::database::pokemon_entry &entry,
         const struct pksav_gba_pc_pokemon* pc,
         struct pksav_gba_pokemon_party_data* party_data_out
     ) {
-        std::memset(party_data_out, 0, sizeof(*party_data_out));
+        const std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
 
-        std::map<pkmn::e_stat, int> base_stats = entry.get_base_stats();
+        gba_pc_pokemon_to_party_data_batch(
+            entry_ptr_list_t(1, &entry),
+            base_stats_ptr_list_t(1, &base_stats),
+            pc,
+            party_data_out
+        );
+    }
+
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gen1_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen1_pokemon_party_data* p_party_data_out
+    ) {
+        batch_entry_cache entry_cache(game_id);
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            entry_cache.add(p_pc_pokemon[pokemon_index].species);
+        }
+
+        gen1_pc_pokemon_to_party_data_batch(
+            entry_cache.p_entries,
+            entry_cache.p_base_stats,
+            p_pc_pokemon,
+            p_party_data_out
+        );
+    }
 
-        const struct pksav_gba_pokemon_growth_block* growth = &pc->blocks.growth;
-        const struct pksav_gba_pokemon_effort_block* effort = &pc->blocks.effort;
-        const struct pksav_gba_pokemon_misc_block* misc = &pc->blocks.misc;
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gen2_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen2_pokemon_party_data* p_party_data_out
+    ) {
+        batch_entry_cache entry_cache(game_id);
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            entry_cache.add(p_pc_pokemon[pokemon_index].species);
+        }
 
-        party_data_out->level = uint8_t(entry.get_level_at_experience(int(growth->exp)));
+        gen2_pc_pokemon_to_party_data_batch(
+            entry_cache.p_base_stats,
+            p_pc_pokemon,
+            p_party_data_out
+        );
+    }
 
-        uint8_t IVs[PKSAV_NUM_IVS] = {0};
-        PKSAV_CALL(
-            pksav_get_IVs(
-                &misc->iv_egg_ability,
-                IVs,
-                sizeof(IVs)
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gba_pc_pokemon* p_pc_pokemon,
+        struct pksav_gba_pokemon_party_data* p_party_data_out
+    ) {
+        batch_entry_cache entry_cache(game_id);
+        for(size_t pokemon_index = 0; pokemon_index < num_pokemon; ++pokemon_index)
+        {
+            entry_cache.add(
+                pksav_littleendian16(p_pc_pokemon[pokemon_index].blocks.growth.species)
             );
-        )
-        party_data_out->max_hp = pksav_littleendian16(uint16_t(
-                                     pkmn::calculations::get_modern_stat(
-                                         pkmn::e_stat::HP,
-                                         int(party_data_out->level),
-                                         1.0f,
-                                         base_stats.at(pkmn::e_stat::HP),
-                                         effort->ev_hp,
-                                         IVs[PKSAV_IV_HP]
-                                     )
-                                 ));
-        party_data_out->current_hp = party_data_out->max_hp;
-
-        party_data_out->atk = pksav_littleendian16(uint16_t(
-                                  pkmn::calculations::get_modern_stat(
-                                      pkmn::e_stat::ATTACK,
-                                      int(party_data_out->level),
-                                      1.0f,
-                                      base_stats.at(pkmn::e_stat::ATTACK),
-                                      effort->ev_atk,
-                                      IVs[PKSAV_IV_ATTACK]
-                                  )
-                              ));
-        party_data_out->def = pksav_littleendian16(uint16_t(
-                                  pkmn::calculations::get_modern_stat(
-                                      pkmn::e_stat::DEFENSE,
-                                      int(party_data_out->level),
-                                      1.0f,
-                                      base_stats.at(pkmn::e_stat::DEFENSE),
-                                      effort->ev_def,
-                                      IVs[PKSAV_IV_DEFENSE]
-                                  )
-                              ));
-        party_data_out->spd = pksav_littleendian16(uint16_t(
-                                  pkmn::calculations::get_modern_stat(
-                                      pkmn::e_stat::SPEED,
-                                      int(party_data_out->level),
-                                      1.0f,
-                                      base_stats.at(pkmn::e_stat::SPEED),
-                                      effort->ev_spd,
-                                      IVs[PKSAV_IV_SPEED]
-                                  )
-                              ));
-        party_data_out->spatk = pksav_littleendian16(uint16_t(
-                                    pkmn::calculations::get_modern_stat(
-                                        pkmn::e_stat::SPECIAL_ATTACK,
-                                        int(party_data_out->level),
-                                        1.0f,
-                                        base_stats.at(pkmn::e_stat::SPECIAL_ATTACK),
-                                        effort->ev_spatk,
-                                        IVs[PKSAV_IV_SPATK]
-                                    )
-                                ));
-        party_data_out->spdef = pksav_littleendian16(uint16_t(
-                                    pkmn::calculations::get_modern_stat(
-                                        pkmn::e_stat::SPECIAL_DEFENSE,
-                                        int(party_data_out->level),
-                                        1.0f,
-                                        base_stats.at(pkmn::e_stat::SPECIAL_DEFENSE),
-                                        effort->ev_spdef,
-                                        IVs[PKSAV_IV_SPDEF]
-                                    )
-                                ));
+        }
+
+        gba_pc_pokemon_to_party_data_batch(
+            entry_cache.p_entries,
+            entry_cache.p_base_stats,
+            p_pc_pokemon,
+            p_party_data_out
+        );
     }
 }
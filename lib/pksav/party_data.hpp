@@ -14,6 +14,8 @@
 
 #include <pkmn/database/pokemon_entry.hpp>
 
+#include <cstddef>
+
 namespace pksav {
 
     void gen1_pc_pokemon_to_party_data(
@@ -34,6 +36,33 @@ namespace pksav {
         struct pksav_gba_pokemon_party_data* party_data_out
     );
 
+    /*
+     * Fill in the party data for many Pokémon at once, such as a whole box.
+     * Each species's database entry is only looked up once, and each stat is
+     * calculated for the whole batch with pkmn::calculations::get_*_stats.
+     */
+
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gen1_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen1_pokemon_party_data* p_party_data_out
+    );
+
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gen2_pc_pokemon* p_pc_pokemon,
+        struct pksav_gen2_pokemon_party_data* p_party_data_out
+    );
+
+    void pc_pokemon_to_party_data(
+        int game_id,
+        size_t num_pokemon,
+        const struct pksav_gba_pc_pokemon* p_pc_pokemon,
+        struct pksav_gba_pokemon_party_data* p_party_data_out
+    );
+
 }
 
 #endif /* INCLUDED_PKMN_PKSAV_PARTY_DATA_HPP */
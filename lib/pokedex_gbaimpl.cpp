@@ -66,6 +66,9 @@ namespace pkmn
         _pksav_pokedex.p_nat_pokedex_unlockedB = &_nat_pokedex_unlockedB;
         _pksav_pokedex.p_nat_pokedex_unlockedC = &_nat_pokedex_unlockedC;
 
+        _p_seen_buffer   = _seen_buffer.data();
+        _p_caught_buffer = _owned_buffer.data();
+
         _p_native = &_pksav_pokedex;
     }
 
@@ -134,20 +137,4 @@ namespace pkmn
             );
         )
     }
-
-    void pokedex_gbaimpl::_update_all_seen()
-    {
-        _update_member_vector_with_pksav(
-            _pksav_pokedex.p_seenA,
-            _all_seen
-        );
-    }
-
-    void pokedex_gbaimpl::_update_all_caught()
-    {
-        _update_member_vector_with_pksav(
-            _pksav_pokedex.p_owned,
-            _all_caught
-        );
-    }
 }
@@ -56,9 +56,6 @@ namespace pkmn
                 int species_id,
                 bool has_caught_value
             ) final;
-
-            void _update_all_seen() final;
-            void _update_all_caught() final;
     };
 
 }
@@ -51,9 +51,6 @@ namespace pkmn
                 int species_id,
                 bool has_caught_value
             ) final;
-
-            void _update_all_seen() final;
-            void _update_all_caught() final;
     };
 
     typedef pokedex_gbimpl<struct pksav_gen1_pokedex_lists> pokedex_gen1impl;
@@ -54,6 +54,9 @@ namespace pkmn
         _pksav_pokedex.p_seen  = _seen_buffer.data();
         _pksav_pokedex.p_owned = _owned_buffer.data();
 
+        _p_seen_buffer   = _seen_buffer.data();
+        _p_caught_buffer = _owned_buffer.data();
+
         _p_native = &_pksav_pokedex;
     }
 
@@ -126,24 +129,6 @@ namespace pkmn
             );
         )
     }
-
-    template <typename pksav_type>
-    void pokedex_gbimpl<pksav_type>::_update_all_seen()
-    {
-        _update_member_vector_with_pksav(
-            _pksav_pokedex.p_seen,
-            _all_seen
-        );
-    }
-
-    template <typename pksav_type>
-    void pokedex_gbimpl<pksav_type>::_update_all_caught()
-    {
-        _update_member_vector_with_pksav(
-            _pksav_pokedex.p_owned,
-            _all_caught
-        );
-    }
 }
 
 #endif /* PKMN_POKEDEX_GBIMPL_IPP */
@@ -15,12 +15,8 @@
 #include "database/enum_conversions.hpp"
 #include "database/id_to_string.hpp"
 
-#include "pksav/pksav_call.hpp"
-
 #include <pkmn/exception.hpp>
 
-#include <pksav/common/pokedex.h>
-
 #include <boost/assert.hpp>
 #include <boost/thread/lock_guard.hpp>
 
@@ -76,15 +72,43 @@ namespace pkmn
         return ret;
     }
 
+    pkmn::species_set pokedex::get_seen_set()
+    {
+        pkmn::species_set seen_set;
+        for(pkmn::e_species species: get_all_seen())
+        {
+            seen_set.set(species, true);
+        }
+
+        return seen_set;
+    }
+
+    pkmn::species_set pokedex::get_caught_set()
+    {
+        pkmn::species_set caught_set;
+        for(pkmn::e_species species: get_all_caught())
+        {
+            caught_set.set(species, true);
+        }
+
+        return caught_set;
+    }
+
     pokedex_impl::pokedex_impl(
         int game_id
     ): _game_id(game_id),
        _generation(pkmn::database::game_id_to_generation(game_id)),
        _num_pokemon(GENERATION_POKEDEX_SIZES.at(_generation)),
-       _all_seen(),
+       _p_seen_buffer(nullptr),
+       _p_caught_buffer(nullptr),
+       _seen_set(),
        _dirty_seen(true),
-       _all_caught(),
+       _all_seen(),
+       _dirty_all_seen(true),
+       _caught_set(),
        _dirty_caught(true),
+       _all_caught(),
+       _dirty_all_caught(true),
        _p_native(nullptr)
     {}
 
@@ -111,7 +135,7 @@ namespace pkmn
             set_has_caught(species, false);
         }
 
-        // Next time get_all_seen() is called, the vector will update.
+        // Next time the seen Pokémon are needed, they'll be re-read.
         _dirty_seen = true;
     }
 
@@ -119,26 +143,32 @@ namespace pkmn
     {
         boost::lock_guard<pokedex_impl> lock(*this);
 
-        if(_dirty_seen)
+        _update_seen_set();
+        if(_dirty_all_seen)
         {
-            _update_all_seen();
-            _dirty_seen = false;
+            _all_seen = _seen_set.as_vector();
+            _dirty_all_seen = false;
         }
 
         return _all_seen;
     }
 
+    pkmn::species_set pokedex_impl::get_seen_set()
+    {
+        boost::lock_guard<pokedex_impl> lock(*this);
+
+        _update_seen_set();
+
+        return _seen_set;
+    }
+
     int pokedex_impl::get_num_seen()
     {
         boost::lock_guard<pokedex_impl> lock(*this);
 
-        if(_dirty_seen)
-        {
-            _update_all_seen();
-            _dirty_seen = false;
-        }
+        _update_seen_set();
 
-        return int(_all_seen.size());
+        return int(_seen_set.size());
     }
 
     void pokedex_impl::set_has_caught(
@@ -159,7 +189,7 @@ namespace pkmn
             set_has_seen(species, true);
         }
 
-        // Next time get_all_caught() is called, the vector will update.
+        // Next time the caught Pokémon are needed, they'll be re-read.
         _dirty_caught = true;
     }
 
@@ -167,26 +197,48 @@ namespace pkmn
     {
         boost::lock_guard<pokedex_impl> lock(*this);
 
-        if(_dirty_caught)
+        _update_caught_set();
+        if(_dirty_all_caught)
         {
-            _update_all_caught();
-            _dirty_caught = false;
+            _all_caught = _caught_set.as_vector();
+            _dirty_all_caught = false;
         }
 
         return _all_caught;
     }
 
+    pkmn::species_set pokedex_impl::get_caught_set()
+    {
+        boost::lock_guard<pokedex_impl> lock(*this);
+
+        _update_caught_set();
+
+        return _caught_set;
+    }
+
     int pokedex_impl::get_num_caught()
     {
         boost::lock_guard<pokedex_impl> lock(*this);
 
-        if(_dirty_caught)
+        _update_caught_set();
+
+        return int(_caught_set.size());
+    }
+
+    void pokedex_impl::add_caught(
+        const std::vector<pkmn::e_species>& species_list
+    )
+    {
+        boost::lock_guard<pokedex_impl> lock(*this);
+
+        for(pkmn::e_species species: species_list)
         {
-            _update_all_caught();
-            _dirty_caught = false;
+            _set_has_seen(static_cast<int>(species), true);
+            _set_has_caught(static_cast<int>(species), true);
         }
 
-        return int(_all_caught.size());
+        _dirty_seen = true;
+        _dirty_caught = true;
     }
 
     void* pokedex_impl::get_native()
@@ -196,30 +248,27 @@ namespace pkmn
         return _p_native;
     }
 
-    void pokedex_impl::_update_member_vector_with_pksav(
-        const uint8_t* native_list,
-        std::vector<pkmn::e_species>& member_vector
-    )
+    void pokedex_impl::_update_seen_set()
     {
-        BOOST_ASSERT(native_list != nullptr);
+        BOOST_ASSERT(_p_seen_buffer != nullptr);
+
+        if(_dirty_seen)
+        {
+            _seen_set = pkmn::species_set(_p_seen_buffer, _num_pokemon);
+            _dirty_seen = false;
+            _dirty_all_seen = true;
+        }
+    }
 
-        member_vector.clear();
+    void pokedex_impl::_update_caught_set()
+    {
+        BOOST_ASSERT(_p_caught_buffer != nullptr);
 
-        for(uint16_t pokedex_num = 1; pokedex_num <= _num_pokemon; ++pokedex_num)
+        if(_dirty_caught)
         {
-            bool is_bit_present = false;
-            PKSAV_CALL(
-                pksav_get_pokedex_bit(
-                    native_list,
-                    pokedex_num,
-                    &is_bit_present
-                );
-            )
-
-            if(is_bit_present)
-            {
-                member_vector.emplace_back(static_cast<pkmn::e_species>(pokedex_num));
-            }
+            _caught_set = pkmn::species_set(_p_caught_buffer, _num_pokemon);
+            _dirty_caught = false;
+            _dirty_all_caught = true;
         }
     }
 }
@@ -34,6 +34,8 @@ namespace pkmn
 
             const std::vector<pkmn::e_species>& get_all_seen() final;
 
+            pkmn::species_set get_seen_set() final;
+
             int get_num_seen() final;
 
             void set_has_caught(
@@ -43,27 +45,46 @@ namespace pkmn
 
             const std::vector<pkmn::e_species>& get_all_caught() final;
 
+            pkmn::species_set get_caught_set() final;
+
             int get_num_caught() final;
 
             void* get_native() final;
 
+            // For internal use
+
+            // Marks every given species as seen and caught, only re-reading
+            // the native buffers once afterward.
+            void add_caught(
+                const std::vector<pkmn::e_species>& species_list
+            );
+
         protected:
             int _game_id;
             int _generation;
             size_t _num_pokemon;
 
-            std::vector<pkmn::e_species> _all_seen;
+            // Set by each implementation to its native buffers, which store
+            // one bit per National Pokédex number.
+            const uint8_t* _p_seen_buffer;
+            const uint8_t* _p_caught_buffer;
+
+            // The sets are re-read from the native buffers after any change,
+            // and the vectors are only rebuilt when requested.
+            pkmn::species_set _seen_set;
             bool _dirty_seen;
+            std::vector<pkmn::e_species> _all_seen;
+            bool _dirty_all_seen;
 
-            std::vector<pkmn::e_species> _all_caught;
+            pkmn::species_set _caught_set;
             bool _dirty_caught;
+            std::vector<pkmn::e_species> _all_caught;
+            bool _dirty_all_caught;
 
             void* _p_native;
 
-            void _update_member_vector_with_pksav(
-                const uint8_t* native_list,
-                std::vector<pkmn::e_species>& member_vector
-            );
+            void _update_seen_set();
+            void _update_caught_set();
 
             virtual void _set_has_seen(
                 int species_id,
@@ -73,9 +94,6 @@ namespace pkmn
                 int species_id,
                 bool has_caught_value
             ) = 0;
-
-            virtual void _update_all_seen() = 0;
-            virtual void _update_all_caught() = 0;
     };
 }
 
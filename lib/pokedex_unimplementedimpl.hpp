@@ -52,6 +52,11 @@ namespace pkmn
                 return _all_seen;
             }
 
+            pkmn::species_set get_seen_set() final
+            {
+                return pkmn::species_set();
+            }
+
             int get_num_seen() final
             {
                 return 0;
@@ -76,6 +81,11 @@ namespace pkmn
                 return _all_caught;
             }
 
+            pkmn::species_set get_caught_set() final
+            {
+                return pkmn::species_set();
+            }
+
             int get_num_caught() final
             {
                 return 0;
@@ -9,7 +9,15 @@
 #include "pokemon_box_gbaimpl.hpp"
 #include "pokemon_gbaimpl.hpp"
 
+#include "conversions/gen3_conversions.hpp"
+
+#include "database/database_common.hpp"
+#include "database/id_to_index.hpp"
+
 #include "pksav/enum_maps.hpp"
+#include "pksav/party_data.hpp"
+
+#include "utils/misc.hpp"
 
 #include <pkmn/exception.hpp>
 
@@ -17,8 +25,10 @@
 
 #include <boost/thread/lock_guard.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
+#include <vector>
 
 static const std::string DEFAULT_WALLPAPER = "Forest";
 
@@ -67,6 +77,7 @@ namespace pkmn {
         );
 
         boost::lock_guard<pokemon_box_gbaimpl> lock(*this);
+        _is_dirty = true;
 
         _box_name = name;
     }
@@ -100,12 +111,15 @@ namespace pkmn {
         int max_index = get_capacity();
         pkmn::enforce_bounds("Box index", index, 0, max_index);
 
-        if(_pokemon_list.at(index)->get_native_pc_data() == new_pokemon->get_native_pc_data())
+        // An unmaterialized slot can't be shared with any existing Pokémon.
+        const pkmn::pokemon::sptr& current_pokemon = _pokemon_list.at(index);
+        if(current_pokemon && (current_pokemon->get_native_pc_data() == new_pokemon->get_native_pc_data()))
         {
             throw std::invalid_argument("Cannot set a Pokémon to itself.");
         }
 
         boost::lock_guard<pokemon_box_gbaimpl> lock(*this);
+        _is_dirty = true;
 
         // If the given Pokémon isn't from this box's game, convert it if we can.
         pkmn::pokemon::sptr actual_new_pokemon;
@@ -135,7 +149,7 @@ namespace pkmn {
             actual_new_pokemon->get_native_pc_data(),
             &_pksav_box.entries[index]
         );
-        _pokemon_list[index] = std::make_shared<pokemon_gbaimpl>(
+        _pokemon_list[index] = _make_pokemon<pokemon_gbaimpl>(
                                    &_pksav_box.entries[index],
                                    _game_id
                                );
@@ -154,6 +168,128 @@ namespace pkmn {
         }
     }
 
+    std::vector<int> pokemon_box_gbaimpl::transfer_from(
+        pokemon_box_impl& source_box
+    )
+    {
+        _enforce_transfer_source(source_box);
+
+        const int source_game_id = source_box.get_game_id();
+        const size_t capacity = size_t(get_capacity());
+
+        // Convert everything before touching this box so a Pokémon that
+        // can't be converted leaves it unchanged.
+        std::vector<struct pksav_gba_pc_pokemon> new_entries(capacity);
+        if(game_is_gamecube(source_game_id))
+        {
+            boost::lock_guard<pokemon_box_impl> source_lock(source_box);
+
+            const LibPkmGC::GC::PokemonBox* p_source_native =
+                static_cast<const LibPkmGC::GC::PokemonBox*>(source_box.get_native());
+            for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+            {
+                const LibPkmGC::GC::Pokemon* p_source_pokemon = p_source_native->pkm[pokemon_index];
+                if(p_source_pokemon->species > LibPkmGC::NoSpecies)
+                {
+                    pkmn::conversions::gcn_pokemon_to_gba_pc(
+                        p_source_pokemon,
+                        &new_entries[pokemon_index]
+                    );
+                    if(!pkmn::conversions::gcn_held_item_to_gba(
+                            p_source_pokemon,
+                            _game_id,
+                            &new_entries[pokemon_index]
+                       ))
+                    {
+                        throw std::invalid_argument("A Pokémon is holding an item not in this game.");
+                    }
+                }
+            }
+        }
+        else if(pkmn::database::game_id_to_generation(source_game_id) == 3)
+        {
+            {
+                boost::lock_guard<pokemon_box_impl> source_lock(source_box);
+
+                const struct pksav_gba_pokemon_box* p_source_native =
+                    static_cast<const struct pksav_gba_pokemon_box*>(source_box.get_native());
+                std::copy(
+                    p_source_native->entries,
+                    p_source_native->entries + capacity,
+                    new_entries.begin()
+                );
+            }
+
+            // Match to_game(), which sets the level met to the current level
+            // and records the game the Pokémon came from.
+            if(source_game_id != _game_id)
+            {
+                std::vector<struct pksav_gba_pokemon_party_data> party_data(capacity);
+                pksav::pc_pokemon_to_party_data(
+                    source_game_id,
+                    capacity,
+                    new_entries.data(),
+                    party_data.data()
+                );
+
+                const uint16_t source_game_index = uint16_t(
+                                                       pkmn::database::game_id_to_index(source_game_id)
+                                                   );
+                const int version_group_id = pkmn::database::game_id_to_version_group(_game_id);
+                for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+                {
+                    if(new_entries[pokemon_index].blocks.growth.species > 0)
+                    {
+                        // Not every GBA game has the same items.
+                        const int held_item_index = int(pksav_littleendian16(
+                                                            new_entries[pokemon_index].blocks.growth.held_item
+                                                        ));
+                        if((held_item_index > 0) &&
+                           !pkmn::database::item_index_valid(held_item_index, version_group_id))
+                        {
+                            throw std::invalid_argument("A Pokémon is holding an item not in this game.");
+                        }
+
+                        struct pksav_gba_pokemon_misc_block* p_misc_block =
+                            &new_entries[pokemon_index].blocks.misc;
+
+                        p_misc_block->origin_info &= ~PKSAV_GBA_POKEMON_LEVEL_MET_MASK;
+                        p_misc_block->origin_info |= uint16_t(party_data[pokemon_index].level);
+
+                        p_misc_block->origin_info &= ~PKSAV_GBA_POKEMON_ORIGIN_GAME_MASK;
+                        p_misc_block->origin_info |= (source_game_index << PKSAV_GBA_POKEMON_ORIGIN_GAME_OFFSET);
+                    }
+                }
+            }
+        }
+        else
+        {
+            throw std::invalid_argument("Generation III boxes can only receive Pokémon from Generation III games.");
+        }
+
+        boost::lock_guard<pokemon_box_gbaimpl> lock(*this);
+        _is_dirty = true;
+
+        std::vector<int> pokemon_indices;
+        for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+        {
+            const struct pksav_gba_pc_pokemon& r_entry = new_entries[pokemon_index];
+
+            _pksav_box.entries[pokemon_index] = r_entry;
+
+            // The new Pokémon will be created from this entry on first access.
+            _pokemon_list[pokemon_index].reset();
+
+            uint16_t species = pksav_littleendian16(r_entry.blocks.growth.species);
+            if((species > 0) && !(r_entry.blocks.misc.iv_egg_ability & PKSAV_GBA_POKEMON_EGG_MASK))
+            {
+                pokemon_indices.emplace_back(int(species));
+            }
+        }
+
+        return pokemon_indices;
+    }
+
     std::vector<std::string> get_valid_gba_wallpaper_names(pkmn::e_game game)
     {
         std::vector<std::string> valid_wallpaper_names =
@@ -204,26 +340,70 @@ namespace pkmn {
         );
 
         boost::lock_guard<pokemon_box_gbaimpl> lock(*this);
+        _is_dirty = true;
 
         _wallpaper = wallpaper;
     }
 
-    void pokemon_box_gbaimpl::_from_native()
+    pkmn::pokemon::sptr pokemon_box_gbaimpl::_pokemon_from_native(
+        int index
+    )
     {
-        int capacity = get_capacity();
+        return _pokemon_from_native(index, nullptr);
+    }
 
-        // This shouldn't resize if the vector is populated.
-        _pokemon_list.resize(capacity);
+    pkmn::pokemon::sptr pokemon_box_gbaimpl::_pokemon_from_native(
+        int index,
+        const struct pksav_gba_pokemon_party_data* p_party_data
+    )
+    {
+        return _make_pokemon<pokemon_gbaimpl>(
+                   &_pksav_box.entries[index],
+                   _game_id,
+                   p_party_data
+               );
+    }
 
-        for(int pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+    void pokemon_box_gbaimpl::_populate_all_pokemon()
+    {
+        std::vector<int> indices;
+        std::vector<struct pksav_gba_pc_pokemon> pc_pokemon;
+        for(int pokemon_index = 0;
+            pokemon_index < int(_pokemon_list.size());
+            ++pokemon_index)
         {
-            _pokemon_list[pokemon_index] = std::make_shared<pokemon_gbaimpl>(
-                                                &_pksav_box.entries[pokemon_index],
-                                                _game_id
-                                            );
+            if(!_pokemon_list[pokemon_index])
+            {
+                indices.emplace_back(pokemon_index);
+                pc_pokemon.emplace_back(_pksav_box.entries[pokemon_index]);
+            }
+        }
+
+        // Calculate every remaining Pokémon's stats in one batch rather
+        // than as each one is created.
+        std::vector<struct pksav_gba_pokemon_party_data> party_data(pc_pokemon.size());
+        pksav::pc_pokemon_to_party_data(
+            _game_id,
+            pc_pokemon.size(),
+            pc_pokemon.data(),
+            party_data.data()
+        );
+
+        for(size_t batch_index = 0; batch_index < indices.size(); ++batch_index)
+        {
+            _pokemon_list[indices[batch_index]] = _pokemon_from_native(
+                                                      indices[batch_index],
+                                                      &party_data[batch_index]
+                                                  );
         }
     }
 
+    void pokemon_box_gbaimpl::_from_native()
+    {
+        // Pokémon are created from the native entries on first access.
+        _pokemon_list.assign(get_capacity(), pkmn::pokemon::sptr());
+    }
+
     void pokemon_box_gbaimpl::_to_native()
     {
         BOOST_ASSERT(static_cast<size_t>(get_capacity()) == _pokemon_list.size());
@@ -232,10 +412,13 @@ namespace pkmn {
             pokemon_index < _pokemon_list.size();
             ++pokemon_index)
         {
-            pkmn::rcast_equal<struct pksav_gba_pc_pokemon>(
-                _pokemon_list[pokemon_index]->get_native_pc_data(),
-                &_pksav_box.entries[pokemon_index]
-            );
+            if(_pokemon_list[pokemon_index])
+            {
+                pkmn::rcast_equal<struct pksav_gba_pc_pokemon>(
+                    _pokemon_list[pokemon_index]->get_native_pc_data(),
+                    &_pksav_box.entries[pokemon_index]
+                );
+            }
         }
     }
 }
@@ -49,7 +49,22 @@ namespace pkmn {
                 const std::string& wallpaper
             ) final;
 
+            std::vector<int> transfer_from(
+                pokemon_box_impl& source_box
+            ) final;
+
         private:
+            pkmn::pokemon::sptr _pokemon_from_native(
+                int index
+            ) final;
+
+            pkmn::pokemon::sptr _pokemon_from_native(
+                int index,
+                const struct pksav_gba_pokemon_party_data* p_party_data
+            );
+
+            void _populate_all_pokemon() final;
+
             void _from_native() final;
             void _to_native() final;
 
@@ -60,10 +60,27 @@ namespace pkmn {
                 const std::string& wallpaper
             ) final;
 
+            std::vector<int> transfer_from(
+                pokemon_box_impl& source_box
+            ) final;
+
         private:
 
             list_type _pksav_box;
 
+            pkmn::pokemon::sptr _pokemon_from_native(
+                int index
+            ) final;
+
+            pkmn::pokemon::sptr _pokemon_from_native(
+                int index,
+                const pksav_pokemon_party_data_type* p_party_data
+            );
+
+            void _populate_all_pokemon() final;
+
+            void _clear_native();
+
             void _from_native() final;
             void _to_native() final;
     };
@@ -10,6 +10,9 @@
 
 #include "exception_internal.hpp"
 
+#include "database/database_common.hpp"
+
+#include "pksav/party_data.hpp"
 #include "pksav/pksav_call.hpp"
 
 #include <pkmn/exception.hpp>
@@ -24,6 +27,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 namespace pkmn {
 
@@ -39,23 +43,7 @@ namespace pkmn {
         }
         else
         {
-            std::memset(
-                &_pksav_box,
-                0,
-                sizeof(_pksav_box)
-            );
-            std::memset(
-                _pksav_box.nicknames,
-                0x50,
-                sizeof(_pksav_box.nicknames)
-            );
-            std::memset(
-                _pksav_box.otnames,
-                0x50,
-                sizeof(_pksav_box.otnames)
-            );
-
-            _pksav_box.species[get_capacity()-1] = 0xFF;
+            _clear_native();
         }
 
         _p_native = &_pksav_box;
@@ -97,6 +85,7 @@ namespace pkmn {
             );
 
             boost::lock_guard<POKEMON_BOX_GBIMPL_CLASS> lock(*this);
+            _is_dirty = true;
 
             _box_name = name;
         }
@@ -134,6 +123,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<POKEMON_BOX_GBIMPL_CLASS> lock(*this);
+        _is_dirty = true;
 
         // If the given Pokémon isn't from this box's game, convert it if we can.
         pkmn::pokemon::sptr actual_new_pokemon;
@@ -164,7 +154,7 @@ namespace pkmn {
             &_pksav_box.entries[index]
         );
 
-        _pokemon_list[index] = std::make_shared<libpkmn_pokemon_type>(
+        _pokemon_list[index] = _make_pokemon<libpkmn_pokemon_type>(
                                    &_pksav_box.entries[index],
                                    _game_id
                                );
@@ -255,6 +245,75 @@ namespace pkmn {
         }
     }
 
+    POKEMON_BOX_GBIMPL_TEMPLATE
+    std::vector<int> POKEMON_BOX_GBIMPL_CLASS::transfer_from(
+        pokemon_box_impl& source_box
+    )
+    {
+        _enforce_transfer_source(source_box);
+
+        const int source_game_id = source_box.get_game_id();
+        const int source_generation = pkmn::database::game_id_to_generation(source_game_id);
+        if(source_generation > 2)
+        {
+            throw std::invalid_argument("Generation I-II boxes can only receive Pokémon from Generation I-II games.");
+        }
+
+        // Generation I games share a format with nothing to fix up, so
+        // Pokémon from the same game or generation can be copied directly.
+        if((source_game_id == _game_id) || ((source_generation == 1) && (_generation == 1)))
+        {
+            list_type new_box;
+            {
+                boost::lock_guard<pokemon_box_impl> source_lock(source_box);
+
+                new_box = *static_cast<const list_type*>(source_box.get_native());
+            }
+
+            boost::lock_guard<POKEMON_BOX_GBIMPL_CLASS> lock(*this);
+            _is_dirty = true;
+
+            _pksav_box = new_box;
+            _from_native();
+        }
+        else
+        {
+            // Otherwise, fill a standalone box and copy it in once every
+            // Pokémon has been converted, so a Pokémon that can't be
+            // converted leaves this box unchanged. The standalone box has
+            // no Pokédex, so the caller updates it for the whole transfer.
+            const pkmn::pokemon_list_t& source_pokemon_list = source_box.as_vector();
+            const int num_source_pokemon = source_box.get_num_pokemon();
+
+            POKEMON_BOX_GBIMPL_CLASS new_box(_game_id);
+            for(int pokemon_index = 0; pokemon_index < num_source_pokemon; ++pokemon_index)
+            {
+                new_box.set_pokemon(
+                    pokemon_index,
+                    source_pokemon_list[pokemon_index]
+                );
+            }
+
+            boost::lock_guard<POKEMON_BOX_GBIMPL_CLASS> lock(*this);
+            _is_dirty = true;
+
+            _pksav_box = new_box._pksav_box;
+            _from_native();
+        }
+
+        std::vector<int> pokemon_indices;
+        for(size_t pokemon_index = 0; pokemon_index < _pksav_box.count; ++pokemon_index)
+        {
+            if((_pksav_box.entries[pokemon_index].species > 0) &&
+               (_pksav_box.species[pokemon_index] != GEN2_EGG_ID))
+            {
+                pokemon_indices.emplace_back(int(_pksav_box.entries[pokemon_index].species));
+            }
+        }
+
+        return pokemon_indices;
+    }
+
     POKEMON_BOX_GBIMPL_TEMPLATE
     std::string POKEMON_BOX_GBIMPL_CLASS::get_wallpaper()
     {
@@ -268,16 +327,129 @@ namespace pkmn {
     }
 
     POKEMON_BOX_GBIMPL_TEMPLATE
-    void POKEMON_BOX_GBIMPL_CLASS::_from_native()
+    pkmn::pokemon::sptr POKEMON_BOX_GBIMPL_CLASS::_pokemon_from_native(
+        int index
+    )
     {
-        int capacity = get_capacity();
+        return _pokemon_from_native(index, nullptr);
+    }
+
+    POKEMON_BOX_GBIMPL_TEMPLATE
+    pkmn::pokemon::sptr POKEMON_BOX_GBIMPL_CLASS::_pokemon_from_native(
+        int index,
+        const pksav_pokemon_party_data_type* p_party_data
+    )
+    {
+        pkmn::pokemon::sptr ret = _make_pokemon<libpkmn_pokemon_type>(
+                                      &_pksav_box.entries[index],
+                                      _game_id,
+                                      p_party_data
+                                  );
 
-        // This shouldn't resize if the vector is populated.
-        _pokemon_list.resize(capacity);
+        // In Generation II, whether or not a Pokémon is in an egg is
+        // stored in the list that stores it, not the Pokémon struct itself.
+        if(std::is_same<list_type, struct pksav_gen2_pokemon_box>::value)
+        {
+            ret->set_is_egg(
+                (_pksav_box.species[index] == GEN2_EGG_ID)
+            );
+        }
 
         char nickname[11] = {0};
         char otname[8] = {0};
 
+        PKSAV_CALL(
+            pksav_gen1_import_text(
+                _pksav_box.nicknames[index],
+                nickname,
+                10
+            );
+        )
+        if(std::strlen(nickname) > 0)
+        {
+            ret->set_nickname(nickname);
+        }
+
+        PKSAV_CALL(
+            pksav_gen1_import_text(
+                _pksav_box.otnames[index],
+                otname,
+                7
+            );
+        )
+        if(std::strlen(otname) > 0)
+        {
+            ret->set_original_trainer_name(otname);
+        }
+
+        return ret;
+    }
+
+    POKEMON_BOX_GBIMPL_TEMPLATE
+    void POKEMON_BOX_GBIMPL_CLASS::_populate_all_pokemon()
+    {
+        std::vector<int> indices;
+        std::vector<pksav_pc_pokemon_type> pc_pokemon;
+        for(int pokemon_index = 0;
+            pokemon_index < int(_pokemon_list.size());
+            ++pokemon_index)
+        {
+            if(!_pokemon_list[pokemon_index])
+            {
+                indices.emplace_back(pokemon_index);
+                pc_pokemon.emplace_back(_pksav_box.entries[pokemon_index]);
+            }
+        }
+
+        // Calculate every remaining Pokémon's stats in one batch rather
+        // than as each one is created.
+        std::vector<pksav_pokemon_party_data_type> party_data(pc_pokemon.size());
+        pksav::pc_pokemon_to_party_data(
+            _game_id,
+            pc_pokemon.size(),
+            pc_pokemon.data(),
+            party_data.data()
+        );
+
+        for(size_t batch_index = 0; batch_index < indices.size(); ++batch_index)
+        {
+            _pokemon_list[indices[batch_index]] = _pokemon_from_native(
+                                                      indices[batch_index],
+                                                      &party_data[batch_index]
+                                                  );
+        }
+    }
+
+    POKEMON_BOX_GBIMPL_TEMPLATE
+    void POKEMON_BOX_GBIMPL_CLASS::_clear_native()
+    {
+        std::memset(
+            &_pksav_box,
+            0,
+            sizeof(_pksav_box)
+        );
+        std::memset(
+            _pksav_box.nicknames,
+            0x50,
+            sizeof(_pksav_box.nicknames)
+        );
+        std::memset(
+            _pksav_box.otnames,
+            0x50,
+            sizeof(_pksav_box.otnames)
+        );
+
+        _pksav_box.species[get_capacity()-1] = 0xFF;
+    }
+
+    POKEMON_BOX_GBIMPL_TEMPLATE
+    void POKEMON_BOX_GBIMPL_CLASS::_from_native()
+    {
+        int capacity = get_capacity();
+
+        // Pokémon are created from the native entries on first access.
+        _pokemon_list.assign(capacity, pkmn::pokemon::sptr());
+
         int num_pokemon = get_num_pokemon();
 
         /*
@@ -296,57 +468,19 @@ namespace pkmn {
             }
         }
 
-        for(int i = 0; i < capacity; ++i)
+        /*
+         * Memory is not necessarily zeroed-out past the num_pokemon point,
+         * so we'll do it ourselves.
+         */
+        for(int i = num_pokemon; i < capacity; ++i)
         {
-            /*
-             * Memory is not necessarily zeroed-out past the num_pokemon point,
-             * so we'll do it ourselves.
-             */
-            if((i >= num_pokemon) && (_pksav_box.entries[i].species > 0))
+            if(_pksav_box.entries[i].species > 0)
             {
                 _pksav_box.species[i] = 0;
                 std::memset(&_pksav_box.entries[i], 0, sizeof(pksav_pc_pokemon_type));
                 std::memset(_pksav_box.nicknames[i], 0x50, sizeof(_pksav_box.nicknames[i]));
                 std::memset(_pksav_box.otnames[i], 0x50, sizeof(_pksav_box.otnames[i]));
             }
-
-            _pokemon_list[i] = std::make_shared<libpkmn_pokemon_type>(
-                                   &_pksav_box.entries[i],
-                                   _game_id
-                               );
-
-            // In Generation II, whether or not a Pokémon is in an egg is
-            // stored in the list that stores it, not the Pokémon struct itself.
-            if(std::is_same<list_type, struct pksav_gen2_pokemon_box>::value)
-            {
-                _pokemon_list[i]->set_is_egg(
-                    (_pksav_box.species[i] == GEN2_EGG_ID)
-                );
-            }
-
-            PKSAV_CALL(
-                pksav_gen1_import_text(
-                    _pksav_box.nicknames[i],
-                    nickname,
-                    10
-                );
-            )
-            if(std::strlen(nickname) > 0)
-            {
-                _pokemon_list[i]->set_nickname(nickname);
-            }
-
-            PKSAV_CALL(
-                pksav_gen1_import_text(
-                    _pksav_box.otnames[i],
-                    otname,
-                    7
-                );
-            )
-            if(std::strlen(otname) > 0)
-            {
-                _pokemon_list[i]->set_original_trainer_name(otname);
-            }
         }
     }
 
@@ -355,78 +489,88 @@ namespace pkmn {
     {
         BOOST_ASSERT(static_cast<size_t>(get_capacity()) == _pokemon_list.size());
 
-        std::memset(
-            _pksav_box.otnames,
-            0x50,
-            sizeof(_pksav_box.otnames)
-        );
-        std::memset(
-            _pksav_box.nicknames,
-            0x50,
-            sizeof(_pksav_box.nicknames)
-        );
-
         for(size_t pokemon_index = 0;
             pokemon_index < _pokemon_list.size();
             ++pokemon_index)
         {
-            pkmn::rcast_equal<pksav_pc_pokemon_type>(
-                _pokemon_list[pokemon_index]->get_native_pc_data(),
-                &_pksav_box.entries[pokemon_index]
-            );
+            bool is_materialized = bool(_pokemon_list[pokemon_index]);
 
-            // In Generation II, whether or not a Pokémon is in an egg is
-            // stored in the list that stores it, not the Pokémon struct itself.
-            if(std::is_same<list_type, struct pksav_gen2_pokemon_box>::value &&
-               _pokemon_list[pokemon_index]->is_egg())
-            {
-                _pksav_box.species[pokemon_index] = GEN2_EGG_ID;
-            }
-            else
+            // Slots that were never accessed are already up to date, other
+            // than clearing names past the end of the list.
+            if(is_materialized || (pokemon_index >= _pksav_box.count))
             {
-                _pksav_box.species[pokemon_index] =
-                    static_cast<uint8_t>(
-                        _pokemon_list[pokemon_index]->get_database_entry().get_pokemon_index()
-                    );
+                std::memset(
+                    _pksav_box.otnames[pokemon_index],
+                    0x50,
+                    sizeof(_pksav_box.otnames[pokemon_index])
+                );
+                std::memset(
+                    _pksav_box.nicknames[pokemon_index],
+                    0x50,
+                    sizeof(_pksav_box.nicknames[pokemon_index])
+                );
             }
 
-            // Even though this function is meant to update the native representation,
-            // the native count should have been updated along the way.
-            if(pokemon_index < _pksav_box.count)
+            if(is_materialized)
             {
-                if(std::is_same<list_type, struct pksav_gen1_pokemon_box>::value)
+                pkmn::rcast_equal<pksav_pc_pokemon_type>(
+                    _pokemon_list[pokemon_index]->get_native_pc_data(),
+                    &_pksav_box.entries[pokemon_index]
+                );
+
+                // In Generation II, whether or not a Pokémon is in an egg is
+                // stored in the list that stores it, not the Pokémon struct itself.
+                if(std::is_same<list_type, struct pksav_gen2_pokemon_box>::value &&
+                   _pokemon_list[pokemon_index]->is_egg())
                 {
-                    PKSAV_CALL(
-                        pksav_gen1_export_text(
-                            _pokemon_list[pokemon_index]->get_original_trainer_name().c_str(),
-                            _pksav_box.otnames[pokemon_index],
-                            PKSAV_GEN1_POKEMON_OTNAME_LENGTH
-                        );
-                    )
-                    PKSAV_CALL(
-                        pksav_gen1_export_text(
-                            _pokemon_list[pokemon_index]->get_nickname().c_str(),
-                            _pksav_box.nicknames[pokemon_index],
-                            PKSAV_GEN1_POKEMON_NICKNAME_LENGTH
-                        );
-                    )
+                    _pksav_box.species[pokemon_index] = GEN2_EGG_ID;
                 }
                 else
                 {
-                    PKSAV_CALL(
-                        pksav_gen2_export_text(
-                            _pokemon_list[pokemon_index]->get_original_trainer_name().c_str(),
-                            _pksav_box.otnames[pokemon_index],
-                            PKSAV_GEN2_POKEMON_OTNAME_LENGTH
+                    _pksav_box.species[pokemon_index] =
+                        static_cast<uint8_t>(
+                            _pokemon_list[pokemon_index]->get_database_entry().get_pokemon_index()
                         );
-                    )
-                    PKSAV_CALL(
-                        pksav_gen2_export_text(
-                            _pokemon_list[pokemon_index]->get_nickname().c_str(),
-                            _pksav_box.nicknames[pokemon_index],
-                            PKSAV_GEN2_POKEMON_NICKNAME_LENGTH
-                        );
-                    )
+                }
+
+                // Even though this function is meant to update the native representation,
+                // the native count should have been updated along the way.
+                if(pokemon_index < _pksav_box.count)
+                {
+                    if(std::is_same<list_type, struct pksav_gen1_pokemon_box>::value)
+                    {
+                        PKSAV_CALL(
+                            pksav_gen1_export_text(
+                                _pokemon_list[pokemon_index]->get_original_trainer_name().c_str(),
+                                _pksav_box.otnames[pokemon_index],
+                                PKSAV_GEN1_POKEMON_OTNAME_LENGTH
+                            );
+                        )
+                        PKSAV_CALL(
+                            pksav_gen1_export_text(
+                                _pokemon_list[pokemon_index]->get_nickname().c_str(),
+                                _pksav_box.nicknames[pokemon_index],
+                                PKSAV_GEN1_POKEMON_NICKNAME_LENGTH
+                            );
+                        )
+                    }
+                    else
+                    {
+                        PKSAV_CALL(
+                            pksav_gen2_export_text(
+                                _pokemon_list[pokemon_index]->get_original_trainer_name().c_str(),
+                                _pksav_box.otnames[pokemon_index],
+                                PKSAV_GEN2_POKEMON_OTNAME_LENGTH
+                            );
+                        )
+                        PKSAV_CALL(
+                            pksav_gen2_export_text(
+                                _pokemon_list[pokemon_index]->get_nickname().c_str(),
+                                _pksav_box.nicknames[pokemon_index],
+                                PKSAV_GEN2_POKEMON_NICKNAME_LENGTH
+                            );
+                        )
+                    }
                 }
             }
         }
@@ -9,12 +9,23 @@
 #include "pokemon_box_gcnimpl.hpp"
 #include "pokemon_gcnimpl.hpp"
 
+#include "conversions/gen3_conversions.hpp"
+
+#include "database/database_common.hpp"
+
+#include "pksav/party_data.hpp"
+
+#include "utils/misc.hpp"
+
 #include <pkmn/exception.hpp>
 
 #include <boost/assert.hpp>
 #include <boost/thread/lock_guard.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 namespace pkmn
 {
@@ -64,6 +75,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_box_gcnimpl> lock(*this);
+        _is_dirty = true;
 
         _libpkmgc_box_uptr->name->fromUTF8(name.c_str());
     }
@@ -97,12 +109,15 @@ namespace pkmn
         int max_index = get_capacity();
         pkmn::enforce_bounds("Box index", index, 0, max_index);
 
-        if(_pokemon_list.at(index)->get_native_pc_data() == new_pokemon->get_native_pc_data())
+        // An unmaterialized slot can't be shared with any existing Pokémon.
+        const pkmn::pokemon::sptr& current_pokemon = _pokemon_list.at(index);
+        if(current_pokemon && (current_pokemon->get_native_pc_data() == new_pokemon->get_native_pc_data()))
         {
             throw std::invalid_argument("Cannot set a Pokémon to itself.");
         }
 
         boost::lock_guard<pokemon_box_gcnimpl> lock(*this);
+        _is_dirty = true;
 
         // If the given Pokémon isn't from this box's game, convert it if we can.
         pkmn::pokemon::sptr actual_new_pokemon;
@@ -134,7 +149,7 @@ namespace pkmn
             static_cast<LibPkmGC::GC::Pokemon*>(
                 actual_new_pokemon->get_native_pc_data()
             )->clone();
-        _pokemon_list[index] = std::make_shared<pokemon_gcnimpl>(
+        _pokemon_list[index] = _make_pokemon<pokemon_gcnimpl>(
                                    dynamic_cast<LibPkmGC::GC::Pokemon*>(
                                        _libpkmgc_box_uptr->pkm[index]
                                    ),
@@ -142,6 +157,127 @@ namespace pkmn
                                );
     }
 
+    std::vector<int> pokemon_box_gcnimpl::transfer_from(
+        pokemon_box_impl& source_box
+    )
+    {
+        _enforce_transfer_source(source_box);
+
+        const int source_game_id = source_box.get_game_id();
+        const size_t capacity = size_t(get_capacity());
+
+        // Convert everything before touching this box so a Pokémon that
+        // can't be converted leaves it unchanged.
+        std::vector<std::unique_ptr<LibPkmGC::GC::Pokemon>> new_pokemon(capacity);
+        for(std::unique_ptr<LibPkmGC::GC::Pokemon>& r_new_pokemon: new_pokemon)
+        {
+            if(_game_id == COLOSSEUM_ID)
+            {
+                r_new_pokemon.reset(new LibPkmGC::Colosseum::Pokemon);
+            }
+            else
+            {
+                r_new_pokemon.reset(new LibPkmGC::XD::Pokemon);
+            }
+        }
+
+        if(source_game_id == _game_id)
+        {
+            boost::lock_guard<pokemon_box_impl> source_lock(source_box);
+
+            const LibPkmGC::GC::PokemonBox* p_source_native =
+                static_cast<const LibPkmGC::GC::PokemonBox*>(source_box.get_native());
+            for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+            {
+                new_pokemon[pokemon_index].reset(p_source_native->pkm[pokemon_index]->clone());
+            }
+        }
+        else if(game_is_gamecube(source_game_id))
+        {
+            // Colosseum and XD store some indices differently, so go through
+            // each Pokémon's own conversion.
+            const pkmn::pokemon_list_t& source_pokemon_list = source_box.as_vector();
+            for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+            {
+                const pkmn::pokemon::sptr& source_pokemon = source_pokemon_list[pokemon_index];
+                if(source_pokemon->get_species() != pkmn::e_species::NONE)
+                {
+                    pkmn::pokemon::sptr converted_pokemon = source_pokemon->to_game(get_game());
+                    new_pokemon[pokemon_index].reset(
+                        static_cast<LibPkmGC::GC::Pokemon*>(
+                            converted_pokemon->get_native_pc_data()
+                        )->clone()
+                    );
+                }
+            }
+        }
+        else if(pkmn::database::game_id_to_generation(source_game_id) == 3)
+        {
+            std::vector<struct pksav_gba_pc_pokemon> pc_data(capacity);
+            {
+                boost::lock_guard<pokemon_box_impl> source_lock(source_box);
+
+                const struct pksav_gba_pokemon_box* p_source_native =
+                    static_cast<const struct pksav_gba_pokemon_box*>(source_box.get_native());
+                std::copy(
+                    p_source_native->entries,
+                    p_source_native->entries + capacity,
+                    pc_data.begin()
+                );
+            }
+
+            // Match to_game(), which converts from the party representation,
+            // but calculate every Pokémon's party data in one batch.
+            std::vector<struct pksav_gba_pokemon_party_data> party_data(capacity);
+            pksav::pc_pokemon_to_party_data(
+                source_game_id,
+                capacity,
+                pc_data.data(),
+                party_data.data()
+            );
+
+            for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+            {
+                if(pc_data[pokemon_index].blocks.growth.species > 0)
+                {
+                    struct pksav_gba_party_pokemon source_pokemon;
+                    source_pokemon.pc_data = pc_data[pokemon_index];
+                    source_pokemon.party_data = party_data[pokemon_index];
+
+                    pkmn::conversions::gba_party_pokemon_to_gcn(
+                        &source_pokemon,
+                        new_pokemon[pokemon_index].get()
+                    );
+                }
+            }
+        }
+        else
+        {
+            throw std::invalid_argument("Generation III boxes can only receive Pokémon from Generation III games.");
+        }
+
+        boost::lock_guard<pokemon_box_gcnimpl> lock(*this);
+        _is_dirty = true;
+
+        std::vector<int> pokemon_indices;
+        for(size_t pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+        {
+            delete _libpkmgc_box_uptr->pkm[pokemon_index];
+            _libpkmgc_box_uptr->pkm[pokemon_index] = new_pokemon[pokemon_index].release();
+
+            // The new Pokémon will be created from this entry on first access.
+            _pokemon_list[pokemon_index].reset();
+
+            const LibPkmGC::GC::Pokemon* p_pokemon = _libpkmgc_box_uptr->pkm[pokemon_index];
+            if((p_pokemon->species > LibPkmGC::NoSpecies) && !p_pokemon->isEgg())
+            {
+                pokemon_indices.emplace_back(int(p_pokemon->species));
+            }
+        }
+
+        return pokemon_indices;
+    }
+
     std::string pokemon_box_gcnimpl::get_wallpaper()
     {
         throw pkmn::feature_not_in_game_error("Box wallpaper", get_game());
@@ -152,24 +288,22 @@ namespace pkmn
         throw pkmn::feature_not_in_game_error("Box wallpaper", get_game());
     }
 
-    void pokemon_box_gcnimpl::_from_native()
+    pkmn::pokemon::sptr pokemon_box_gcnimpl::_pokemon_from_native(
+        int index
+    )
     {
-        size_t capacity = get_capacity();
-
-        // This shouldn't resize if the vector is populated.
-        _pokemon_list.resize(capacity);
+        return _make_pokemon<pokemon_gcnimpl>(
+                   dynamic_cast<LibPkmGC::GC::Pokemon*>(
+                       _libpkmgc_box_uptr->pkm[index]
+                   ),
+                   _game_id
+               );
+    }
 
-        for(size_t pokemon_index = 0;
-            pokemon_index < capacity;
-            ++pokemon_index)
-        {
-            _pokemon_list[pokemon_index] = std::make_shared<pokemon_gcnimpl>(
-                                               dynamic_cast<LibPkmGC::GC::Pokemon*>(
-                                                   _libpkmgc_box_uptr->pkm[pokemon_index]
-                                               ),
-                                               _game_id
-                                           );
-        }
+    void pokemon_box_gcnimpl::_from_native()
+    {
+        // Pokémon are created from the native entries on first access.
+        _pokemon_list.assign(get_capacity(), pkmn::pokemon::sptr());
     }
 
     void pokemon_box_gcnimpl::_to_native()
@@ -180,19 +314,23 @@ namespace pkmn
             pokemon_index < _pokemon_list.size();
             ++pokemon_index)
         {
-            if(_game_id == COLOSSEUM_ID)
-            {
-                pkmn::rcast_equal<LibPkmGC::Colosseum::Pokemon>(
-                    _pokemon_list[pokemon_index]->get_native_pc_data(),
-                    _libpkmgc_box_uptr->pkm[pokemon_index]
-                );
-            }
-            else
+            // Slots that were never accessed are already up to date.
+            if(_pokemon_list[pokemon_index])
             {
-                pkmn::rcast_equal<LibPkmGC::XD::Pokemon>(
-                    _pokemon_list[pokemon_index]->get_native_pc_data(),
-                    _libpkmgc_box_uptr->pkm[pokemon_index]
-                );
+                if(_game_id == COLOSSEUM_ID)
+                {
+                    pkmn::rcast_equal<LibPkmGC::Colosseum::Pokemon>(
+                        _pokemon_list[pokemon_index]->get_native_pc_data(),
+                        _libpkmgc_box_uptr->pkm[pokemon_index]
+                    );
+                }
+                else
+                {
+                    pkmn::rcast_equal<LibPkmGC::XD::Pokemon>(
+                        _pokemon_list[pokemon_index]->get_native_pc_data(),
+                        _libpkmgc_box_uptr->pkm[pokemon_index]
+                    );
+                }
             }
         }
     }
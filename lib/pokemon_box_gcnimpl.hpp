@@ -46,10 +46,18 @@ namespace pkmn {
                 const std::string& wallpaper
             ) final;
 
+            std::vector<int> transfer_from(
+                pokemon_box_impl& source_box
+            ) final;
+
         private:
 
             std::unique_ptr<LibPkmGC::GC::PokemonBox> _libpkmgc_box_uptr;
 
+            pkmn::pokemon::sptr _pokemon_from_native(
+                int index
+            ) final;
+
             void _from_native() final;
             void _to_native() final;
     };
@@ -14,6 +14,7 @@
 #include "database/database_common.hpp"
 #include "database/enum_conversions.hpp"
 #include "database/id_to_string.hpp"
+#include "database/query_instrumentation.hpp"
 
 #include "utils/misc.hpp"
 
@@ -62,7 +63,8 @@ namespace pkmn {
        _box_name(""),
        _p_native(nullptr),
        _game_id(game_id),
-       _generation(pkmn::database::game_id_to_generation(game_id))
+       _generation(pkmn::database::game_id_to_generation(game_id)),
+       _is_dirty(false)
     {}
 
     pkmn::e_game pokemon_box_impl::get_game()
@@ -74,18 +76,24 @@ namespace pkmn {
         int index
     )
     {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon_box::get_pokemon");
+
         int capacity = get_capacity();
         pkmn::enforce_bounds("Box index", index, 0, (capacity-1));
 
         boost::lock_guard<pokemon_box_impl> lock(*this);
 
-        return _pokemon_list.at(index);
+        return _get_pokemon_at(index);
     }
 
     const pkmn::pokemon_list_t& pokemon_box_impl::as_vector()
     {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon_box::as_vector");
+
         boost::lock_guard<pokemon_box_impl> lock(*this);
 
+        _populate_all_pokemon();
+
         return _pokemon_list;
     }
 
@@ -97,4 +105,66 @@ namespace pkmn {
 
         return _p_native;
     }
+
+    void* pokemon_box_impl::get_native_if_dirty()
+    {
+        boost::lock_guard<pokemon_box_impl> lock(*this);
+
+        bool is_dirty = _is_dirty;
+        for(const pkmn::pokemon::sptr& pokemon: _pokemon_list)
+        {
+            // Every Pokémon's flag needs to be cleared, so don't stop early.
+            if(pokemon && pkmn::clear_pokemon_dirty(pokemon))
+            {
+                is_dirty = true;
+            }
+        }
+
+        if(!is_dirty)
+        {
+            return nullptr;
+        }
+
+        _to_native();
+        _is_dirty = false;
+
+        return _p_native;
+    }
+
+    const pkmn::pokemon::sptr& pokemon_box_impl::_get_pokemon_at(
+        int index
+    )
+    {
+        pkmn::pokemon::sptr& r_pokemon = _pokemon_list.at(index);
+        if(!r_pokemon)
+        {
+            r_pokemon = _pokemon_from_native(index);
+        }
+
+        return r_pokemon;
+    }
+
+    void pokemon_box_impl::_populate_all_pokemon()
+    {
+        for(int pokemon_index = 0;
+            pokemon_index < int(_pokemon_list.size());
+            ++pokemon_index)
+        {
+            _get_pokemon_at(pokemon_index);
+        }
+    }
+
+    void pokemon_box_impl::_enforce_transfer_source(
+        pokemon_box_impl& source_box
+    )
+    {
+        if(&source_box == this)
+        {
+            throw std::invalid_argument("Cannot transfer a box to itself.");
+        }
+        if(source_box.get_capacity() != get_capacity())
+        {
+            throw std::invalid_argument("Pokémon can only be transferred between boxes of the same capacity.");
+        }
+    }
 }
@@ -7,6 +7,7 @@
 #ifndef PKMN_POKEMON_BOX_IMPL_HPP
 #define PKMN_POKEMON_BOX_IMPL_HPP
 
+#include "types/arena.hpp"
 #include "utils/misc.hpp"
 
 #include "pokemon_impl.hpp"
@@ -17,7 +18,10 @@
 #include <boost/thread/lockable_adapter.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace pkmn {
 
@@ -25,7 +29,7 @@ namespace pkmn {
                             public boost::basic_lockable_adapter<boost::recursive_mutex>
     {
         public:
-            pokemon_box_impl() {}
+            pokemon_box_impl(): _is_dirty(false) {}
             explicit pokemon_box_impl(
                 int game_id
             );
@@ -51,16 +55,93 @@ namespace pkmn {
                 _pokedex = pokedex;
             }
 
+            // Returns the updated native representation if anything in this
+            // box has changed since the last call, or nullptr otherwise.
+            void* get_native_if_dirty();
+
+            inline void set_arena(
+                const pkmn::arena::sptr& arena_sptr
+            )
+            {
+                _arena = arena_sptr;
+            }
+
+            inline int get_game_id() const
+            {
+                return _game_id;
+            }
+
+            /*
+             * Replaces every Pokémon in this box with a copy of the Pokémon
+             * in the same slot of the given box, converted to this box's
+             * game. Where possible, this converts the native entries
+             * directly instead of going through pkmn::pokemon objects.
+             *
+             * Nothing is changed if any Pokémon can't be converted. This
+             * doesn't touch the Pokédex, but it returns the index of every
+             * Pokémon copied in that isn't an egg so the caller can update
+             * it once for many boxes.
+             */
+            virtual std::vector<int> transfer_from(
+                pokemon_box_impl& source_box
+            ) = 0;
+
         protected:
+            // Slots are only populated when first accessed, so a null
+            // entry means the native entry is still authoritative.
             pkmn::pokemon_list_t _pokemon_list;
             std::string _box_name;
 
             pkmn::pokedex::sptr _pokedex;
 
+            // If set, Pokémon created from native entries are placed here.
+            pkmn::arena::sptr _arena;
+
             void* _p_native;
 
             int _game_id, _generation;
 
+            // Set by anything that changes the box itself. Changes to its
+            // Pokémon are tracked by each Pokémon.
+            bool _is_dirty;
+
+            // Must be called with the box locked.
+            const pkmn::pokemon::sptr& _get_pokemon_at(
+                int index
+            );
+
+            template <typename libpkmn_pokemon_type, typename... args_type>
+            std::shared_ptr<libpkmn_pokemon_type> _make_pokemon(
+                args_type&&... args
+            )
+            {
+                if(_arena)
+                {
+                    return std::allocate_shared<libpkmn_pokemon_type>(
+                               pkmn::arena_allocator<libpkmn_pokemon_type>(_arena),
+                               std::forward<args_type>(args)...
+                           );
+                }
+                else
+                {
+                    return std::make_shared<libpkmn_pokemon_type>(
+                               std::forward<args_type>(args)...
+                           );
+                }
+            }
+
+            virtual pkmn::pokemon::sptr _pokemon_from_native(
+                int index
+            ) = 0;
+
+            // Populates every slot not yet accessed. Implementations can
+            // override this to create them in bulk.
+            virtual void _populate_all_pokemon();
+
+            void _enforce_transfer_source(
+                pokemon_box_impl& source_box
+            );
+
             virtual void _from_native() = 0;
             virtual void _to_native() = 0;
     };
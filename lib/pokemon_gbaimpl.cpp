@@ -162,7 +162,8 @@ namespace pkmn
 
     pokemon_gbaimpl::pokemon_gbaimpl(
         const struct pksav_gba_pc_pokemon* p_pc_pokemon,
-        int game_id
+        int game_id,
+        const struct pksav_gba_pokemon_party_data* p_party_data
     ): pokemon_impl(
            pksav_littleendian16(p_pc_pokemon->blocks.growth.species),
            game_id
@@ -171,7 +172,14 @@ namespace pkmn
         BOOST_ASSERT(p_pc_pokemon != nullptr);
 
         _pksav_pokemon.pc_data = *p_pc_pokemon;
-        _populate_party_data();
+        if(p_party_data != nullptr)
+        {
+            _pksav_pokemon.party_data = *p_party_data;
+        }
+        else
+        {
+            _populate_party_data();
+        }
 
         // Set block pointers
         _p_growth_block  = &_pksav_pokemon.pc_data.blocks.growth;
@@ -295,6 +303,28 @@ namespace pkmn
         return ret;
     }
 
+    pokemon::sptr pokemon_gbaimpl::snapshot()
+    {
+        boost::lock_guard<pokemon_gbaimpl> lock(*this);
+
+        std::shared_ptr<pokemon_gbaimpl> ret = std::make_shared<pokemon_gbaimpl>(
+                                                   &_pksav_pokemon,
+                                                   _database_entry.get_game_id()
+                                               );
+
+        // The constructor sets an Unown's personality from the default form,
+        // so restore both.
+        if(_database_entry.get_species_id() == UNOWN_ID)
+        {
+            ret->_database_entry = _database_entry;
+            ret->_pksav_pokemon.pc_data.personality = _pksav_pokemon.pc_data.personality;
+        }
+
+        ret->_make_read_only();
+
+        return ret;
+    }
+
     void pokemon_gbaimpl::export_to_file(
         const std::string& filepath
     )
@@ -321,6 +351,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _database_entry.set_form(form);
 
@@ -344,6 +375,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         if(is_egg)
         {
@@ -389,6 +421,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.party_data.condition = pksav_littleendian32(condition_mask_bimap.left.at(condition));
     }
@@ -422,6 +455,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         PKSAV_CALL(
             pksav_gba_export_text(
@@ -447,6 +481,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_modern_gender(
             &_pksav_pokemon.pc_data.personality,
@@ -471,6 +506,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_modern_shininess(
             &_pksav_pokemon.pc_data.personality,
@@ -501,6 +537,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         // Make sure item is valid and holdable
         pkmn::database::item_entry item(
@@ -543,6 +580,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         // Nature is derived from personality, so we need to find a new
         // one that preserves all other values.
@@ -572,6 +610,7 @@ namespace pkmn
         pkmn::enforce_bounds("Duration", duration, 0, 15);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_pokerus_duration(
             &_p_misc_block->pokerus,
@@ -608,6 +647,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         PKSAV_CALL(
             pksav_gba_export_text(
@@ -644,6 +684,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id.pid = pksav_littleendian16(public_id);
     }
@@ -653,6 +694,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id.sid = pksav_littleendian16(secret_id);
     }
@@ -661,6 +703,9 @@ namespace pkmn
         uint32_t id
     )
     {
+        boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
+
         _pksav_pokemon.pc_data.ot_id.id = pksav_littleendian32(id);
     }
 
@@ -678,6 +723,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         if(gender == pkmn::e_gender::MALE)
         {
@@ -729,6 +775,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.language = pksav_littleendian16(static_cast<uint16_t>(
                                      gba_language_bimap.left.at(language)
@@ -749,6 +796,7 @@ namespace pkmn
         pkmn::enforce_bounds("Friendship", friendship, 0, 255);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _p_growth_block->friendship = uint8_t(friendship);
     }
@@ -777,6 +825,7 @@ namespace pkmn
     void pokemon_gbaimpl::set_ability(pkmn::e_ability ability)
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_ability(ability);
 
@@ -812,6 +861,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         // Try and instantiate an item_entry to validate the ball.
         (void)pkmn::database::item_entry(
@@ -838,6 +888,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level met", level, 0, 100);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _p_misc_block->origin_info &= ~PKSAV_GBA_POKEMON_LEVEL_MET_MASK;
         _p_misc_block->origin_info |= uint16_t(level);
@@ -874,6 +925,7 @@ namespace pkmn
         else
         {
             boost::lock_guard<pokemon_gbaimpl> lock(*this);
+            _set_changed();
 
             _p_misc_block->met_location = uint8_t(pkmn::database::location_name_to_index(
                                               location,
@@ -900,6 +952,7 @@ namespace pkmn
         }
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _p_misc_block->origin_info &= ~PKSAV_GBA_POKEMON_ORIGIN_GAME_MASK;
         uint16_t game_index = uint16_t(pkmn::database::game_enum_to_index(game));
@@ -919,6 +972,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.personality = pksav_littleendian32(personality);
         _set_ability_from_personality();
@@ -941,6 +995,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         int max_experience = _database_entry.get_experience_at_level(100);
         pkmn::enforce_bounds("Experience", experience, 0, max_experience);
@@ -966,6 +1021,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level", level, 1, 100);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.party_data.level = uint8_t(level);
         _p_growth_block->exp = pksav_littleendian32(uint32_t(_database_entry.get_experience_at_level(level)));
@@ -980,6 +1036,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_modern_IV(
             stat,
@@ -994,6 +1051,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_marking(
             marking,
@@ -1008,6 +1066,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         if(_ribbons.find(ribbon) == _ribbons.end())
         {
@@ -1040,6 +1099,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _set_contest_stat(
             stat,
@@ -1056,6 +1116,7 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         // This will throw an error if the move is invalid.
         pkmn::database::move_entry entry(
@@ -1076,13 +1137,9 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
-        std::vector<int> PPs;
-        pkmn::database::move_entry entry(_moves[index].move, get_game());
-        for(int num_PP_ups = 0; num_PP_ups < 4; ++num_PP_ups)
-        {
-            PPs.emplace_back(entry.get_pp(num_PP_ups));
-        }
+        const std::array<int, 4> PPs = _get_move_PPs(_moves[index].move);
 
         pkmn::enforce_bounds("PP", pp, 0, PPs.back());
 
@@ -1114,6 +1171,7 @@ namespace pkmn
         pkmn::enforce_EV_bounds(stat, value, true);
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         switch(stat)
         {
@@ -1161,10 +1219,11 @@ namespace pkmn
             "Current HP",
             hp,
             0,
-            _stats[pkmn::e_stat::HP]
+            _stats.at(pkmn::e_stat::HP)
         );
 
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.party_data.current_hp = pksav_littleendian16(static_cast<uint16_t>(hp));
     }
@@ -1224,6 +1283,7 @@ namespace pkmn
     void pokemon_gbaimpl::set_is_obedient(bool is_obedient)
     {
         boost::lock_guard<pokemon_gbaimpl> lock(*this);
+        _set_changed();
 
         if(is_obedient)
         {
@@ -1330,10 +1390,10 @@ namespace pkmn
 
     void pokemon_gbaimpl::_update_markings_map()
     {
-        _markings[pkmn::e_marking::CIRCLE]   = bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_CIRCLE);
-        _markings[pkmn::e_marking::TRIANGLE] = bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_TRIANGLE);
-        _markings[pkmn::e_marking::SQUARE]   = bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_SQUARE);
-        _markings[pkmn::e_marking::HEART]    = bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_HEART);
+        _markings.set(pkmn::e_marking::CIRCLE, bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_CIRCLE));
+        _markings.set(pkmn::e_marking::TRIANGLE, bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_TRIANGLE));
+        _markings.set(pkmn::e_marking::SQUARE, bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_SQUARE));
+        _markings.set(pkmn::e_marking::HEART, bool(_pksav_pokemon.pc_data.markings & PKSAV_MARKING_HEART));
     }
 
     void pokemon_gbaimpl::_update_ribbons_map() {
@@ -1387,21 +1447,21 @@ namespace pkmn
 
     void pokemon_gbaimpl::_update_EV_map()
     {
-        _EVs[pkmn::e_stat::HP]              = int(_p_effort_block->ev_hp);
-        _EVs[pkmn::e_stat::ATTACK]          = int(_p_effort_block->ev_atk);
-        _EVs[pkmn::e_stat::DEFENSE]         = int(_p_effort_block->ev_def);
-        _EVs[pkmn::e_stat::SPEED]           = int(_p_effort_block->ev_spd);
-        _EVs[pkmn::e_stat::SPECIAL_ATTACK]  = int(_p_effort_block->ev_spatk);
-        _EVs[pkmn::e_stat::SPECIAL_DEFENSE] = int(_p_effort_block->ev_spdef);
+        _EVs.set(pkmn::e_stat::HP, int(_p_effort_block->ev_hp));
+        _EVs.set(pkmn::e_stat::ATTACK, int(_p_effort_block->ev_atk));
+        _EVs.set(pkmn::e_stat::DEFENSE, int(_p_effort_block->ev_def));
+        _EVs.set(pkmn::e_stat::SPEED, int(_p_effort_block->ev_spd));
+        _EVs.set(pkmn::e_stat::SPECIAL_ATTACK, int(_p_effort_block->ev_spatk));
+        _EVs.set(pkmn::e_stat::SPECIAL_DEFENSE, int(_p_effort_block->ev_spdef));
     }
 
     void pokemon_gbaimpl::_update_stat_map() {
-        _stats[pkmn::e_stat::HP]              = int(pksav_littleendian16(_pksav_pokemon.party_data.max_hp));
-        _stats[pkmn::e_stat::ATTACK]          = int(pksav_littleendian16(_pksav_pokemon.party_data.atk));
-        _stats[pkmn::e_stat::DEFENSE]         = int(pksav_littleendian16(_pksav_pokemon.party_data.def));
-        _stats[pkmn::e_stat::SPEED]           = int(pksav_littleendian16(_pksav_pokemon.party_data.spd));
-        _stats[pkmn::e_stat::SPECIAL_ATTACK]  = int(pksav_littleendian16(_pksav_pokemon.party_data.spatk));
-        _stats[pkmn::e_stat::SPECIAL_DEFENSE] = int(pksav_littleendian16(_pksav_pokemon.party_data.spdef));
+        _stats.set(pkmn::e_stat::HP, int(pksav_littleendian16(_pksav_pokemon.party_data.max_hp)));
+        _stats.set(pkmn::e_stat::ATTACK, int(pksav_littleendian16(_pksav_pokemon.party_data.atk)));
+        _stats.set(pkmn::e_stat::DEFENSE, int(pksav_littleendian16(_pksav_pokemon.party_data.def)));
+        _stats.set(pkmn::e_stat::SPEED, int(pksav_littleendian16(_pksav_pokemon.party_data.spd)));
+        _stats.set(pkmn::e_stat::SPECIAL_ATTACK, int(pksav_littleendian16(_pksav_pokemon.party_data.spatk)));
+        _stats.set(pkmn::e_stat::SPECIAL_DEFENSE, int(pksav_littleendian16(_pksav_pokemon.party_data.spdef)));
     }
 
     void pokemon_gbaimpl::_set_ability(pkmn::e_ability ability)
@@ -1478,12 +1538,18 @@ namespace pkmn
 
     void pokemon_gbaimpl::_register_attributes()
     {
-        using std::placeholders::_1;
+        static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<bool> registry;
+            registry.register_attribute_fcns(
+                "Obedient?",
+                &pokemon_gbaimpl::get_is_obedient,
+                &pokemon_gbaimpl::set_is_obedient
+            );
 
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Obedient?",
-            std::bind(&pokemon_gbaimpl::get_is_obedient, this),
-            std::bind(&pokemon_gbaimpl::set_is_obedient, this, _1)
-        );
+            return registry;
+        }();
+
+        _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
     }
 }
@@ -282,6 +282,19 @@ namespace pkmn
         return ret;
     }
 
+    pokemon::sptr pokemon_gcnimpl::snapshot()
+    {
+        boost::lock_guard<pokemon_gcnimpl> lock(*this);
+
+        std::shared_ptr<pokemon_gcnimpl> ret = std::make_shared<pokemon_gcnimpl>(
+                                                   _libpkmgc_pokemon_uptr.get(),
+                                                   _database_entry.get_game_id()
+                                               );
+        ret->_make_read_only();
+
+        return ret;
+    }
+
     void pokemon_gcnimpl::export_to_file(
         const std::string& filepath
     )
@@ -296,13 +309,20 @@ namespace pkmn
             throw std::invalid_argument("XD Pokémon can only be saved to .xk3 files.");
         }
 
-        boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        // Serializing writes to LibPkmGC's buffer, which other threads may
+        // be reading from a snapshot without the lock, so serialize a copy.
+        std::unique_ptr<LibPkmGC::GC::Pokemon> libpkmgc_pokemon_uptr;
+        {
+            boost::lock_guard<pokemon_gcnimpl> lock(*this);
 
-        _libpkmgc_pokemon_uptr->save();
+            libpkmgc_pokemon_uptr.reset(_libpkmgc_pokemon_uptr->clone());
+        }
+
+        libpkmgc_pokemon_uptr->save();
         pkmn::io::write_file(
             filepath,
-            _libpkmgc_pokemon_uptr->data,
-            _libpkmgc_pokemon_uptr->getSize()
+            libpkmgc_pokemon_uptr->data,
+            libpkmgc_pokemon_uptr->getSize()
         );
     }
 
@@ -311,6 +331,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         bool was_shadow = (_database_entry.get_form() == "Shadow");
         _database_entry.set_form(form);
@@ -351,6 +372,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->setEggFlag(is_egg);
     }
@@ -384,6 +406,7 @@ namespace pkmn
         if(condition_iter != CONDITION_BIMAP.left.end())
         {
             boost::lock_guard<pokemon_gcnimpl> lock(*this);
+            _set_changed();
 
             _libpkmgc_pokemon_uptr->partyData.status = condition_iter->second;
 
@@ -418,6 +441,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->name->fromUTF8(nickname.c_str());
     }
@@ -443,6 +467,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _set_modern_gender(
             &_libpkmgc_pokemon_uptr->PID,
@@ -464,6 +489,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         // LibPkmGC stores trainer IDs in halves.
         uint32_t trainer_id = _libpkmgc_pokemon_uptr->TID | (uint32_t(_libpkmgc_pokemon_uptr->SID) << 16);
@@ -497,6 +523,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         // Make sure item is valid and holdable
         pkmn::database::item_entry item(
@@ -541,6 +568,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         // Nature is derived from personality, so we need to find a new
         // one that preserves all other values. Note that nature is not stored
@@ -571,6 +599,7 @@ namespace pkmn
         pkmn::enforce_bounds("Duration", duration, 0, 15);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _set_pokerus_duration(
             &_libpkmgc_pokemon_uptr->pokerusStatus,
@@ -599,6 +628,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->OTName->fromUTF8(trainer_name.c_str());
     }
@@ -629,6 +659,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->TID = public_id;
     }
@@ -638,6 +669,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->SID = secret_id;
     }
@@ -647,6 +679,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->TID = uint16_t(id & 0xFFFF);
         _libpkmgc_pokemon_uptr->SID = uint16_t(id >> 16);
@@ -673,6 +706,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         static const pkmgc::gender_bimap_t& GENDER_BIMAP = pkmgc::get_gender_bimap();
         BOOST_ASSERT(GENDER_BIMAP.left.count(gender) > 0);
@@ -713,6 +747,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->version.language = LANGUAGE_BIMAP.left.at(language);
     }
@@ -731,6 +766,7 @@ namespace pkmn
         pkmn::enforce_bounds("Friendship", friendship, 0, 255);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->friendship = LibPkmGC::u8(friendship);
     }
@@ -758,6 +794,7 @@ namespace pkmn
     void pokemon_gcnimpl::set_ability(pkmn::e_ability ability)
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _set_ability(ability);
 
@@ -789,6 +826,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         // Try and instantiate an item_entry to validate the ball.
         pkmn::database::item_entry item(
@@ -814,6 +852,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level met", level, 0, 100);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->levelMet = LibPkmGC::u8(level);
     }
@@ -849,6 +888,7 @@ namespace pkmn
         else
         {
             boost::lock_guard<pokemon_gcnimpl> lock(*this);
+            _set_changed();
 
             _libpkmgc_pokemon_uptr->locationCaught = LibPkmGC::u16(pkmn::database::location_name_to_index(
                                            location,
@@ -886,6 +926,7 @@ namespace pkmn
         }
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         if((game == pkmn::e_game::COLOSSEUM) || (game == pkmn::e_game::XD))
         {
@@ -908,6 +949,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->PID = personality;
         _set_ability_from_personality();
@@ -930,6 +972,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         int max_experience = _database_entry.get_experience_at_level(100);
         pkmn::enforce_bounds("Experience", experience, 0, max_experience);
@@ -955,6 +998,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level", level, 1, 100);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->partyData.level = LibPkmGC::u8(level);
         _libpkmgc_pokemon_uptr->experience = _libpkmgc_pokemon_uptr->getExpTable()[level];
@@ -975,6 +1019,7 @@ namespace pkmn
         pkmn::enforce_IV_bounds(stat, value, true);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         const pkmgc::stat_bimap_t& STAT_BIMAP = pkmgc::get_stat_bimap();
 
@@ -983,7 +1028,7 @@ namespace pkmn
 
         _libpkmgc_pokemon_uptr->IVs[int(stat_bimap_iter->second)] = LibPkmGC::u8(value);
 
-        _IVs[stat] = value;
+        _IVs.set(stat, value);
 
         _populate_party_data();
     }
@@ -1000,6 +1045,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         switch(marking)
         {
@@ -1024,7 +1070,7 @@ namespace pkmn
                 break;
         }
 
-        _markings[marking] = value;
+        _markings.set(marking, value);
     }
 
     void pokemon_gcnimpl::set_ribbon(
@@ -1039,6 +1085,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         static const pkmgc::ribbon_bimap_t& RIBBON_BIMAP = pkmgc::get_ribbon_bimap();
 
@@ -1093,6 +1140,9 @@ namespace pkmn
         );
         pkmn::enforce_bounds("Contest stat", value, 0, 255);
 
+        boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
+
         if(stat == pkmn::e_contest_stat::FEEL)
         {
             _libpkmgc_pokemon_uptr->contestLuster = LibPkmGC::u8(value);
@@ -1108,7 +1158,7 @@ namespace pkmn
             _libpkmgc_pokemon_uptr->contestStats[int(contest_stat_iter->second)] = LibPkmGC::u8(value);
         }
 
-        _contest_stats[stat] = value;
+        _contest_stats.set(stat, value);
     }
 
     void pokemon_gcnimpl::set_move(
@@ -1119,6 +1169,7 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         pkmn::database::move_entry entry(move, get_game());
 
@@ -1147,14 +1198,9 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
-        // TODO: refactor to get vector of PPs
-        std::vector<int> PPs;
-        pkmn::database::move_entry entry(_moves[index].move, get_game());
-        for(int i = 0; i < 4; ++i)
-        {
-            PPs.emplace_back(entry.get_pp(i));
-        }
+        const std::array<int, 4> PPs = _get_move_PPs(_moves[index].move);
 
         pkmn::enforce_bounds("PP", pp, 0, PPs[3]);
 
@@ -1185,6 +1231,7 @@ namespace pkmn
         pkmn::enforce_EV_bounds(stat, value, true);
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         static const pkmgc::stat_bimap_t& STAT_BIMAP = pkmgc::get_stat_bimap();
 
@@ -1193,7 +1240,7 @@ namespace pkmn
         BOOST_ASSERT(stat_iter != STAT_BIMAP.left.end());
 
         _libpkmgc_pokemon_uptr->EVs[int(stat_iter->second)] = LibPkmGC::u8(value);
-        _EVs[stat] = value;
+        _EVs.set(stat, value);
 
         _populate_party_data();
     }
@@ -1213,10 +1260,11 @@ namespace pkmn
             "Current HP",
             hp,
             0,
-            _stats[pkmn::e_stat::HP]
+            _stats.at(pkmn::e_stat::HP)
         );
 
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->partyData.currentHP = static_cast<LibPkmGC::u16>(hp);
     }
@@ -1231,6 +1279,7 @@ namespace pkmn
     void pokemon_gcnimpl::set_is_obedient(bool is_obedient)
     {
         boost::lock_guard<pokemon_gcnimpl> lock(*this);
+        _set_changed();
 
         _libpkmgc_pokemon_uptr->obedient = is_obedient;
     }
@@ -1315,7 +1364,7 @@ namespace pkmn
             pkmn::e_stat libpkmn_stat = stat_iter.first;
             pkmgc::e_stat libpkmgc_stat = stat_iter.second;
 
-            _EVs[libpkmn_stat] = int(_libpkmgc_pokemon_uptr->EVs[int(libpkmgc_stat)]);
+            _EVs.set(libpkmn_stat, int(_libpkmgc_pokemon_uptr->EVs[int(libpkmgc_stat)]));
         }
     }
 
@@ -1328,7 +1377,7 @@ namespace pkmn
             pkmn::e_stat libpkmn_stat = stat_iter.first;
             pkmgc::e_stat libpkmgc_stat = stat_iter.second;
 
-            _stats[libpkmn_stat] = int(_libpkmgc_pokemon_uptr->partyData.stats[int(libpkmgc_stat)]);
+            _stats.set(libpkmn_stat, int(_libpkmgc_pokemon_uptr->partyData.stats[int(libpkmgc_stat)]));
         }
     }
 
@@ -1411,7 +1460,7 @@ namespace pkmn
             pkmn::e_stat libpkmn_stat = stat_iter.first;
             pkmgc::e_stat libpkmgc_stat = stat_iter.second;
 
-            _IVs[libpkmn_stat] = int(_libpkmgc_pokemon_uptr->IVs[int(libpkmgc_stat)]);
+            _IVs.set(libpkmn_stat, int(_libpkmgc_pokemon_uptr->IVs[int(libpkmgc_stat)]));
         }
     }
 
@@ -1424,30 +1473,38 @@ namespace pkmn
             pkmn::e_contest_stat libpkmn_contest_stat = contest_stat_iter.first;
             pkmgc::e_contest_stat libpkmgc_contest_stat = contest_stat_iter.second;
 
-            _contest_stats[libpkmn_contest_stat] =
-                int(_libpkmgc_pokemon_uptr->contestStats[int(libpkmgc_contest_stat)]);
+            _contest_stats.set(
+                libpkmn_contest_stat,
+                int(_libpkmgc_pokemon_uptr->contestStats[int(libpkmgc_contest_stat)])
+            );
         }
 
-        _contest_stats[pkmn::e_contest_stat::FEEL] = int(_libpkmgc_pokemon_uptr->contestLuster);
+        _contest_stats.set(pkmn::e_contest_stat::FEEL, int(_libpkmgc_pokemon_uptr->contestLuster));
     }
 
     void pokemon_gcnimpl::_init_markings_map()
     {
-        _markings[pkmn::e_marking::CIRCLE]   = _libpkmgc_pokemon_uptr->markings.circle;
-        _markings[pkmn::e_marking::TRIANGLE] = _libpkmgc_pokemon_uptr->markings.triangle;
-        _markings[pkmn::e_marking::SQUARE]   = _libpkmgc_pokemon_uptr->markings.square;
-        _markings[pkmn::e_marking::HEART]    = _libpkmgc_pokemon_uptr->markings.heart;
+        _markings.set(pkmn::e_marking::CIRCLE, _libpkmgc_pokemon_uptr->markings.circle);
+        _markings.set(pkmn::e_marking::TRIANGLE, _libpkmgc_pokemon_uptr->markings.triangle);
+        _markings.set(pkmn::e_marking::SQUARE, _libpkmgc_pokemon_uptr->markings.square);
+        _markings.set(pkmn::e_marking::HEART, _libpkmgc_pokemon_uptr->markings.heart);
     }
 
     // TODO: region, until 3DS support brings in functions
     void pokemon_gcnimpl::_register_attributes()
     {
-        using std::placeholders::_1;
+        static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<bool> registry;
+            registry.register_attribute_fcns(
+                "Obedient?",
+                &pokemon_gcnimpl::get_is_obedient,
+                &pokemon_gcnimpl::set_is_obedient
+            );
 
-        _boolean_attribute_engine.register_attribute_fcns(
-            "Obedient?",
-            std::bind(&pokemon_gcnimpl::get_is_obedient, this),
-            std::bind(&pokemon_gcnimpl::set_is_obedient, this, _1)
-        );
+            return registry;
+        }();
+
+        _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
     }
 }
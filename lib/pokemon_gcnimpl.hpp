@@ -39,6 +39,8 @@ namespace pkmn {
 
             pokemon::sptr to_game(pkmn::e_game game) final;
 
+            pokemon::sptr snapshot() final;
+
             void export_to_file(
                 const std::string& filepath
             ) final;
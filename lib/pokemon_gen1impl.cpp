@@ -119,13 +119,22 @@ namespace pkmn
 
     pokemon_gen1impl::pokemon_gen1impl(
         const struct pksav_gen1_pc_pokemon* p_pc_pokemon,
-        int game_id
+        int game_id,
+        const struct pksav_gen1_pokemon_party_data* p_party_data
     ): pokemon_impl(p_pc_pokemon->species, game_id)
     {
         BOOST_ASSERT(p_pc_pokemon != nullptr);
 
         _pksav_pokemon.pc_data = *p_pc_pokemon;
-        _populate_party_data();
+        if(p_party_data != nullptr)
+        {
+            _pksav_pokemon.party_data = *p_party_data;
+            _pksav_pokemon.pc_data.current_hp = _pksav_pokemon.party_data.max_hp;
+        }
+        else
+        {
+            _populate_party_data();
+        }
 
         _p_native_pc = &_pksav_pokemon.pc_data;
         _p_native_party = &_pksav_pokemon.party_data;
@@ -219,6 +228,24 @@ namespace pkmn
         return ret;
     }
 
+    pokemon::sptr pokemon_gen1impl::snapshot()
+    {
+        boost::lock_guard<pokemon_gen1impl> lock(*this);
+
+        std::shared_ptr<pokemon_gen1impl> ret = std::make_shared<pokemon_gen1impl>(
+                                                      &_pksav_pokemon,
+                                                      _database_entry.get_game_id()
+                                                  );
+
+        // These aren't stored in the native struct.
+        ret->_nickname = _nickname;
+        ret->_trainer_name = _trainer_name;
+
+        ret->_make_read_only();
+
+        return ret;
+    }
+
     void pokemon_gen1impl::export_to_file(
         const std::string& filepath
     )
@@ -245,6 +272,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _database_entry.set_form(form);
     }
@@ -283,6 +311,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         const pksav::gb_condition_bimap_t& gb_condition_bimap = pksav::get_gb_condition_bimap();
         pkmn::enforce_value_in_map_keys(
@@ -314,6 +343,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _nickname = nickname;
     }
@@ -387,6 +417,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _trainer_name = trainer_name;
     }
@@ -415,6 +446,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id = pksav_bigendian16(public_id);
     }
@@ -431,6 +463,7 @@ namespace pkmn
         pkmn::enforce_gb_trainer_id_bounds(id);
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id = pksav_bigendian16(uint16_t(id));
     }
@@ -546,6 +579,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         int max_experience = _database_entry.get_experience_at_level(100);
         pkmn::enforce_bounds("Experience", experience, 0, max_experience);
@@ -579,6 +613,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level", level, 2, 100);
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.level = _pksav_pokemon.party_data.level = uint8_t(level);
 
@@ -600,6 +635,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _set_gb_IV(
             stat,
@@ -631,6 +667,7 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         // This will throw an error if the move is invalid.
         pkmn::database::move_entry entry(
@@ -651,13 +688,9 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
-        std::vector<int> PPs;
-        pkmn::database::move_entry entry(_moves[index].move, get_game());
-        for(int num_PP_ups = 0; num_PP_ups < 4; ++num_PP_ups)
-        {
-            PPs.emplace_back(entry.get_pp(num_PP_ups));
-        }
+        const std::array<int, 4> PPs = _get_move_PPs(_moves[index].move);
 
         pkmn::enforce_bounds("PP", pp, 0, PPs.back());
 
@@ -688,6 +721,7 @@ namespace pkmn
         pkmn::enforce_EV_bounds(stat, value, false);
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         switch(stat)
         {
@@ -731,10 +765,11 @@ namespace pkmn
             "Current HP",
             hp,
             0,
-            _stats[pkmn::e_stat::HP]
+            _stats.at(pkmn::e_stat::HP)
         );
 
         boost::lock_guard<pokemon_gen1impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.current_hp = pksav_bigendian16(static_cast<uint16_t>(hp));
     }
@@ -801,29 +836,37 @@ namespace pkmn
 
     void pokemon_gen1impl::_update_EV_map()
     {
-        _EVs[pkmn::e_stat::HP]      = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_hp));
-        _EVs[pkmn::e_stat::ATTACK]  = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_atk));
-        _EVs[pkmn::e_stat::DEFENSE] = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_def));
-        _EVs[pkmn::e_stat::SPEED]   = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spd));
-        _EVs[pkmn::e_stat::SPECIAL] = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spcl));
+        _EVs.set(pkmn::e_stat::HP, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_hp)));
+        _EVs.set(pkmn::e_stat::ATTACK, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_atk)));
+        _EVs.set(pkmn::e_stat::DEFENSE, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_def)));
+        _EVs.set(pkmn::e_stat::SPEED, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spd)));
+        _EVs.set(pkmn::e_stat::SPECIAL, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spcl)));
     }
 
     void pokemon_gen1impl::_update_stat_map()
     {
-        _stats[pkmn::e_stat::HP]      = int(pksav_bigendian16(_pksav_pokemon.party_data.max_hp));
-        _stats[pkmn::e_stat::ATTACK]  = int(pksav_bigendian16(_pksav_pokemon.party_data.atk));
-        _stats[pkmn::e_stat::DEFENSE] = int(pksav_bigendian16(_pksav_pokemon.party_data.def));
-        _stats[pkmn::e_stat::SPEED]   = int(pksav_bigendian16(_pksav_pokemon.party_data.spd));
-        _stats[pkmn::e_stat::SPECIAL] = int(pksav_bigendian16(_pksav_pokemon.party_data.spcl));
+        _stats.set(pkmn::e_stat::HP, int(pksav_bigendian16(_pksav_pokemon.party_data.max_hp)));
+        _stats.set(pkmn::e_stat::ATTACK, int(pksav_bigendian16(_pksav_pokemon.party_data.atk)));
+        _stats.set(pkmn::e_stat::DEFENSE, int(pksav_bigendian16(_pksav_pokemon.party_data.def)));
+        _stats.set(pkmn::e_stat::SPEED, int(pksav_bigendian16(_pksav_pokemon.party_data.spd)));
+        _stats.set(pkmn::e_stat::SPECIAL, int(pksav_bigendian16(_pksav_pokemon.party_data.spcl)));
     }
 
     void pokemon_gen1impl::_register_attributes()
     {
-        // Read-only
-        _numeric_attribute_engine.register_attribute_fcns(
-            "Catch rate",
-            std::bind(&pokemon_gen1impl::get_catch_rate, this),
-            nullptr
-        );
+        static const pkmn::attribute_registry<int> NUMERIC_ATTRIBUTE_REGISTRY = []()
+        {
+            pkmn::attribute_registry<int> registry;
+            // Read-only
+            registry.register_attribute_fcns<pokemon_gen1impl>(
+                "Catch rate",
+                &pokemon_gen1impl::get_catch_rate,
+                nullptr
+            );
+
+            return registry;
+        }();
+
+        _p_numeric_attribute_registry = &NUMERIC_ATTRIBUTE_REGISTRY;
     }
 }
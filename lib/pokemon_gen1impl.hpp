@@ -20,9 +20,12 @@ namespace pkmn {
                 pkmn::database::pokemon_entry&& database_entry,
                 int level
             );
+            // Boxes that create all of their Pokémon at once calculate the
+            // party data in a single batch and pass it in here.
             pokemon_gen1impl(
                 const struct pksav_gen1_pc_pokemon* p_pc_pokemon,
-                int game_id
+                int game_id,
+                const struct pksav_gen1_pokemon_party_data* p_party_data = nullptr
             );
             pokemon_gen1impl(
                 const struct pksav_gen1_party_pokemon* p_party_pokemon,
@@ -40,6 +43,8 @@ namespace pkmn {
 
             pokemon::sptr to_game(pkmn::e_game game) final;
 
+            pokemon::sptr snapshot() final;
+
             void export_to_file(
                 const std::string& filepath
             ) final;
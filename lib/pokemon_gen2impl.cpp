@@ -120,14 +120,22 @@ namespace pkmn
 
     pokemon_gen2impl::pokemon_gen2impl(
         const struct pksav_gen2_pc_pokemon* p_pc_pokemon,
-        int game_id
+        int game_id,
+        const struct pksav_gen2_pokemon_party_data* p_party_data
     ): pokemon_impl(p_pc_pokemon->species, game_id),
        _is_egg(false)
     {
         BOOST_ASSERT(p_pc_pokemon != nullptr);
 
         _pksav_pokemon.pc_data = *p_pc_pokemon;
-        _populate_party_data();
+        if(p_party_data != nullptr)
+        {
+            _pksav_pokemon.party_data = *p_party_data;
+        }
+        else
+        {
+            _populate_party_data();
+        }
 
         _p_native_pc = &_pksav_pokemon.pc_data;
         _p_native_party = &_pksav_pokemon.party_data;
@@ -219,6 +227,25 @@ namespace pkmn
         return ret;
     }
 
+    pokemon::sptr pokemon_gen2impl::snapshot()
+    {
+        boost::lock_guard<pokemon_gen2impl> lock(*this);
+
+        std::shared_ptr<pokemon_gen2impl> ret = std::make_shared<pokemon_gen2impl>(
+                                                      &_pksav_pokemon,
+                                                      _database_entry.get_game_id()
+                                                  );
+
+        // These aren't stored in the native struct.
+        ret->_nickname = _nickname;
+        ret->_trainer_name = _trainer_name;
+        ret->_is_egg = _is_egg;
+
+        ret->_make_read_only();
+
+        return ret;
+    }
+
     void pokemon_gen2impl::export_to_file(
         const std::string& filepath
     )
@@ -244,6 +271,7 @@ namespace pkmn
         const std::string& form
     ) {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _database_entry.set_form(form);
 
@@ -265,6 +293,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _is_egg = is_egg;
     }
@@ -293,6 +322,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         const pksav::gb_condition_bimap_t& gb_condition_bimap = pksav::get_gb_condition_bimap();
         pkmn::enforce_value_in_map_keys(
@@ -314,6 +344,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         pkmn::enforce_string_length(
             "Nickname",
@@ -331,7 +362,7 @@ namespace pkmn
 
         return pkmn::calculations::gen2_pokemon_gender(
                    get_species(),
-                   _IVs[pkmn::e_stat::ATTACK]
+                   _IVs.at(pkmn::e_stat::ATTACK)
                );
     }
 
@@ -340,6 +371,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         float chance_male = _database_entry.get_chance_male();
         float chance_female = _database_entry.get_chance_female();
@@ -403,10 +435,10 @@ namespace pkmn
         boost::lock_guard<pokemon_gen2impl> lock(*this);
 
         return pkmn::calculations::gen2_shiny(
-                   _IVs[pkmn::e_stat::ATTACK],
-                   _IVs[pkmn::e_stat::DEFENSE],
-                   _IVs[pkmn::e_stat::SPEED],
-                   _IVs[pkmn::e_stat::SPECIAL]
+                   _IVs.at(pkmn::e_stat::ATTACK),
+                   _IVs.at(pkmn::e_stat::DEFENSE),
+                   _IVs.at(pkmn::e_stat::SPEED),
+                   _IVs.at(pkmn::e_stat::SPECIAL)
                );
     }
 
@@ -415,6 +447,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         if(value)
         {
@@ -455,6 +488,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         // Make sure item is valid and is holdable
         pkmn::database::item_entry item(
@@ -494,6 +528,7 @@ namespace pkmn
         pkmn::enforce_bounds("Duration", duration, 0, 15);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _set_pokerus_duration(
             &_pksav_pokemon.pc_data.pokerus,
@@ -513,6 +548,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         pkmn::enforce_string_length(
             "Trainer name",
@@ -550,6 +586,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id = pksav_bigendian16(public_id);
     }
@@ -566,6 +603,7 @@ namespace pkmn
         pkmn::enforce_gb_trainer_id_bounds(id);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.ot_id = pksav_bigendian16(uint16_t(id));
     }
@@ -590,6 +628,7 @@ namespace pkmn
         );
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         if(gender == pkmn::e_gender::MALE)
         {
@@ -625,6 +664,7 @@ namespace pkmn
         pkmn::enforce_bounds("Friendship", friendship, 0, 255);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.friendship = uint8_t(friendship);
     }
@@ -663,6 +703,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level met", level, 2, MAX_LEVEL_MET);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         uint16_t caught_data = uint16_t(level);
         caught_data <<= PKSAV_GEN2_POKEMON_LEVEL_CAUGHT_OFFSET;
@@ -702,6 +743,7 @@ namespace pkmn
         else
         {
             boost::lock_guard<pokemon_gen2impl> lock(*this);
+            _set_changed();
 
             uint16_t location_index = uint16_t(pkmn::database::location_name_to_index(
                                                    location,
@@ -753,6 +795,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         int max_experience = _database_entry.get_experience_at_level(100);
         pkmn::enforce_bounds("Experience", experience, 0, max_experience);
@@ -785,6 +828,7 @@ namespace pkmn
         pkmn::enforce_bounds("Level", level, 2, 100);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.pc_data.level = uint8_t(level);
 
@@ -806,6 +850,7 @@ namespace pkmn
     )
     {
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _set_gb_IV(
             stat,
@@ -842,6 +887,7 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         // This will throw an error if the move is invalid.
         pkmn::database::move_entry entry(
@@ -862,13 +908,9 @@ namespace pkmn
         pkmn::enforce_bounds("Move index", index, 0, 3);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
-        std::vector<int> PPs;
-        pkmn::database::move_entry entry(_moves[index].move, get_game());
-        for(int num_PP_ups = 0; num_PP_ups < 4; ++num_PP_ups)
-        {
-            PPs.emplace_back(entry.get_pp(num_PP_ups));
-        }
+        const std::array<int, 4> PPs = _get_move_PPs(_moves[index].move);
 
         pkmn::enforce_bounds("PP", pp, 0, PPs.back());
 
@@ -900,6 +942,7 @@ namespace pkmn
         pkmn::enforce_EV_bounds(stat, value, false);
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         switch(stat)
         {
@@ -943,10 +986,11 @@ namespace pkmn
             "Current HP",
             hp,
             0,
-            _stats[pkmn::e_stat::HP]
+            _stats.at(pkmn::e_stat::HP)
         );
 
         boost::lock_guard<pokemon_gen2impl> lock(*this);
+        _set_changed();
 
         _pksav_pokemon.party_data.current_hp = pksav_bigendian16(static_cast<uint16_t>(hp));
     }
@@ -990,31 +1034,31 @@ namespace pkmn
 
     void pokemon_gen2impl::_update_EV_map()
     {
-        _EVs[pkmn::e_stat::HP]      = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_hp));
-        _EVs[pkmn::e_stat::ATTACK]  = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_atk));
-        _EVs[pkmn::e_stat::DEFENSE] = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_def));
-        _EVs[pkmn::e_stat::SPEED]   = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spd));
-        _EVs[pkmn::e_stat::SPECIAL] = int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spcl));
+        _EVs.set(pkmn::e_stat::HP, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_hp)));
+        _EVs.set(pkmn::e_stat::ATTACK, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_atk)));
+        _EVs.set(pkmn::e_stat::DEFENSE, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_def)));
+        _EVs.set(pkmn::e_stat::SPEED, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spd)));
+        _EVs.set(pkmn::e_stat::SPECIAL, int(pksav_bigendian16(_pksav_pokemon.pc_data.ev_spcl)));
     }
 
     void pokemon_gen2impl::_update_stat_map()
     {
-        _stats[pkmn::e_stat::HP]              = int(pksav_bigendian16(_pksav_pokemon.party_data.max_hp));
-        _stats[pkmn::e_stat::ATTACK]          = int(pksav_bigendian16(_pksav_pokemon.party_data.atk));
-        _stats[pkmn::e_stat::DEFENSE]         = int(pksav_bigendian16(_pksav_pokemon.party_data.def));
-        _stats[pkmn::e_stat::SPEED]           = int(pksav_bigendian16(_pksav_pokemon.party_data.spd));
-        _stats[pkmn::e_stat::SPECIAL_ATTACK]  = int(pksav_bigendian16(_pksav_pokemon.party_data.spatk));
-        _stats[pkmn::e_stat::SPECIAL_DEFENSE] = int(pksav_bigendian16(_pksav_pokemon.party_data.spdef));
+        _stats.set(pkmn::e_stat::HP, int(pksav_bigendian16(_pksav_pokemon.party_data.max_hp)));
+        _stats.set(pkmn::e_stat::ATTACK, int(pksav_bigendian16(_pksav_pokemon.party_data.atk)));
+        _stats.set(pkmn::e_stat::DEFENSE, int(pksav_bigendian16(_pksav_pokemon.party_data.def)));
+        _stats.set(pkmn::e_stat::SPEED, int(pksav_bigendian16(_pksav_pokemon.party_data.spd)));
+        _stats.set(pkmn::e_stat::SPECIAL_ATTACK, int(pksav_bigendian16(_pksav_pokemon.party_data.spatk)));
+        _stats.set(pkmn::e_stat::SPECIAL_DEFENSE, int(pksav_bigendian16(_pksav_pokemon.party_data.spdef)));
     }
 
     void pokemon_gen2impl::_set_unown_form_from_IVs()
     {
         _database_entry.set_form(
             pkmn::calculations::gen2_unown_form(
-                _IVs[pkmn::e_stat::ATTACK],
-                _IVs[pkmn::e_stat::DEFENSE],
-                _IVs[pkmn::e_stat::SPEED],
-                _IVs[pkmn::e_stat::SPECIAL]
+                _IVs.at(pkmn::e_stat::ATTACK),
+                _IVs.at(pkmn::e_stat::DEFENSE),
+                _IVs.at(pkmn::e_stat::SPEED),
+                _IVs.at(pkmn::e_stat::SPECIAL)
             )
         );
     }
@@ -1026,19 +1070,19 @@ namespace pkmn
         // Set the maximum possible Special IV for the given form.
         uint16_t num = std::min<uint16_t>(uint16_t((form[0] - 'A') * 10) + 9, 255);
 
-        uint8_t IV_attack = uint8_t(_IVs[pkmn::e_stat::ATTACK]);
+        uint8_t IV_attack = uint8_t(_IVs.at(pkmn::e_stat::ATTACK));
         IV_attack &= ~0x6;
         IV_attack |= ((num & 0xC0) >> 5);
 
-        uint8_t IV_defense = uint8_t(_IVs[pkmn::e_stat::DEFENSE]);
+        uint8_t IV_defense = uint8_t(_IVs.at(pkmn::e_stat::DEFENSE));
         IV_defense &= ~0x6;
         IV_defense |= ((num & 0x30) >> 3);
 
-        uint8_t IV_speed = uint8_t(_IVs[pkmn::e_stat::SPEED]);
+        uint8_t IV_speed = uint8_t(_IVs.at(pkmn::e_stat::SPEED));
         IV_speed &= ~0x6;
         IV_speed |= ((num & 0xC) >> 1);
 
-        uint8_t IV_special = uint8_t(_IVs[pkmn::e_stat::SPECIAL]);
+        uint8_t IV_special = uint8_t(_IVs.at(pkmn::e_stat::SPECIAL));
         IV_special &= ~0x6;
         IV_special |= ((num & 0x3) << 1);
 
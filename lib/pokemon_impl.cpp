@@ -19,11 +19,14 @@
 #include "database/enum_conversions.hpp"
 #include "database/id_to_string.hpp"
 #include "database/index_to_string.hpp"
+#include "database/lookup_tables.hpp"
+#include "database/query_instrumentation.hpp"
 
 #include "io/pk1.hpp"
 #include "io/pk2.hpp"
 #include "io/3gpkm.hpp"
 #include "io/gamecube_pokemon.hpp"
+#include "io/read_write.hpp"
 
 #include "types/rng.hpp"
 
@@ -37,6 +40,7 @@
 
 #include <boost/assign.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/format.hpp>
 #include <boost/thread/lock_guard.hpp>
 
 #include <stdexcept>
@@ -55,6 +59,8 @@ namespace pkmn
         int level
     )
     {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon::make");
+
         int game_id = pkmn::database::game_enum_to_id(game);
 
         pkmn::database::pokemon_entry database_entry(
@@ -103,73 +109,120 @@ namespace pkmn
         }
     }
 
-    pokemon::sptr pokemon::from_file(
-        const std::string& filepath
+    // Files that aren't valid Pokémon are reported through the return value
+    // so try_from_file() doesn't need to catch anything for them. Anything
+    // else that goes wrong still throws.
+    static pkmn::e_load_status _load_pokemon_file(
+        const std::string& filepath,
+        pokemon::sptr& pokemon_out
     )
     {
-        pokemon::sptr ret;
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon::from_file");
+
+        boost::system::error_code error_code;
+        if(!fs::is_regular_file(filepath, error_code))
+        {
+            return pkmn::e_load_status::FILE_NOT_FOUND;
+        }
 
         // If an extension is given, assume a type. If not, try each.
         std::string extension = fs::extension(filepath);
-        if(extension == ".pk1")
+        if((extension == ".pkm") || (extension == ".pk6"))
         {
-            ret = pkmn::io::load_pk1(filepath);
+            return pkmn::e_load_status::UNIMPLEMENTED;
         }
-        else if(extension == ".pk2")
+
+        const bool is_pk1 = (extension == ".pk1");
+        const bool is_pk2 = (extension == ".pk2");
+        const bool is_3gpkm = (extension == ".3gpkm") || (extension == ".pk3");
+        const bool is_ck3 = (extension == ".ck3");
+        const bool is_xk3 = (extension == ".xk3");
+        const bool is_any_type = !(is_pk1 || is_pk2 || is_3gpkm || is_ck3 || is_xk3);
+
+        std::vector<uint8_t> buffer = pkmn::io::read_file(filepath);
+        PKMN_UNUSED(int game_id) = 0;
+
+        // TODO: consistency in function names
+        if((is_pk1 || is_any_type) && pkmn::io::vector_is_valid_pk1(buffer))
         {
-            ret = pkmn::io::load_pk2(filepath);
+            pokemon_out = pkmn::io::load_pk1(buffer);
         }
-        else if((extension == ".3gpkm") || (extension == ".pk3"))
+        else if((is_pk2 || is_any_type) && pkmn::io::vector_is_valid_pk2(buffer))
         {
-            ret = pkmn::io::load_3gpkm(filepath);
+            pokemon_out = pkmn::io::load_pk2(buffer);
         }
-        else if(extension == ".ck3")
+        else if((is_3gpkm || is_any_type) && pkmn::io::vector_is_valid_3gpkm(buffer, &game_id))
         {
-            ret = pkmn::io::load_ck3(filepath);
+            pokemon_out = pkmn::io::load_3gpkm(buffer);
         }
-        else if(extension == ".xk3")
+        else if((is_ck3 || is_any_type) && pkmn::io::is_vector_valid_ck3(buffer))
         {
-            ret = pkmn::io::load_xk3(filepath);
+            pokemon_out = pkmn::io::load_ck3(buffer);
         }
-        else if((extension == ".pkm") || (extension == ".pk6"))
+        else if((is_xk3 || is_any_type) && pkmn::io::is_vector_valid_xk3(buffer))
         {
-            throw pkmn::unimplemented_error();
+            pokemon_out = pkmn::io::load_xk3(buffer);
         }
         else
         {
-            std::vector<uint8_t> buffer(size_t(fs::file_size(filepath)));
-            PKMN_UNUSED(int game_id) = 0;
+            return pkmn::e_load_status::INVALID_FILE;
+        }
 
-            // TODO: consistency in function names
-            if(pkmn::io::vector_is_valid_pk1(buffer))
-            {
-                ret = pkmn::io::load_pk1(buffer);
-            }
-            else if(pkmn::io::vector_is_valid_pk2(buffer))
-            {
-                ret = pkmn::io::load_pk2(buffer);
-            }
-            else if(pkmn::io::vector_is_valid_3gpkm(buffer, &game_id))
-            {
-                ret = pkmn::io::load_3gpkm(buffer);
-            }
-            else if(pkmn::io::is_vector_valid_ck3(buffer))
-            {
-                ret = pkmn::io::load_ck3(buffer);
-            }
-            else if(pkmn::io::is_vector_valid_xk3(buffer))
-            {
-                ret = pkmn::io::load_xk3(buffer);
-            }
-            else
-            {
+        return pkmn::e_load_status::SUCCESS;
+    }
+
+    pokemon::sptr pokemon::from_file(
+        const std::string& filepath
+    )
+    {
+        pokemon::sptr ret;
+
+        switch(_load_pokemon_file(filepath, ret))
+        {
+            case pkmn::e_load_status::SUCCESS:
+                break;
+
+            case pkmn::e_load_status::FILE_NOT_FOUND:
+                throw std::invalid_argument(
+                          str(boost::format("The file \"%s\" does not exist.")
+                              % filepath.c_str())
+                      );
+
+            case pkmn::e_load_status::UNIMPLEMENTED:
+                throw pkmn::unimplemented_error();
+
+            default:
                 throw std::runtime_error("Invalid file.");
-            }
         }
 
         return ret;
     }
 
+    pkmn::e_load_status pokemon::try_from_file(
+        const std::string& filepath,
+        pokemon::sptr& pokemon_out
+    ) noexcept
+    {
+        try
+        {
+            return _load_pokemon_file(filepath, pokemon_out);
+        }
+        catch(...)
+        {
+            return pkmn::e_load_status::LOAD_ERROR;
+        }
+    }
+
+    pokemon::sptr pokemon::snapshot()
+    {
+        throw pkmn::unimplemented_error("Pokémon snapshots");
+    }
+
+    bool pokemon::is_snapshot()
+    {
+        return false;
+    }
+
     pokemon_impl::pokemon_impl(
         int pokemon_index,
         int game_id
@@ -177,7 +230,9 @@ namespace pkmn
        _database_entry(pkmn::database::pokemon_entry(pokemon_index, game_id)),
        _generation(pkmn::database::game_id_to_generation(game_id)),
        _p_native_pc(nullptr),
-       _p_native_party(nullptr)
+       _p_native_party(nullptr),
+       _is_dirty(false),
+       _is_read_only(false)
     {}
 
     pokemon_impl::pokemon_impl(
@@ -186,7 +241,9 @@ namespace pkmn
        _database_entry(std::move(database_entry)),
        _generation(pkmn::database::game_id_to_generation(_database_entry.get_game_id())),
        _p_native_pc(nullptr),
-       _p_native_party(nullptr)
+       _p_native_party(nullptr),
+       _is_dirty(false),
+       _is_read_only(false)
     {}
 
     pkmn::e_species pokemon_impl::get_species()
@@ -226,7 +283,7 @@ namespace pkmn
 
         boost::lock_guard<pokemon_impl> lock(*this);
 
-        return _markings;
+        return _markings.as_map();
     }
 
     const std::map<std::string, bool>& pokemon_impl::get_ribbons()
@@ -250,7 +307,7 @@ namespace pkmn
 
         boost::lock_guard<pokemon_impl> lock(*this);
 
-        return _contest_stats;
+        return _contest_stats.as_map();
     }
 
     const pkmn::move_slots_t& pokemon_impl::get_moves()
@@ -264,21 +321,21 @@ namespace pkmn
     {
         boost::lock_guard<pokemon_impl> lock(*this);
 
-        return _EVs;
+        return _EVs.as_map();
     }
 
     const std::map<pkmn::e_stat, int>& pokemon_impl::get_IVs()
     {
         boost::lock_guard<pokemon_impl> lock(*this);
 
-        return _IVs;
+        return _IVs.as_map();
     }
 
     const std::map<pkmn::e_stat, int>& pokemon_impl::get_stats()
     {
         boost::lock_guard<pokemon_impl> lock(*this);
 
-        return _stats;
+        return _stats.as_map();
     }
 
     std::string pokemon_impl::get_icon_filepath()
@@ -314,6 +371,25 @@ namespace pkmn
         return _p_native_party;
     }
 
+    bool pokemon_impl::is_snapshot()
+    {
+        boost::lock_guard<pokemon_impl> lock(*this);
+
+        return _is_read_only;
+    }
+
+    void pokemon_impl::_make_read_only()
+    {
+        (void)_EVs.as_map();
+        (void)_IVs.as_map();
+        (void)_stats.as_map();
+        (void)_contest_stats.as_map();
+        (void)_markings.as_map();
+
+        _is_dirty = false;
+        _is_read_only = true;
+    }
+
     // Shared abstraction initializers
 
     void pokemon_impl::_init_default_moves_for_level()
@@ -395,7 +471,7 @@ namespace pkmn
             pkmn::e_stat libpkmn_stat = IV_pair.first;
             enum pksav_gb_IV pksav_IV = IV_pair.second;
 
-            _IVs[libpkmn_stat] = pksav_IVs[pksav_IV];
+            _IVs.set(libpkmn_stat, pksav_IVs[pksav_IV]);
         }
     }
 
@@ -419,7 +495,7 @@ namespace pkmn
             pkmn::e_stat libpkmn_stat = IV_pair.first;
             enum pksav_IV pksav_IV = IV_pair.second;
 
-            _IVs[libpkmn_stat] = pksav_IVs[pksav_IV];
+            _IVs.set(libpkmn_stat, pksav_IVs[pksav_IV]);
         }
     }
 
@@ -427,34 +503,53 @@ namespace pkmn
         const struct pksav_contest_stats* p_native
     )
     {
-        _contest_stats[pkmn::e_contest_stat::COOL]   = int(p_native->cool);
-        _contest_stats[pkmn::e_contest_stat::BEAUTY] = int(p_native->beauty);
-        _contest_stats[pkmn::e_contest_stat::CUTE]   = int(p_native->cute);
-        _contest_stats[pkmn::e_contest_stat::SMART]  = int(p_native->smart);
-        _contest_stats[pkmn::e_contest_stat::TOUGH]  = int(p_native->tough);
+        _contest_stats.set(pkmn::e_contest_stat::COOL, int(p_native->cool));
+        _contest_stats.set(pkmn::e_contest_stat::BEAUTY, int(p_native->beauty));
+        _contest_stats.set(pkmn::e_contest_stat::CUTE, int(p_native->cute));
+        _contest_stats.set(pkmn::e_contest_stat::SMART, int(p_native->smart));
+        _contest_stats.set(pkmn::e_contest_stat::TOUGH, int(p_native->tough));
 
         // Feel and sheen are a union in this struct, so this is fine.
         pkmn::e_contest_stat feel_or_sheen = (_generation == 3) ? pkmn::e_contest_stat::FEEL
                                                                 : pkmn::e_contest_stat::SHEEN;
 
-        _contest_stats[feel_or_sheen] = int(p_native->feel);
+        _contest_stats.set(feel_or_sheen, int(p_native->feel));
     }
 
     void pokemon_impl::_init_markings_map(
         const uint8_t* p_native
     )
     {
-        _markings[pkmn::e_marking::CIRCLE]   = bool((*p_native) & PKSAV_MARKING_CIRCLE);
-        _markings[pkmn::e_marking::TRIANGLE] = bool((*p_native) & PKSAV_MARKING_TRIANGLE);
-        _markings[pkmn::e_marking::SQUARE]   = bool((*p_native) & PKSAV_MARKING_SQUARE);
-        _markings[pkmn::e_marking::HEART]    = bool((*p_native) & PKSAV_MARKING_HEART);
+        _markings.set(pkmn::e_marking::CIRCLE, bool((*p_native) & PKSAV_MARKING_CIRCLE));
+        _markings.set(pkmn::e_marking::TRIANGLE, bool((*p_native) & PKSAV_MARKING_TRIANGLE));
+        _markings.set(pkmn::e_marking::SQUARE, bool((*p_native) & PKSAV_MARKING_SQUARE));
+        _markings.set(pkmn::e_marking::HEART, bool((*p_native) & PKSAV_MARKING_HEART));
         if(_generation > 3)
         {
-            _markings[pkmn::e_marking::STAR]    = bool((*p_native) & PKSAV_MARKING_STAR);
-            _markings[pkmn::e_marking::DIAMOND] = bool((*p_native) & PKSAV_MARKING_DIAMOND);
+            _markings.set(pkmn::e_marking::STAR, bool((*p_native) & PKSAV_MARKING_STAR));
+            _markings.set(pkmn::e_marking::DIAMOND, bool((*p_native) & PKSAV_MARKING_DIAMOND));
         }
     }
 
+    std::array<int, 4> pokemon_impl::_get_move_PPs(
+        pkmn::e_move move
+    )
+    {
+        std::array<int, 4> PPs;
+
+        // Fall back to a full entry so errors are reported the same way.
+        if(!pkmn::database::lookup_move_pps(int(move), _generation, &PPs))
+        {
+            pkmn::database::move_entry entry(move, get_game());
+            for(int num_PP_ups = 0; num_PP_ups < 4; ++num_PP_ups)
+            {
+                PPs[num_PP_ups] = entry.get_pp(num_PP_ups);
+            }
+        }
+
+        return PPs;
+    }
+
     // Shared setters
 
     int pokemon_impl::_get_pokerus_duration(
@@ -625,7 +720,7 @@ namespace pkmn
             );
         )
 
-        _IVs[stat] = value;
+        _IVs.set(stat, value);
         _populate_party_data();
     }
 
@@ -634,7 +729,7 @@ namespace pkmn
         if(stat == (map_key)) \
         { \
             p_native->native_field = uint8_t(value); \
-            _contest_stats[(map_key)] = value; \
+            _contest_stats.set((map_key), value); \
             return; \
         } \
     }
@@ -672,7 +767,7 @@ namespace pkmn
             { \
                 *p_native &= ~(mask); \
             } \
-            _markings[marking] = value; \
+            _markings.set(marking, value); \
         } \
     }
 
@@ -7,14 +7,18 @@
 #ifndef PKMN_POKEMON_IMPL_HPP
 #define PKMN_POKEMON_IMPL_HPP
 
+#include "types/enum_array_map.hpp"
+
 #include <pkmn/pokemon.hpp>
 
 #include <pksav/common/contest_stats.h>
 #include <pksav/common/stats.h>
 
+#include <boost/thread/lock_guard.hpp>
 #include <boost/thread/lockable_adapter.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 
+#include <array>
 #include <stdexcept>
 #include <unordered_map>
 
@@ -29,7 +33,7 @@ namespace pkmn {
                         public boost::basic_lockable_adapter<boost::recursive_mutex>
     {
         public:
-            pokemon_impl() {}
+            pokemon_impl(): _is_dirty(false), _is_read_only(false) {}
             pokemon_impl(
                 int pokemon_index,
                 int game_id
@@ -70,6 +74,42 @@ namespace pkmn {
 
             void* get_native_party_data() final;
 
+            bool is_snapshot() final;
+
+            // Snapshots can't change, so they skip the mutex entirely. These
+            // hide the adapter's functions for every boost::lock_guard
+            // taken on a Pokémon.
+            inline void lock()
+            {
+                if(!_is_read_only)
+                {
+                    boost::basic_lockable_adapter<boost::recursive_mutex>::lock();
+                }
+            }
+
+            inline void unlock()
+            {
+                if(!_is_read_only)
+                {
+                    boost::basic_lockable_adapter<boost::recursive_mutex>::unlock();
+                }
+            }
+
+            // For internal use
+
+            // Returns whether this Pokémon has been changed since the last
+            // call, so the list holding it knows whether its native copy
+            // needs to be updated.
+            inline bool clear_dirty()
+            {
+                boost::lock_guard<pokemon_impl> lock(*this);
+
+                bool was_dirty = _is_dirty;
+                _is_dirty = false;
+
+                return was_dirty;
+            }
+
             // Make the box implementations friend classes so they can access the internals.
             friend class pokemon_box_impl;
             friend class pokemon_box_gbaimpl;
@@ -104,10 +144,26 @@ namespace pkmn {
         protected:
             pkmn::move_slots_t _moves;
 
-            std::map<pkmn::e_stat, int> _EVs, _IVs, _stats;
-
-            std::map<pkmn::e_contest_stat, int> _contest_stats;
-            std::map<pkmn::e_marking, bool> _markings;
+            typedef pkmn::enum_array_map<
+                        pkmn::e_stat,
+                        int,
+                        size_t(pkmn::e_stat::SPECIAL_DEFENSE) + 1
+                    > stat_map_t;
+            typedef pkmn::enum_array_map<
+                        pkmn::e_contest_stat,
+                        int,
+                        size_t(pkmn::e_contest_stat::SHEEN) + 1
+                    > contest_stat_map_t;
+            typedef pkmn::enum_array_map<
+                        pkmn::e_marking,
+                        bool,
+                        size_t(pkmn::e_marking::DIAMOND) + 1
+                    > marking_map_t;
+
+            stat_map_t _EVs, _IVs, _stats;
+
+            contest_stat_map_t _contest_stats;
+            marking_map_t _markings;
             std::map<std::string, bool> _ribbons;
 
             pkmn::database::pokemon_entry _database_entry;
@@ -117,6 +173,28 @@ namespace pkmn {
             void* _p_native_pc;
             void* _p_native_party;
 
+            // Set by every setter.
+            bool _is_dirty;
+
+            // Only set on snapshots, before they're handed out.
+            bool _is_read_only;
+
+            // Every setter calls this before changing anything.
+            inline void _set_changed()
+            {
+                if(_is_read_only)
+                {
+                    throw std::runtime_error("This Pokémon is a read-only snapshot.");
+                }
+
+                _is_dirty = true;
+            }
+
+            // Finishes a snapshot made by a subclass. Any abstraction built
+            // on first use is built here, so reading the snapshot never
+            // writes to it.
+            void _make_read_only();
+
             virtual void _populate_party_data() = 0;
 
             virtual void _update_moves(
@@ -143,6 +221,11 @@ namespace pkmn {
                 const uint8_t* native_ptr
             );
 
+            // A move's PP with 0-3 PP Ups in this Pokémon's game
+            std::array<int, 4> _get_move_PPs(
+                pkmn::e_move move
+            );
+
             // Shared setters
 
             int _get_pokerus_duration(
@@ -222,6 +305,17 @@ namespace pkmn {
             virtual void _update_stat_map() = 0;
     };
 
+    // Pokémon we didn't implement can't be tracked, so treat them as
+    // always changed.
+    inline bool clear_pokemon_dirty(
+        const pkmn::pokemon::sptr& pokemon
+    )
+    {
+        pokemon_impl* p_pokemon_impl = dynamic_cast<pokemon_impl*>(pokemon.get());
+
+        return (p_pokemon_impl != nullptr) ? p_pokemon_impl->clear_dirty() : true;
+    }
+
 }
 
 #endif /* PKMN_POKEMON_IMPL_HPP */
@@ -80,6 +80,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<POKEMON_PARTY_GBIMPL_CLASS> lock(*this);
+        _is_dirty = true;
 
         // If the given Pokémon isn't from this party's game, convert it if we can.
         pkmn::pokemon::sptr actual_new_pokemon;
@@ -83,6 +83,7 @@ namespace pkmn {
         }
 
         boost::lock_guard<pokemon_party_gcnimpl> lock(*this);
+        _is_dirty = true;
 
         // If the given Pokémon isn't from this party's game, convert it if we can.
         pkmn::pokemon::sptr actual_new_pokemon;
@@ -14,6 +14,7 @@
 #include "database/database_common.hpp"
 #include "database/enum_conversions.hpp"
 #include "database/id_to_string.hpp"
+#include "database/query_instrumentation.hpp"
 
 #include "utils/misc.hpp"
 
@@ -62,7 +63,8 @@ namespace pkmn {
         int game_id
     ): _p_native(nullptr),
        _game_id(game_id),
-       _generation(pkmn::database::game_id_to_generation(game_id))
+       _generation(pkmn::database::game_id_to_generation(game_id)),
+       _is_dirty(false)
     {}
 
     pkmn::e_game pokemon_party_impl::get_game()
@@ -74,6 +76,8 @@ namespace pkmn {
         int index
     )
     {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon_party::get_pokemon");
+
         pkmn::enforce_bounds("Party index", index, 0, (PARTY_SIZE-1));
 
         boost::lock_guard<pokemon_party_impl> lock(*this);
@@ -83,6 +87,8 @@ namespace pkmn {
 
     const pkmn::pokemon_list_t& pokemon_party_impl::as_vector()
     {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon_party::as_vector");
+
         boost::lock_guard<pokemon_party_impl> lock(*this);
 
         return _pokemon_list;
@@ -96,4 +102,29 @@ namespace pkmn {
 
         return _p_native;
     }
+
+    void* pokemon_party_impl::get_native_if_dirty()
+    {
+        boost::lock_guard<pokemon_party_impl> lock(*this);
+
+        bool is_dirty = _is_dirty;
+        for(const pkmn::pokemon::sptr& pokemon: _pokemon_list)
+        {
+            // Every Pokémon's flag needs to be cleared, so don't stop early.
+            if(pokemon && pkmn::clear_pokemon_dirty(pokemon))
+            {
+                is_dirty = true;
+            }
+        }
+
+        if(!is_dirty)
+        {
+            return nullptr;
+        }
+
+        _to_native();
+        _is_dirty = false;
+
+        return _p_native;
+    }
 }
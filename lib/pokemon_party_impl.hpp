@@ -27,7 +27,7 @@ namespace pkmn {
                               public boost::basic_lockable_adapter<boost::recursive_mutex>
     {
         public:
-            pokemon_party_impl() {}
+            pokemon_party_impl(): _is_dirty(false) {}
             explicit pokemon_party_impl(
                 int game_id
             );
@@ -53,6 +53,10 @@ namespace pkmn {
                 _pokedex = pokedex;
             }
 
+            // Returns the updated native representation if anything in this
+            // party has changed since the last call, or nullptr otherwise.
+            void* get_native_if_dirty();
+
         protected:
             pkmn::pokemon_list_t _pokemon_list;
 
@@ -62,6 +66,10 @@ namespace pkmn {
 
             int _game_id, _generation;
 
+            // Set by anything that changes the party itself. Changes to its
+            // Pokémon are tracked by each Pokémon.
+            bool _is_dirty;
+
             virtual void _from_native() = 0;
             virtual void _to_native() = 0;
     };
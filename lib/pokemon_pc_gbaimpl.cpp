@@ -143,18 +143,28 @@ namespace pkmn {
 
     void pokemon_pc_gbaimpl::_to_native()
     {
+        // Only boxes that have changed since the last call are copied.
+        bool any_box_dirty = false;
         for(size_t box_index = 0;
             box_index < PKSAV_GBA_NUM_POKEMON_BOXES;
             ++box_index)
         {
-            pkmn::rcast_equal<struct pksav_gba_pokemon_box>(
-                _box_list[box_index]->get_native(),
-                &_pksav_pc.boxes[box_index]
-            );
+            void* p_box_native = _get_box_native_if_dirty(box_index);
+            if(p_box_native != nullptr)
+            {
+                pkmn::rcast_equal<struct pksav_gba_pokemon_box>(
+                    p_box_native,
+                    &_pksav_pc.boxes[box_index]
+                );
+                any_box_dirty = true;
+            }
         }
 
-        _update_box_names();
-        _update_native_box_wallpapers();
+        if(any_box_dirty)
+        {
+            _update_box_names();
+            _update_native_box_wallpapers();
+        }
     }
 
     void pokemon_pc_gbaimpl::_update_box_names()
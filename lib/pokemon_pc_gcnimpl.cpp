@@ -80,13 +80,18 @@ namespace pkmn {
     {
         BOOST_ASSERT(_box_list.size() == _libpkmgc_box_uptrs.size());
 
+        // Only boxes that have changed since the last call are copied.
         for(size_t box_index = 0; box_index < GCN_NUM_BOXES; ++box_index)
         {
-            _libpkmgc_box_uptrs[box_index].reset(
-                static_cast<LibPkmGC::GC::PokemonBox*>(
-                    _box_list[box_index]->get_native()
-                )->clone()
-            );
+            void* p_box_native = _get_box_native_if_dirty(box_index);
+            if(p_box_native != nullptr)
+            {
+                _libpkmgc_box_uptrs[box_index].reset(
+                    static_cast<LibPkmGC::GC::PokemonBox*>(
+                        p_box_native
+                    )->clone()
+                );
+            }
         }
     }
 
@@ -142,17 +142,24 @@ namespace pkmn {
             box_index < PKSAV_GEN1_NUM_POKEMON_BOXES;
             ++box_index)
         {
+            // Only boxes that have changed since the last call are copied.
+            void* p_box_native = _get_box_native_if_dirty(box_index);
+            if(p_box_native == nullptr)
+            {
+                continue;
+            }
+
             if(is_current_box_num_valid && (box_index == current_box_num))
             {
                 pkmn::rcast_equal<struct pksav_gen1_pokemon_box>(
-                    _box_list[box_index]->get_native(),
+                    p_box_native,
                     _pksav_storage.p_current_box
                 );
             }
             else
             {
                 pkmn::rcast_equal<struct pksav_gen1_pokemon_box>(
-                    _box_list[box_index]->get_native(),
+                    p_box_native,
                     _pksav_storage.pp_boxes[box_index]
                 );
             }
@@ -154,27 +154,40 @@ namespace pkmn {
         // In Generation II, the current box is stored in a specific memory
         // location, so for that number box, use that pointer instead of
         // what's in the array.
+        // Only boxes that have changed since the last call are copied.
+        bool any_box_dirty = false;
         for(size_t box_index = 0;
             box_index < PKSAV_GEN2_NUM_POKEMON_BOXES;
             ++box_index)
         {
+            void* p_box_native = _get_box_native_if_dirty(box_index);
+            if(p_box_native == nullptr)
+            {
+                continue;
+            }
+
             if(is_current_box_num_valid && (box_index == *_pksav_storage.p_current_box_num))
             {
                 pkmn::rcast_equal<struct pksav_gen2_pokemon_box>(
-                    _box_list[box_index]->get_native(),
+                    p_box_native,
                     _pksav_storage.p_current_box
                 );
             }
             else
             {
                 pkmn::rcast_equal<struct pksav_gen2_pokemon_box>(
-                    _box_list[box_index]->get_native(),
+                    p_box_native,
                     _pksav_storage.pp_boxes[box_index]
                 );
             }
+
+            any_box_dirty = true;
         }
 
-        _update_box_names();
+        if(any_box_dirty)
+        {
+            _update_box_names();
+        }
     }
 
     void pokemon_pc_gen2impl::_update_box_names()
@@ -6,6 +6,7 @@
  */
 
 #include "exception_internal.hpp"
+#include "pokedex_impl.hpp"
 #include "pokemon_pc_impl.hpp"
 #include "pokemon_pc_gen1impl.hpp"
 #include "pokemon_pc_gen2impl.hpp"
@@ -16,13 +17,18 @@
 
 #include "database/database_common.hpp"
 #include "database/enum_conversions.hpp"
+#include "database/id_to_index.hpp"
 #include "database/id_to_string.hpp"
+#include "database/query_instrumentation.hpp"
 
 #include <pkmn/exception.hpp>
 
 #include <boost/thread/lock_guard.hpp>
 
+#include <exception>
+#include <set>
 #include <stdexcept>
+#include <utility>
 
 namespace pkmn {
 
@@ -59,7 +65,8 @@ namespace pkmn {
         int game_id
     ): _p_native(nullptr),
        _game_id(game_id),
-       _generation(pkmn::database::game_id_to_generation(game_id))
+       _generation(pkmn::database::game_id_to_generation(game_id)),
+       _is_dirty(false)
     {}
 
     pkmn::e_game pokemon_pc_impl::get_game()
@@ -107,4 +114,182 @@ namespace pkmn {
 
         return _p_native;
     }
+
+    void pokemon_pc_impl::transfer_from(
+        const pkmn::pokemon_pc::sptr& source_pc
+    )
+    {
+        if(!source_pc)
+        {
+            throw std::invalid_argument("Source PC cannot be null.");
+        }
+
+        int num_source_boxes = source_pc->get_num_boxes();
+        if(num_source_boxes > get_num_boxes())
+        {
+            throw std::invalid_argument("The source PC has more boxes than this PC.");
+        }
+
+        std::map<int, int> box_mapping;
+        for(int box_index = 0; box_index < num_source_boxes; ++box_index)
+        {
+            box_mapping.emplace(box_index, box_index);
+        }
+
+        transfer_from(source_pc, box_mapping);
+    }
+
+    void pokemon_pc_impl::transfer_from(
+        const pkmn::pokemon_pc::sptr& source_pc,
+        const std::map<int, int>& box_mapping
+    )
+    {
+        pkmn::database::query_entry_point entry_point("pkmn::pokemon_pc::transfer_from");
+
+        if(!source_pc)
+        {
+            throw std::invalid_argument("Source PC cannot be null.");
+        }
+        if(source_pc.get() == this)
+        {
+            throw std::invalid_argument("Cannot transfer a PC to itself.");
+        }
+
+        int num_source_boxes = source_pc->get_num_boxes();
+        int num_boxes = get_num_boxes();
+
+        std::set<int> destination_box_indices;
+        for(const auto& box_index_pair: box_mapping)
+        {
+            pkmn::enforce_bounds("Source box index", box_index_pair.first, 0, (num_source_boxes-1));
+            pkmn::enforce_bounds("Box index", box_index_pair.second, 0, (num_boxes-1));
+
+            if(!destination_box_indices.insert(box_index_pair.second).second)
+            {
+                throw std::invalid_argument("Each box can only be transferred into once.");
+            }
+        }
+
+        // Get the source boxes before locking this PC so two PCs
+        // transferring into each other can't deadlock.
+        std::vector<std::pair<pkmn::pokemon_box::sptr, int>> source_boxes;
+        for(const auto& box_index_pair: box_mapping)
+        {
+            source_boxes.emplace_back(
+                source_pc->get_box(box_index_pair.first),
+                box_index_pair.second
+            );
+        }
+
+        boost::lock_guard<pokemon_pc_impl> lock(*this);
+
+        // Each box only reports the Pokémon indices it brought in, so
+        // duplicates across boxes only need to be looked up once.
+        std::set<int> recorded_pokemon_indices;
+        for(const auto& source_box_pair: source_boxes)
+        {
+            pokemon_box_impl* p_source_box = dynamic_cast<pokemon_box_impl*>(
+                                                 source_box_pair.first.get()
+                                             );
+            pokemon_box_impl* p_box = dynamic_cast<pokemon_box_impl*>(
+                                          _box_list.at(source_box_pair.second).get()
+                                      );
+            BOOST_ASSERT(p_source_box != nullptr);
+            BOOST_ASSERT(p_box != nullptr);
+
+            std::vector<int> box_pokemon_indices = p_box->transfer_from(*p_source_box);
+
+            // Record each box as soon as it's copied, so the Pokédex
+            // matches what was copied even if a later box fails.
+            if(_pokedex)
+            {
+                _add_transferred_pokemon_to_pokedex(
+                    box_pokemon_indices,
+                    recorded_pokemon_indices
+                );
+            }
+        }
+    }
+
+    void pokemon_pc_impl::_add_transferred_pokemon_to_pokedex(
+        const std::vector<int>& pokemon_indices,
+        std::set<int>& r_recorded_pokemon_indices
+    )
+    {
+        std::vector<pkmn::e_species> species_list;
+        std::exception_ptr lookup_exception_ptr;
+        for(int pokemon_index: pokemon_indices)
+        {
+            if(!r_recorded_pokemon_indices.insert(pokemon_index).second)
+            {
+                continue;
+            }
+
+            // The Pokémon has already been copied, so record every species
+            // that can be looked up before reporting any that can't.
+            try
+            {
+                species_list.emplace_back(
+                    static_cast<pkmn::e_species>(
+                        pkmn::database::pokemon_index_to_id(pokemon_index, _game_id)
+                    )
+                );
+            }
+            catch(...)
+            {
+                if(!lookup_exception_ptr)
+                {
+                    lookup_exception_ptr = std::current_exception();
+                }
+            }
+        }
+
+        if(!species_list.empty())
+        {
+            pokedex_impl* p_pokedex_impl = dynamic_cast<pokedex_impl*>(_pokedex.get());
+            BOOST_ASSERT(p_pokedex_impl != nullptr);
+
+            p_pokedex_impl->add_caught(species_list);
+        }
+
+        if(lookup_exception_ptr)
+        {
+            std::rethrow_exception(lookup_exception_ptr);
+        }
+    }
+
+    void* pokemon_pc_impl::get_native_if_dirty()
+    {
+        boost::lock_guard<pokemon_pc_impl> lock(*this);
+
+        _to_native();
+        if(!_is_dirty)
+        {
+            return nullptr;
+        }
+
+        _is_dirty = false;
+
+        return _p_native;
+    }
+
+    void* pokemon_pc_impl::_get_box_native_if_dirty(
+        size_t box_index
+    )
+    {
+        BOOST_ASSERT(box_index < _box_list.size());
+
+        pokemon_box_impl* p_box_impl = dynamic_cast<pokemon_box_impl*>(
+                                           _box_list[box_index].get()
+                                       );
+        BOOST_ASSERT(p_box_impl != nullptr);
+
+        void* p_box_native = p_box_impl->get_native_if_dirty();
+        if(p_box_native != nullptr)
+        {
+            _is_dirty = true;
+        }
+
+        return p_box_native;
+    }
 }
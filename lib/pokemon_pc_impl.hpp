@@ -16,6 +16,8 @@
 #include <boost/thread/lockable_adapter.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 
+#include <map>
+#include <set>
 #include <string>
 
 namespace pkmn {
@@ -24,7 +26,7 @@ namespace pkmn {
                            public boost::basic_lockable_adapter<boost::recursive_mutex>
     {
         public:
-            pokemon_pc_impl() {}
+            pokemon_pc_impl(): _is_dirty(false) {}
             explicit pokemon_pc_impl(
                 int game_id
             );
@@ -43,12 +45,23 @@ namespace pkmn {
 
             void* get_native() final;
 
+            void transfer_from(
+                const pkmn::pokemon_pc::sptr& source_pc
+            ) final;
+
+            void transfer_from(
+                const pkmn::pokemon_pc::sptr& source_pc,
+                const std::map<int, int>& box_mapping
+            ) final;
+
             // For internal use
 
             inline void set_pokedex(
                 const pkmn::pokedex::sptr& pokedex
             )
             {
+                _pokedex = pokedex;
+
                 for(const auto& box: _box_list)
                 {
                     BOOST_ASSERT(dynamic_cast<pokemon_box_impl*>(box.get()) != nullptr);
@@ -56,14 +69,48 @@ namespace pkmn {
                 }
             }
 
+            // Returns the updated native representation if any box has
+            // changed since the last call, or nullptr otherwise.
+            void* get_native_if_dirty();
+
+            inline void set_arena(
+                const pkmn::arena::sptr& arena_sptr
+            )
+            {
+                for(const auto& box: _box_list)
+                {
+                    BOOST_ASSERT(dynamic_cast<pokemon_box_impl*>(box.get()) != nullptr);
+                    dynamic_cast<pokemon_box_impl*>(box.get())->set_arena(arena_sptr);
+                }
+            }
+
         protected:
             pkmn::pokemon_box_list_t _box_list;
             std::vector<std::string> _box_names;
 
+            pkmn::pokedex::sptr _pokedex;
+
             void* _p_native;
 
             int _game_id, _generation;
 
+            // Set whenever a changed box is copied into the native
+            // representation.
+            bool _is_dirty;
+
+            // Returns the box's updated native representation if it has
+            // changed since the last call, or nullptr otherwise.
+            void* _get_box_native_if_dirty(
+                size_t box_index
+            );
+
+            // Adds the species of any Pokémon indices not already in
+            // r_recorded_pokemon_indices to the Pokédex.
+            void _add_transferred_pokemon_to_pokedex(
+                const std::vector<int>& pokemon_indices,
+                std::set<int>& r_recorded_pokemon_indices
+            );
+
             virtual void _from_native() = 0;
             virtual void _to_native() = 0;
 
@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/AbilityListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -16,10 +16,10 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> abilities = pkmn::database::get_ability_name_list(
-                                                 generation
-                                             );
-        for(const std::string& ability: abilities)
+        pkmn::database::list_snapshot<std::string> abilities = pkmn::database::get_ability_name_list_snapshot(
+                                                                   generation
+                                                               );
+        for(const std::string& ability: *abilities)
         {
             addItem(QString::fromStdString(ability));
         }
@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/GameListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -17,11 +17,11 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> games = pkmn::database::get_game_name_list(
-                                             generation,
-                                             includePrevious
-                                         );
-        for(const std::string& game: games)
+        pkmn::database::list_snapshot<std::string> games = pkmn::database::get_game_name_list_snapshot(
+                                                               generation,
+                                                               includePrevious
+                                                           );
+        for(const std::string& game: *games)
         {
             addItem(QString::fromStdString(game));
         }
@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/GamecubeShadowPokemonListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -16,8 +16,8 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> shadow_pokemon = pkmn::database::get_gamecube_shadow_pokemon_name_list(colosseum);
-        for(const std::string& gamecube_shadow_pokemon: shadow_pokemon)
+        pkmn::database::list_snapshot<std::string> shadow_pokemon = pkmn::database::get_gamecube_shadow_pokemon_name_list_snapshot(colosseum);
+        for(const std::string& gamecube_shadow_pokemon: *shadow_pokemon)
         {
             addItem(QString::fromStdString(gamecube_shadow_pokemon));
         }
@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/ItemListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 #include <pkmn/enums/enum_to_string.hpp>
 
 namespace pkmn { namespace qt {
@@ -19,8 +19,8 @@ namespace pkmn { namespace qt {
     {
         pkmn::e_game game_enum = pkmn::string_to_game(game.toStdString());
 
-        std::vector<std::string> items = pkmn::database::get_item_name_list(game_enum);
-        for(const std::string& item: items)
+        pkmn::database::list_snapshot<std::string> items = pkmn::database::get_item_name_list_snapshot(game_enum);
+        for(const std::string& item: *items)
         {
             addItem(QString::fromStdString(item));
         }
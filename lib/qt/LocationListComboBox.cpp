@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/LocationListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 #include <pkmn/enums/enum_to_string.hpp>
 
 namespace pkmn { namespace qt {
@@ -20,11 +20,11 @@ namespace pkmn { namespace qt {
     {
         pkmn::e_game game_enum = pkmn::string_to_game(game.toStdString());
 
-        std::vector<std::string> locations = pkmn::database::get_location_name_list(
-                                                 game_enum,
-                                                 wholeGeneration
-                                             );
-        for(const std::string& location: locations)
+        pkmn::database::list_snapshot<std::string> locations = pkmn::database::get_location_name_list_snapshot(
+                                                                   game_enum,
+                                                                   wholeGeneration
+                                                               );
+        for(const std::string& location: *locations)
         {
             addItem(QString::fromStdString(location));
         }
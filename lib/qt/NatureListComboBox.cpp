@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/NatureListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -15,8 +15,8 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> natures = pkmn::database::get_nature_name_list();
-        for(const std::string& nature: natures)
+        pkmn::database::list_snapshot<std::string> natures = pkmn::database::get_nature_name_list_snapshot();
+        for(const std::string& nature: *natures)
         {
             addItem(QString::fromStdString(nature));
         }
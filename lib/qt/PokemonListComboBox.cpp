@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/PokemonListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -17,11 +17,11 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> pokemon_list = pkmn::database::get_pokemon_name_list(
-                                                    generation,
-                                                    includePrevious
-                                                );
-        for(const std::string& pokemon: pokemon_list)
+        pkmn::database::list_snapshot<std::string> pokemon_list = pkmn::database::get_pokemon_name_list_snapshot(
+                                                                      generation,
+                                                                      includePrevious
+                                                                  );
+        for(const std::string& pokemon: *pokemon_list)
         {
             addItem(QString::fromStdString(pokemon));
         }
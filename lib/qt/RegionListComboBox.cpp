@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/RegionListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -15,8 +15,8 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> regions = pkmn::database::get_region_name_list();
-        for(const std::string& region: regions)
+        pkmn::database::list_snapshot<std::string> regions = pkmn::database::get_region_name_list_snapshot();
+        for(const std::string& region: *regions)
         {
             addItem(QString::fromStdString(region));
         }
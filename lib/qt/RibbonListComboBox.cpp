@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/RibbonListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -16,10 +16,10 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> ribbons = pkmn::database::get_ribbon_name_list(
-                                               generation
-                                           );
-        for(const std::string& ribbon: ribbons)
+        pkmn::database::list_snapshot<std::string> ribbons = pkmn::database::get_ribbon_name_list_snapshot(
+                                                                 generation
+                                                             );
+        for(const std::string& ribbon: *ribbons)
         {
             addItem(QString::fromStdString(ribbon));
         }
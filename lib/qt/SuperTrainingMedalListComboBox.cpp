@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/SuperTrainingMedalListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 
 namespace pkmn { namespace qt {
 
@@ -15,9 +15,9 @@ namespace pkmn { namespace qt {
         QWidget* parent
     ): QComboBox(parent)
     {
-        std::vector<std::string> super_training_medals =
-            pkmn::database::get_super_training_medal_name_list();
-        for(const std::string& super_training_medal: super_training_medals)
+        pkmn::database::list_snapshot<std::string> super_training_medals =
+            pkmn::database::get_super_training_medal_name_list_snapshot();
+        for(const std::string& super_training_medal: *super_training_medals)
         {
             addItem(QString::fromStdString(super_training_medal));
         }
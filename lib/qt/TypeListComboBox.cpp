@@ -7,7 +7,7 @@
 
 #include <pkmn/qt/TypeListComboBox.hpp>
 
-#include <pkmn/database/lists.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 #include <pkmn/enums/enum_to_string.hpp>
 
 namespace pkmn { namespace qt {
@@ -19,8 +19,8 @@ namespace pkmn { namespace qt {
     {
         pkmn::e_game game_enum = pkmn::string_to_game(game.toStdString());
 
-        std::vector<std::string> types = pkmn::database::get_type_name_list(game_enum);
-        for(const std::string& type: types)
+        pkmn::database::list_snapshot<std::string> types = pkmn::database::get_type_name_list_snapshot(game_enum);
+        for(const std::string& type: *types)
         {
             addItem(QString::fromStdString(type));
         }
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "types/arena.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace pkmn {
+
+    const size_t arena::DEFAULT_CHUNK_SIZE;
+
+    arena::arena(
+        size_t chunk_size
+    ): _chunks(),
+       _free_blocks(),
+       _chunk_size(chunk_size),
+       _current_offset(0),
+       _num_bytes_allocated(0),
+       _num_bytes_reserved(0)
+    {
+        BOOST_ASSERT(_chunk_size > 0);
+    }
+
+    arena::~arena() {}
+
+    void* arena::allocate(
+        size_t num_bytes,
+        size_t alignment
+    )
+    {
+        BOOST_ASSERT(alignment > 0);
+        BOOST_ASSERT((alignment & (alignment - 1)) == 0);
+        BOOST_ASSERT(alignment <= alignof(std::max_align_t));
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        // Blocks of the same size are almost always the same type, but
+        // make sure a reused block is aligned well enough.
+        auto free_blocks_iter = _free_blocks.find(num_bytes);
+        if(free_blocks_iter != _free_blocks.end())
+        {
+            std::vector<void*>& r_free_blocks = free_blocks_iter->second;
+            for(auto block_iter = r_free_blocks.rbegin(); block_iter != r_free_blocks.rend(); ++block_iter)
+            {
+                void* p_block = *block_iter;
+                if((reinterpret_cast<uintptr_t>(p_block) & (alignment - 1)) == 0)
+                {
+                    r_free_blocks.erase(std::next(block_iter).base());
+                    _num_bytes_allocated += num_bytes;
+
+                    return p_block;
+                }
+            }
+        }
+
+        size_t offset = 0;
+        if(!_chunks.empty())
+        {
+            offset = (_current_offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        if(_chunks.empty() || ((offset + num_bytes) > _chunks.back().size))
+        {
+            // new[] returns memory aligned for any fundamental type, so the
+            // start of a chunk needs no padding. Anything that wouldn't fit
+            // in a normal chunk gets one of its own.
+            const size_t chunk_size = std::max(_chunk_size, num_bytes);
+
+            chunk new_chunk =
+            {
+                std::unique_ptr<unsigned char[]>(new unsigned char[chunk_size]),
+                chunk_size
+            };
+            _chunks.emplace_back(std::move(new_chunk));
+            _num_bytes_reserved += chunk_size;
+
+            offset = 0;
+        }
+
+        void* p_ret = _chunks.back().p_buffer.get() + offset;
+        _current_offset = offset + num_bytes;
+        _num_bytes_allocated += num_bytes;
+
+        return p_ret;
+    }
+
+    void arena::deallocate(
+        void* p_block,
+        size_t num_bytes
+    )
+    {
+        if(p_block == nullptr)
+        {
+            return;
+        }
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        BOOST_ASSERT(_num_bytes_allocated >= num_bytes);
+
+        _free_blocks[num_bytes].emplace_back(p_block);
+        _num_bytes_allocated -= num_bytes;
+    }
+
+    size_t arena::get_num_bytes_allocated()
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        return _num_bytes_allocated;
+    }
+
+    size_t arena::get_num_bytes_reserved()
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        return _num_bytes_reserved;
+    }
+}
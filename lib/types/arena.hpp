@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef INCLUDED_PKMN_TYPES_ARENA_HPP
+#define INCLUDED_PKMN_TYPES_ARENA_HPP
+
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace pkmn {
+
+    /*
+     * An allocator that hands out memory from large chunks.
+     *
+     * Chunks are only freed when the arena is destroyed, but freed blocks
+     * are kept on a free list and reused by later allocations of the same
+     * size. This suits objects created in bulk with similar lifetimes, such
+     * as the Pokémon in a save's PC, as they are placed next to each other
+     * and cost one allocation per chunk instead of one each. Replacing
+     * Pokémon reuses the memory of the ones they replace, so an arena only
+     * grows to fit the most objects alive at once.
+     */
+    class arena: private boost::noncopyable
+    {
+        public:
+            typedef std::shared_ptr<arena> sptr;
+
+            explicit arena(
+                size_t chunk_size = DEFAULT_CHUNK_SIZE
+            );
+
+            ~arena();
+
+            void* allocate(
+                size_t num_bytes,
+                size_t alignment
+            );
+
+            // The given block must have come from allocate() with the same size.
+            void deallocate(
+                void* p_block,
+                size_t num_bytes
+            );
+
+            // The number of bytes currently handed out, not counting padding.
+            size_t get_num_bytes_allocated();
+
+            // The number of bytes in every chunk owned by this arena.
+            size_t get_num_bytes_reserved();
+
+            static const size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+        private:
+            struct chunk
+            {
+                std::unique_ptr<unsigned char[]> p_buffer;
+                size_t size;
+            };
+
+            std::vector<chunk> _chunks;
+
+            // Freed blocks, by size.
+            std::unordered_map<size_t, std::vector<void*>> _free_blocks;
+            size_t _chunk_size;
+            size_t _current_offset;
+            size_t _num_bytes_allocated;
+            size_t _num_bytes_reserved;
+
+            boost::mutex _mutex;
+    };
+
+    /*
+     * An allocator for std::allocate_shared that places the object and its
+     * control block in an arena. Each copy holds a reference to the arena,
+     * so the arena outlives every object allocated from it.
+     */
+    template <typename T>
+    class arena_allocator
+    {
+        public:
+            typedef T value_type;
+
+            explicit arena_allocator(
+                const arena::sptr& source_arena
+            ): _arena(source_arena)
+            {}
+
+            template <typename U>
+            arena_allocator(
+                const arena_allocator<U>& other
+            ): _arena(other._arena)
+            {}
+
+            T* allocate(size_t num_elements)
+            {
+                return static_cast<T*>(
+                           _arena->allocate(
+                               num_elements * sizeof(T),
+                               alignof(T)
+                           )
+                       );
+            }
+
+            void deallocate(T* p_elements, size_t num_elements)
+            {
+                _arena->deallocate(
+                    p_elements,
+                    num_elements * sizeof(T)
+                );
+            }
+
+            template <typename U>
+            inline bool operator==(const arena_allocator<U>& rhs) const
+            {
+                return (_arena == rhs._arena);
+            }
+
+            template <typename U>
+            inline bool operator!=(const arena_allocator<U>& rhs) const
+            {
+                return (_arena != rhs._arena);
+            }
+
+        private:
+            template <typename U>
+            friend class arena_allocator;
+
+            arena::sptr _arena;
+    };
+}
+
+#endif /* INCLUDED_PKMN_TYPES_ARENA_HPP */
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef INCLUDED_PKMN_TYPES_ENUM_ARRAY_MAP_HPP
+#define INCLUDED_PKMN_TYPES_ENUM_ARRAY_MAP_HPP
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+
+namespace pkmn {
+
+    /*
+     * A map from a small enum to a value, stored as a fixed-size array
+     * indexed by the enum's value.
+     *
+     * The public API hands out const std::map references, so an equivalent
+     * std::map is only built the first time one is requested. From then on,
+     * every set() also writes through to it, so references already handed
+     * out never go stale. Instances that are never queried this way never
+     * allocate.
+     */
+    template <typename key_type, typename value_type, size_t num_keys>
+    class enum_array_map
+    {
+        public:
+            typedef std::map<key_type, value_type> map_type;
+            typedef typename map_type::const_iterator const_iterator;
+
+            enum_array_map():
+                _values(),
+                _keys_present(),
+                _map(),
+                _is_map_built(false)
+            {}
+
+            // Like std::map, this adds the key if it isn't already present.
+            inline void set(key_type key, const value_type& value)
+            {
+                const size_t index = size_t(key);
+                BOOST_ASSERT(index < num_keys);
+
+                _values[index] = value;
+                _keys_present.set(index);
+
+                if(_is_map_built)
+                {
+                    _map[key] = value;
+                }
+            }
+
+            inline const value_type& at(key_type key) const
+            {
+                if(!count(key))
+                {
+                    throw std::out_of_range("enum_array_map::at");
+                }
+
+                return _values[size_t(key)];
+            }
+
+            inline size_t count(key_type key) const
+            {
+                const size_t index = size_t(key);
+
+                return ((index < num_keys) && _keys_present.test(index)) ? 1 : 0;
+            }
+
+            inline size_t size() const
+            {
+                return _keys_present.count();
+            }
+
+            const map_type& as_map() const
+            {
+                if(!_is_map_built)
+                {
+                    for(size_t index = 0; index < num_keys; ++index)
+                    {
+                        if(_keys_present.test(index))
+                        {
+                            _map.emplace(key_type(index), _values[index]);
+                        }
+                    }
+
+                    _is_map_built = true;
+                }
+
+                return _map;
+            }
+
+            inline const_iterator begin() const
+            {
+                return as_map().begin();
+            }
+
+            inline const_iterator end() const
+            {
+                return as_map().end();
+            }
+
+        private:
+            std::array<value_type, num_keys> _values;
+            std::bitset<num_keys> _keys_present;
+
+            mutable map_type _map;
+            mutable bool _is_map_built;
+    };
+}
+
+#endif /* INCLUDED_PKMN_TYPES_ENUM_ARRAY_MAP_HPP */
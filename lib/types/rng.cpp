@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "types/rng.hpp"
+
+#include <pkmn/utils/random.hpp>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <atomic>
+
+namespace pkmn {
+
+    static boost::thread_specific_ptr<rng_engine> thread_rng_engine;
+
+    // Mixing in a counter keeps threads that start within the same clock
+    // tick from getting the same seed.
+    static uint64_t generate_thread_seed()
+    {
+        static std::atomic<uint64_t> num_seeds_generated(0);
+
+        uint64_t clock_seed = uint64_t(
+            boost::posix_time::microsec_clock::universal_time().time_of_day().total_microseconds()
+        );
+
+        return clock_seed ^ ((++num_seeds_generated) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    rng_engine& get_thread_rng_engine()
+    {
+        rng_engine* p_engine = thread_rng_engine.get();
+        if(!p_engine)
+        {
+            p_engine = new rng_engine(generate_thread_seed());
+            thread_rng_engine.reset(p_engine);
+        }
+
+        return *p_engine;
+    }
+
+    void seed_rng(
+        uint64_t seed
+    )
+    {
+        get_thread_rng_engine().seed(seed);
+    }
+
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017 Nicholas Corgan (n.corgan@gmail.com)
+ * Copyright (c) 2017-2018 Nicholas Corgan (n.corgan@gmail.com)
  *
  * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
  * or copy at http://opensource.org/licenses/MIT)
@@ -10,33 +10,101 @@
 
 #include <pkmn/config.hpp>
 
-#include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/random/mersenne_twister.hpp>
+#include <boost/config.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 
+#include <cstdint>
 #include <limits>
 
 namespace pkmn {
 
-template <typename T>
-class rng {
+/*
+ * xoshiro128** (http://xoshiro.di.unimi.it), which is much cheaper to seed
+ * and copy than a Mersenne Twister and good enough for everything LibPKMN
+ * randomizes.
+ */
+class rng_engine {
     public:
-        inline rng() {
-            _rng.seed(uint32_t(
-                boost::posix_time::microsec_clock::universal_time().time_of_day().total_microseconds() %
-                std::numeric_limits<uint32_t>::max()
-            ));
+        typedef uint32_t result_type;
+
+        static BOOST_CONSTEXPR result_type min() {
+            return 0;
+        }
+
+        static BOOST_CONSTEXPR result_type max() {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        explicit rng_engine(
+            uint64_t seed
+        ) {
+            this->seed(seed);
+        }
+
+        // Fills the state with SplitMix64, as recommended by the authors, so
+        // similar seeds still give unrelated streams.
+        void seed(
+            uint64_t seed
+        ) {
+            for(size_t state_index = 0; state_index < 4; state_index += 2) {
+                seed += 0x9E3779B97F4A7C15ULL;
+
+                uint64_t mixed = seed;
+                mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+                mixed ^= (mixed >> 31);
+
+                _state[state_index]   = uint32_t(mixed);
+                _state[state_index+1] = uint32_t(mixed >> 32);
+            }
+        }
+
+        inline result_type operator()() {
+            const uint32_t ret = rotl(_state[1] * 5, 7) * 9;
+            const uint32_t t = _state[1] << 9;
+
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+
+            _state[2] ^= t;
+            _state[3] = rotl(_state[3], 11);
+
+            return ret;
         }
 
+    private:
+        uint32_t _state[4];
+
+        static inline uint32_t rotl(
+            uint32_t value,
+            int num_bits
+        ) {
+            return (value << num_bits) | (value >> (32 - num_bits));
+        }
+};
+
+/*
+ * Returns the calling thread's engine, which is shared by everything in
+ * LibPKMN that generates random values. Unless pkmn::seed_rng() is called,
+ * each thread's engine gets its own seed the first time it's used.
+ */
+PKMN_API rng_engine& get_thread_rng_engine();
+
+// The engine is looked up on each call rather than stored, so an instance
+// can safely be used from any thread.
+template <typename T>
+class rng {
+    public:
         inline T rand(
             T min = std::numeric_limits<T>::min(),
             T max = std::numeric_limits<T>::max()
         ) {
-            return boost::random::uniform_int_distribution<T>(min, max)(_rng);
+            return boost::random::uniform_int_distribution<T>(min, max)(
+                       get_thread_rng_engine()
+                   );
         }
-
-    private:
-        boost::random::mt19937 _rng;
 };
 
 }
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "exception_internal.hpp"
+
+#include <pkmn/types/species_set.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace pkmn
+{
+    BOOST_STATIC_CONSTEXPR size_t BITS_PER_WORD = 64;
+
+    static inline int popcount64(
+        uint64_t word
+    )
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(word);
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        return int((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    // Index of the lowest set bit, which must exist
+    static inline int count_trailing_zeros64(
+        uint64_t word
+    )
+    {
+        BOOST_ASSERT(word != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        return popcount64((word & (~word + 1)) - 1);
+#endif
+    }
+
+    species_set::species_set(
+        const uint8_t* p_native_buffer,
+        size_t num_pokemon
+    ): _words((num_pokemon + BITS_PER_WORD - 1) / BITS_PER_WORD, 0)
+    {
+        BOOST_ASSERT(p_native_buffer != nullptr);
+
+        // Assembling each word a byte at a time gives the same bit order on
+        // any host, and compilers turn it into a single load where they can.
+        const size_t num_bytes = (num_pokemon + 7) / 8;
+        for(size_t byte_index = 0; byte_index < num_bytes; ++byte_index)
+        {
+            _words[byte_index / 8] |= uint64_t(p_native_buffer[byte_index]) << ((byte_index % 8) * 8);
+        }
+
+        // Ignore any bits in the last byte past the last Pokémon.
+        const size_t num_extra_bits = (_words.size() * BITS_PER_WORD) - num_pokemon;
+        if(!_words.empty() && (num_extra_bits > 0))
+        {
+            _words.back() &= (~uint64_t(0) >> num_extra_bits);
+        }
+    }
+
+    bool species_set::contains(
+        pkmn::e_species species
+    ) const
+    {
+        const size_t pokedex_num = static_cast<size_t>(species);
+
+        bool ret = false;
+        if((pokedex_num > 0) && (((pokedex_num - 1) / BITS_PER_WORD) < _words.size()))
+        {
+            const size_t bit_index = pokedex_num - 1;
+            ret = (_words[bit_index / BITS_PER_WORD] >> (bit_index % BITS_PER_WORD)) & 1;
+        }
+
+        return ret;
+    }
+
+    void species_set::set(
+        pkmn::e_species species,
+        bool value
+    )
+    {
+        pkmn::enforce_bounds(
+            "Species",
+            static_cast<int>(species),
+            1,
+            static_cast<int>(pkmn::e_species::VOLCANION)
+        );
+
+        const size_t bit_index = static_cast<size_t>(species) - 1;
+        const size_t word_index = bit_index / BITS_PER_WORD;
+        const uint64_t mask = uint64_t(1) << (bit_index % BITS_PER_WORD);
+
+        if(word_index >= _words.size())
+        {
+            _words.resize(word_index + 1, 0);
+        }
+
+        if(value)
+        {
+            _words[word_index] |= mask;
+        }
+        else
+        {
+            _words[word_index] &= ~mask;
+        }
+    }
+
+    size_t species_set::size() const
+    {
+        size_t ret = 0;
+        for(uint64_t word: _words)
+        {
+            ret += size_t(popcount64(word));
+        }
+
+        return ret;
+    }
+
+    bool species_set::empty() const
+    {
+        return std::all_of(
+                   _words.begin(),
+                   _words.end(),
+                   [](uint64_t word) {return (word == 0);}
+               );
+    }
+
+    std::vector<pkmn::e_species> species_set::as_vector() const
+    {
+        std::vector<pkmn::e_species> ret;
+        ret.reserve(size());
+
+        for(pkmn::e_species species: *this)
+        {
+            ret.emplace_back(species);
+        }
+
+        return ret;
+    }
+
+    species_set::const_iterator species_set::begin() const
+    {
+        return const_iterator(this, _next_pokedex_num(0));
+    }
+
+    species_set& species_set::operator|=(
+        const species_set& rhs
+    )
+    {
+        if(rhs._words.size() > _words.size())
+        {
+            _words.resize(rhs._words.size(), 0);
+        }
+        for(size_t word_index = 0; word_index < rhs._words.size(); ++word_index)
+        {
+            _words[word_index] |= rhs._words[word_index];
+        }
+
+        return *this;
+    }
+
+    species_set& species_set::operator&=(
+        const species_set& rhs
+    )
+    {
+        if(rhs._words.size() < _words.size())
+        {
+            _words.resize(rhs._words.size());
+        }
+        for(size_t word_index = 0; word_index < _words.size(); ++word_index)
+        {
+            _words[word_index] &= rhs._words[word_index];
+        }
+
+        return *this;
+    }
+
+    species_set& species_set::operator-=(
+        const species_set& rhs
+    )
+    {
+        const size_t num_words = std::min(_words.size(), rhs._words.size());
+        for(size_t word_index = 0; word_index < num_words; ++word_index)
+        {
+            _words[word_index] &= ~rhs._words[word_index];
+        }
+
+        return *this;
+    }
+
+    // Sets from different generations have different sizes, so trailing
+    // empty words don't count as a difference.
+    bool species_set::operator==(
+        const species_set& rhs
+    ) const
+    {
+        const std::vector<uint64_t>& shorter = (_words.size() < rhs._words.size()) ? _words : rhs._words;
+        const std::vector<uint64_t>& longer  = (_words.size() < rhs._words.size()) ? rhs._words : _words;
+
+        return std::equal(shorter.begin(), shorter.end(), longer.begin()) &&
+               std::all_of(
+                   longer.begin() + shorter.size(),
+                   longer.end(),
+                   [](uint64_t word) {return (word == 0);}
+               );
+    }
+
+    size_t species_set::_next_pokedex_num(
+        size_t pokedex_num
+    ) const
+    {
+        // Pokédex number N is bit N-1, so the next candidate's bit index is N.
+        size_t word_index = pokedex_num / BITS_PER_WORD;
+        size_t ret = 0;
+
+        if(word_index < _words.size())
+        {
+            // Mask off this word's bits we've already passed, then skip
+            // any empty words.
+            uint64_t word = _words[word_index] & (~uint64_t(0) << (pokedex_num % BITS_PER_WORD));
+            while((word == 0) && (++word_index < _words.size()))
+            {
+                word = _words[word_index];
+            }
+
+            if(word != 0)
+            {
+                ret = (word_index * BITS_PER_WORD) + size_t(count_trailing_zeros64(word)) + 1;
+            }
+        }
+
+        return ret;
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/utils/paths.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace fs = boost::filesystem;
+
+// Benchmarks only use LibPKMN's public API, so this can't use its internal
+// helper.
+static std::string get_env(
+    const char* name
+)
+{
+    const char* value = std::getenv(name);
+
+    return value ? std::string(value) : std::string();
+}
+
+const std::vector<pkmn::e_game> GENERATION_GAMES =
+{
+    pkmn::e_game::RED,
+    pkmn::e_game::GOLD,
+    pkmn::e_game::RUBY,
+    pkmn::e_game::COLOSSEUM
+};
+
+const std::vector<save_fixture>& get_save_fixtures()
+{
+    static const std::vector<save_fixture> SAVE_FIXTURES = []()
+    {
+        const fs::path LIBPKMN_TEST_FILES(get_env("LIBPKMN_TEST_FILES"));
+        const fs::path PKSAV_TEST_SAVES(get_env("PKSAV_TEST_SAVES"));
+
+        return std::vector<save_fixture>(
+        {
+            {pkmn::e_game::RED,       (PKSAV_TEST_SAVES / "red_blue" / "pokemon_red.sav").string()},
+            {pkmn::e_game::YELLOW,    (PKSAV_TEST_SAVES / "yellow" / "pokemon_yellow.sav").string()},
+            {pkmn::e_game::GOLD,      (PKSAV_TEST_SAVES / "gold_silver" / "pokemon_gold.sav").string()},
+            {pkmn::e_game::CRYSTAL,   (PKSAV_TEST_SAVES / "crystal" / "pokemon_crystal.sav").string()},
+            {pkmn::e_game::RUBY,      (PKSAV_TEST_SAVES / "ruby_sapphire" / "pokemon_ruby.sav").string()},
+            {pkmn::e_game::EMERALD,   (PKSAV_TEST_SAVES / "emerald" / "pokemon_emerald.sav").string()},
+            {pkmn::e_game::FIRERED,   (PKSAV_TEST_SAVES / "firered_leafgreen" / "pokemon_firered.sav").string()},
+            {pkmn::e_game::COLOSSEUM, (LIBPKMN_TEST_FILES / "gamecube_saves" / "pokemon_colosseum.gci").string()},
+            {pkmn::e_game::XD,        (LIBPKMN_TEST_FILES / "gamecube_saves" / "pokemon_xd.gci").string()},
+        });
+    }();
+
+    return SAVE_FIXTURES;
+}
+
+int get_num_save_fixtures()
+{
+    return int(get_save_fixtures().size());
+}
+
+std::string get_save_fixture_filepath(
+    pkmn::e_game game
+)
+{
+    for(const save_fixture& fixture: get_save_fixtures())
+    {
+        if(fixture.game == game)
+        {
+            return fixture.filepath;
+        }
+    }
+
+    throw std::invalid_argument("No save fixture for this game.");
+}
+
+std::string get_libpkmn_test_files_filepath(
+    const std::string& relative_filepath
+)
+{
+    return (fs::path(get_env("LIBPKMN_TEST_FILES")) / relative_filepath).string();
+}
+
+std::string get_tmp_filepath(
+    const std::string& extension
+)
+{
+    return (fs::path(pkmn::get_tmp_dir()) / fs::unique_path(
+                                                 "pkmn_benchmark_%%%%-%%%%-%%%%-%%%%" + extension
+                                             )).string();
+}
+
+bool check_fixture(
+    benchmark::State& state,
+    const std::string& filepath
+)
+{
+    bool ret = fs::exists(filepath);
+    if(!ret)
+    {
+        state.SkipWithError(("Missing fixture: " + filepath).c_str());
+    }
+
+    return ret;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef PKMN_BENCHMARK_COMMON_HPP
+#define PKMN_BENCHMARK_COMMON_HPP
+
+#include <pkmn/enums/game.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+/*
+ * Fixtures shared between benchmarks. Save files come from the same
+ * directories the unit tests use, so they're given through the
+ * LIBPKMN_TEST_FILES and PKSAV_TEST_SAVES environment variables.
+ */
+
+struct save_fixture
+{
+    pkmn::e_game game;
+    std::string filepath;
+};
+
+// One save per save type, in generation order.
+const std::vector<save_fixture>& get_save_fixtures();
+
+// The same as above, for use with Benchmark's DenseRange().
+int get_num_save_fixtures();
+
+std::string get_save_fixture_filepath(
+    pkmn::e_game game
+);
+
+std::string get_libpkmn_test_files_filepath(
+    const std::string& relative_filepath
+);
+
+// A unique filepath in LibPKMN's temporary directory.
+std::string get_tmp_filepath(
+    const std::string& extension
+);
+
+// Skips the benchmark if the given fixture doesn't exist.
+bool check_fixture(
+    benchmark::State& state,
+    const std::string& filepath
+);
+
+// The main games of each generation, for per-generation benchmarks.
+extern const std::vector<pkmn::e_game> GENERATION_GAMES;
+
+#endif /* PKMN_BENCHMARK_COMMON_HPP */
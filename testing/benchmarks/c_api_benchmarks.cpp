@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/config.hpp>
+
+#include <pkmn-c/error.h>
+#include <pkmn-c/game_save.h>
+#include <pkmn-c/pokemon.h>
+#include <pkmn-c/database/pokemon_entry.h>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/assert.hpp>
+
+static void BM_c_pokemon_init(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        struct pkmn_pokemon pokemon;
+
+        PKMN_UNUSED(enum pkmn_error error) = pkmn_pokemon_init(
+                                                  PKMN_SPECIES_PIKACHU,
+                                                  PKMN_GAME_EMERALD,
+                                                  "",
+                                                  50,
+                                                  &pokemon
+                                              );
+        BOOST_ASSERT(error == PKMN_ERROR_NONE);
+
+        pkmn_pokemon_free(&pokemon);
+    }
+}
+BENCHMARK(BM_c_pokemon_init);
+
+static void BM_c_database_get_pokemon_entry(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        struct pkmn_database_pokemon_entry pokemon_entry;
+
+        PKMN_UNUSED(enum pkmn_error error) = pkmn_database_get_pokemon_entry(
+                                                  PKMN_SPECIES_PIKACHU,
+                                                  PKMN_GAME_EMERALD,
+                                                  "",
+                                                  &pokemon_entry
+                                              );
+        BOOST_ASSERT(error == PKMN_ERROR_NONE);
+
+        pkmn_database_pokemon_entry_free(&pokemon_entry);
+    }
+}
+BENCHMARK(BM_c_database_get_pokemon_entry);
+
+static void BM_c_game_save_init_from_file(benchmark::State& state)
+{
+    const std::string filepath = get_save_fixture_filepath(pkmn::e_game::EMERALD);
+    if(!check_fixture(state, filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        struct pkmn_game_save game_save;
+
+        PKMN_UNUSED(enum pkmn_error error) = pkmn_game_save_init_from_file(
+                                                  filepath.c_str(),
+                                                  &game_save
+                                              );
+        BOOST_ASSERT(error == PKMN_ERROR_NONE);
+
+        pkmn_game_save_free(&game_save);
+    }
+}
+BENCHMARK(BM_c_game_save_init_from_file);
+
+// Failing calls from many threads at once, each of which stores its error
+// message for pkmn_strerror().
+static void BM_c_error_reporting(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        struct pkmn_pokemon pokemon;
+
+        benchmark::DoNotOptimize(
+            pkmn_pokemon_init(
+                PKMN_SPECIES_NONE,
+                PKMN_GAME_EMERALD,
+                "",
+                50,
+                &pokemon
+            )
+        );
+        benchmark::DoNotOptimize(pkmn_strerror());
+    }
+}
+BENCHMARK(BM_c_error_reporting)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
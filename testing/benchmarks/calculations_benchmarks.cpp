@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/pokemon.hpp>
+#include <pkmn/breeding/child_info.hpp>
+#include <pkmn/breeding/compatibility.hpp>
+#include <pkmn/calculations/personality.hpp>
+#include <pkmn/calculations/stats.hpp>
+#include <pkmn/calculations/moves/damage.hpp>
+#include <pkmn/calculations/moves/modifiers.hpp>
+
+#include <benchmark/benchmark.h>
+
+// Number of values for the batch calculations.
+static const size_t BATCH_SIZE = 1024;
+
+static void BM_generate_personality(benchmark::State& state)
+{
+    const bool shiny = (state.range(0) != 0);
+    state.SetLabel(shiny ? "shiny" : "not shiny");
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::calculations::generate_personality(
+                pkmn::e_species::CHARMANDER,
+                pkmn::pokemon::DEFAULT_TRAINER_ID,
+                shiny,
+                pkmn::e_ability::BLAZE,
+                pkmn::e_gender::MALE,
+                pkmn::e_nature::QUIET
+            )
+        );
+    }
+}
+BENCHMARK(BM_generate_personality)->Arg(0)->Arg(1);
+
+static void BM_generate_personalities(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::calculations::generate_personalities(
+                pkmn::e_species::CHARMANDER,
+                pkmn::pokemon::DEFAULT_TRAINER_ID,
+                false,
+                pkmn::e_ability::BLAZE,
+                pkmn::e_gender::MALE,
+                pkmn::e_nature::QUIET,
+                BATCH_SIZE
+            )
+        );
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(BATCH_SIZE));
+}
+BENCHMARK(BM_generate_personalities);
+
+// One stat at a time, for comparison with the batch version below.
+static void BM_get_modern_stat(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        for(size_t stat_index = 0; stat_index < BATCH_SIZE; ++stat_index)
+        {
+            benchmark::DoNotOptimize(
+                pkmn::calculations::get_modern_stat(
+                    pkmn::e_stat::ATTACK,
+                    int(stat_index % 100) + 1,
+                    1.1f,
+                    84,
+                    252,
+                    31
+                )
+            );
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(BATCH_SIZE));
+}
+BENCHMARK(BM_get_modern_stat);
+
+static void BM_get_modern_stats(benchmark::State& state)
+{
+    std::vector<int> levels(BATCH_SIZE);
+    for(size_t stat_index = 0; stat_index < BATCH_SIZE; ++stat_index)
+    {
+        levels[stat_index] = int(stat_index % 100) + 1;
+    }
+    const std::vector<float> nature_modifiers(BATCH_SIZE, 1.1f);
+    const std::vector<int> base_stats(BATCH_SIZE, 84);
+    const std::vector<int> EVs(BATCH_SIZE, 252);
+    const std::vector<int> IVs(BATCH_SIZE, 31);
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::calculations::get_modern_stats(
+                pkmn::e_stat::ATTACK,
+                levels,
+                nature_modifiers,
+                base_stats,
+                EVs,
+                IVs
+            )
+        );
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(BATCH_SIZE));
+}
+BENCHMARK(BM_get_modern_stats);
+
+static const pkmn::calculations::damage_matchup MATCHUP =
+{
+    50,
+    {pkmn::e_type::ELECTRIC, pkmn::e_type::NONE},
+    120,
+    {pkmn::e_type::WATER, pkmn::e_type::FLYING},
+    90,
+    pkmn::e_type::ELECTRIC,
+    90
+};
+
+// Damage ranges the way callers had to compute them before the batch call.
+static void BM_damage(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        for(size_t matchup_index = 0; matchup_index < BATCH_SIZE; ++matchup_index)
+        {
+            const float modifier =
+                pkmn::calculations::type_damage_modifier(3, MATCHUP.move_type, MATCHUP.defender_types.first) *
+                pkmn::calculations::type_damage_modifier(3, MATCHUP.move_type, MATCHUP.defender_types.second) *
+                1.5f;
+            for(int roll = 85; roll <= 100; ++roll)
+            {
+                benchmark::DoNotOptimize(
+                    pkmn::calculations::damage(
+                        MATCHUP.attacker_level,
+                        MATCHUP.move_base_power,
+                        MATCHUP.attack_stat,
+                        MATCHUP.defense_stat,
+                        modifier * (float(roll) / 100.0f)
+                    )
+                );
+            }
+        }
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(BATCH_SIZE));
+}
+BENCHMARK(BM_damage);
+
+static void BM_damage_ranges(benchmark::State& state)
+{
+    const std::vector<pkmn::calculations::damage_matchup> matchups(BATCH_SIZE, MATCHUP);
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::calculations::damage_ranges(3, matchups));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(BATCH_SIZE));
+}
+BENCHMARK(BM_damage_ranges);
+
+static void BM_are_pokemon_species_compatible(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::breeding::are_pokemon_species_compatible(
+                pkmn::e_species::PIKACHU,
+                pkmn::e_species::DITTO
+            )
+        );
+    }
+}
+BENCHMARK(BM_are_pokemon_species_compatible);
+
+static void BM_get_possible_child_species(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::breeding::get_possible_child_species(
+                pkmn::e_species::NIDOQUEEN,
+                pkmn::e_species::NIDOKING,
+                pkmn::e_game::EMERALD
+            )
+        );
+    }
+}
+BENCHMARK(BM_get_possible_child_species);
+
+static void BM_breeding_child_info(benchmark::State& state)
+{
+    pkmn::pokemon::sptr mother = pkmn::pokemon::make(pkmn::e_species::PIKACHU, pkmn::e_game::EMERALD, "", 50);
+    pkmn::pokemon::sptr father = pkmn::pokemon::make(pkmn::e_species::RAICHU, pkmn::e_game::EMERALD, "", 50);
+    mother->set_gender(pkmn::e_gender::FEMALE);
+    father->set_gender(pkmn::e_gender::MALE);
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::breeding::get_child_moves(mother, father, pkmn::e_species::PICHU)
+        );
+        benchmark::DoNotOptimize(
+            pkmn::breeding::get_ideal_child_IVs(mother, father, pkmn::e_gender::FEMALE)
+        );
+    }
+}
+BENCHMARK(BM_breeding_child_info);
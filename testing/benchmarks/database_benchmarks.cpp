@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/database/item_entry.hpp>
+#include <pkmn/database/list_snapshots.hpp>
+#include <pkmn/database/lists.hpp>
+#include <pkmn/database/move_entry.hpp>
+#include <pkmn/database/pokemon_entry.hpp>
+#include <pkmn/enums/enum_to_string.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+static void BM_pokemon_entry_construct(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::database::pokemon_entry(pkmn::e_species::PIKACHU, game, "")
+        );
+    }
+}
+BENCHMARK(BM_pokemon_entry_construct)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+static void BM_pokemon_entry_getters(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    pkmn::database::pokemon_entry entry(pkmn::e_species::PIKACHU, game, "");
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(entry.get_species_name());
+        benchmark::DoNotOptimize(entry.get_types());
+        benchmark::DoNotOptimize(entry.get_abilities());
+        benchmark::DoNotOptimize(entry.get_base_stats());
+        benchmark::DoNotOptimize(entry.get_EV_yields());
+        benchmark::DoNotOptimize(entry.get_experience_at_level(50));
+        benchmark::DoNotOptimize(entry.get_levelup_moves());
+        benchmark::DoNotOptimize(entry.get_tm_hm_moves());
+        benchmark::DoNotOptimize(entry.get_evolutions());
+    }
+}
+BENCHMARK(BM_pokemon_entry_getters)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+static void BM_move_entry_getters(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    for(auto _: state)
+    {
+        pkmn::database::move_entry entry(pkmn::e_move::THUNDERBOLT, game);
+
+        benchmark::DoNotOptimize(entry.get_name());
+        benchmark::DoNotOptimize(entry.get_type());
+        benchmark::DoNotOptimize(entry.get_damage_class());
+        benchmark::DoNotOptimize(entry.get_base_power());
+        benchmark::DoNotOptimize(entry.get_pp(0));
+        benchmark::DoNotOptimize(entry.get_accuracy());
+        benchmark::DoNotOptimize(entry.get_priority());
+    }
+}
+BENCHMARK(BM_move_entry_getters)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+static void BM_item_entry_getters(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    for(auto _: state)
+    {
+        pkmn::database::item_entry entry(pkmn::e_item::POTION, game);
+
+        benchmark::DoNotOptimize(entry.get_name());
+        benchmark::DoNotOptimize(entry.get_category());
+        benchmark::DoNotOptimize(entry.get_pocket());
+        benchmark::DoNotOptimize(entry.get_cost());
+    }
+}
+BENCHMARK(BM_item_entry_getters)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+static void BM_lists(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::database::get_pokemon_list(3, true));
+        benchmark::DoNotOptimize(pkmn::database::get_move_list(pkmn::e_game::EMERALD));
+        benchmark::DoNotOptimize(pkmn::database::get_item_list(pkmn::e_game::EMERALD));
+        benchmark::DoNotOptimize(pkmn::database::get_location_name_list(pkmn::e_game::EMERALD, false));
+        benchmark::DoNotOptimize(pkmn::database::get_ability_list(3));
+        benchmark::DoNotOptimize(pkmn::database::get_nature_list());
+    }
+}
+BENCHMARK(BM_lists);
+
+static void BM_list_snapshots(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::database::get_pokemon_list_snapshot(3, true));
+        benchmark::DoNotOptimize(pkmn::database::get_move_list_snapshot(pkmn::e_game::EMERALD));
+        benchmark::DoNotOptimize(pkmn::database::get_item_list_snapshot(pkmn::e_game::EMERALD));
+        benchmark::DoNotOptimize(pkmn::database::get_location_name_list_snapshot(pkmn::e_game::EMERALD, false));
+        benchmark::DoNotOptimize(pkmn::database::get_ability_list_snapshot(3));
+        benchmark::DoNotOptimize(pkmn::database::get_nature_list_snapshot());
+    }
+}
+BENCHMARK(BM_list_snapshots);
+
+// Lookups from many threads at once. Each thread has its own connection,
+// so this should scale with the number of threads.
+static void BM_multithreaded_lookups(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        pkmn::database::pokemon_entry entry(pkmn::e_species::PIKACHU, pkmn::e_game::EMERALD, "");
+        benchmark::DoNotOptimize(entry.get_base_stats());
+        benchmark::DoNotOptimize(entry.get_levelup_moves());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_multithreaded_lookups)
+    ->ThreadRange(1, int(std::max(1U, std::thread::hardware_concurrency())))
+    ->UseRealTime();
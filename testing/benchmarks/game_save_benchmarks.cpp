@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/game_save.hpp>
+#include <pkmn/enums/enum_to_string.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+namespace fs = boost::filesystem;
+
+// Each of these is registered with DenseRange(), so the argument is an
+// index into get_save_fixtures().
+static const save_fixture& get_save_fixture(
+    benchmark::State& state
+)
+{
+    const save_fixture& ret = get_save_fixtures().at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(ret.game));
+
+    return ret;
+}
+
+static void BM_game_save_from_file(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::game_save::from_file(fixture.filepath));
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(fs::file_size(fixture.filepath)));
+}
+BENCHMARK(BM_game_save_from_file)->DenseRange(0, get_num_save_fixtures()-1);
+
+static void BM_game_save_peek(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::game_save::peek(fixture.filepath));
+    }
+}
+BENCHMARK(BM_game_save_peek)->DenseRange(0, get_num_save_fixtures()-1);
+
+static void BM_game_save_detect_type(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::game_save::detect_type(fixture.filepath));
+    }
+}
+BENCHMARK(BM_game_save_detect_type)->DenseRange(0, get_num_save_fixtures()-1);
+
+// Loading a save and reading every Pokémon in its PC, which is what most
+// save browsers do first.
+static void BM_game_save_read_pc(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        pkmn::game_save::sptr save = pkmn::game_save::from_file(fixture.filepath);
+        for(const pkmn::pokemon_box::sptr& box: save->get_pokemon_pc()->as_vector())
+        {
+            for(int pokemon_index = 0; pokemon_index < box->get_capacity(); ++pokemon_index)
+            {
+                benchmark::DoNotOptimize(box->get_pokemon(pokemon_index)->get_species());
+            }
+        }
+    }
+}
+BENCHMARK(BM_game_save_read_pc)->DenseRange(0, get_num_save_fixtures()-1);
+
+static void BM_game_save_save_as(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(fixture.filepath);
+    const std::string output_filepath = get_tmp_filepath(fs::extension(fixture.filepath));
+
+    for(auto _: state)
+    {
+        save->save_as(output_filepath);
+    }
+
+    fs::remove(output_filepath);
+}
+BENCHMARK(BM_game_save_save_as)->DenseRange(0, get_num_save_fixtures()-1);
+
+// A small edit followed by a save, which should only sync what changed.
+static void BM_game_save_edit_and_save(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(fixture.filepath);
+    const std::string output_filepath = get_tmp_filepath(fs::extension(fixture.filepath));
+
+    bool use_first_name = true;
+    for(auto _: state)
+    {
+        save->set_trainer_name(use_first_name ? "BENCH" : "MARK");
+        save->save_as(output_filepath);
+
+        use_first_name = !use_first_name;
+    }
+
+    fs::remove(output_filepath);
+}
+BENCHMARK(BM_game_save_edit_and_save)->DenseRange(0, get_num_save_fixtures()-1);
+
+static void BM_game_save_from_files(benchmark::State& state)
+{
+    std::vector<std::string> filepaths;
+    for(const save_fixture& fixture: get_save_fixtures())
+    {
+        if(!check_fixture(state, fixture.filepath))
+        {
+            return;
+        }
+        filepaths.emplace_back(fixture.filepath);
+    }
+
+    pkmn::game_save_load_options options;
+    options.num_workers = size_t(state.range(0));
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::game_save::from_files(filepaths, options));
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(filepaths.size()));
+}
+BENCHMARK(BM_game_save_from_files)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(0)
+    ->UseRealTime();
+
+// Junk input should be rejected cheaply, especially without exceptions.
+static std::string write_junk_save()
+{
+    const std::string ret = get_tmp_filepath(".sav");
+
+    std::vector<char> junk(0x8000, char(0xA5));
+    std::ofstream ofile(ret.c_str(), std::ios::binary);
+    ofile.write(junk.data(), junk.size());
+    ofile.close();
+
+    return ret;
+}
+
+static void BM_game_save_from_file_junk(benchmark::State& state)
+{
+    const std::string junk_filepath = write_junk_save();
+
+    for(auto _: state)
+    {
+        try
+        {
+            benchmark::DoNotOptimize(pkmn::game_save::from_file(junk_filepath));
+        }
+        catch(const std::exception&) {}
+    }
+
+    fs::remove(junk_filepath);
+}
+BENCHMARK(BM_game_save_from_file_junk);
+
+static void BM_game_save_try_from_file_junk(benchmark::State& state)
+{
+    const std::string junk_filepath = write_junk_save();
+
+    pkmn::game_save::sptr save;
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::game_save::try_from_file(junk_filepath, save));
+    }
+
+    fs::remove(junk_filepath);
+}
+BENCHMARK(BM_game_save_try_from_file_junk);
+
+static void BM_game_save_numeric_attribute_by_name(benchmark::State& state)
+{
+    const std::string filepath = get_save_fixture_filepath(pkmn::e_game::RUBY);
+    if(!check_fixture(state, filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(filepath);
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(save->get_numeric_attribute("Casino coins"));
+    }
+}
+BENCHMARK(BM_game_save_numeric_attribute_by_name);
+
+static void BM_game_save_numeric_attribute_by_handle(benchmark::State& state)
+{
+    const std::string filepath = get_save_fixture_filepath(pkmn::e_game::RUBY);
+    if(!check_fixture(state, filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(filepath);
+    const pkmn::numeric_attribute_handle handle = save->get_numeric_attribute_handle("Casino coins");
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(save->get_numeric_attribute(handle));
+    }
+}
+BENCHMARK(BM_game_save_numeric_attribute_by_handle);
+
+static void BM_pokedex_set_operations(benchmark::State& state)
+{
+    const std::string filepath = get_save_fixture_filepath(pkmn::e_game::FIRERED);
+    if(!check_fixture(state, filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(filepath);
+    const pkmn::pokedex::sptr& pokedex = save->get_pokedex();
+
+    for(auto _: state)
+    {
+        pkmn::species_set seen = pokedex->get_seen_set();
+        pkmn::species_set caught = pokedex->get_caught_set();
+
+        benchmark::DoNotOptimize(seen - caught);
+        benchmark::DoNotOptimize(seen & caught);
+        benchmark::DoNotOptimize(seen | caught);
+    }
+}
+BENCHMARK(BM_pokedex_set_operations);
+
+// Moving a whole PC into another save, both in bulk and one Pokémon at a
+// time. Ruby and Emerald have the same PC layout, so both can map boxes
+// one-to-one.
+static void BM_pokemon_pc_transfer(benchmark::State& state)
+{
+    const bool use_bulk_transfer = (state.range(0) != 0);
+    state.SetLabel(use_bulk_transfer ? "transfer_from" : "set_pokemon");
+
+    const std::string source_filepath = get_save_fixture_filepath(pkmn::e_game::RUBY);
+    const std::string destination_filepath = get_save_fixture_filepath(pkmn::e_game::EMERALD);
+    if(!check_fixture(state, source_filepath) || !check_fixture(state, destination_filepath))
+    {
+        return;
+    }
+
+    // Both saves live outside the loop so the previous iteration's saves are
+    // replaced, and destroyed, while timing is paused. The source is reloaded
+    // too, since transferring a Pokémon can modify it.
+    pkmn::game_save::sptr source_save;
+    pkmn::game_save::sptr destination_save;
+
+    for(auto _: state)
+    {
+        state.PauseTiming();
+        source_save = pkmn::game_save::from_file(source_filepath);
+        destination_save = pkmn::game_save::from_file(destination_filepath);
+        const pkmn::pokemon_pc::sptr source_pc = source_save->get_pokemon_pc();
+        const pkmn::pokemon_pc::sptr destination_pc = destination_save->get_pokemon_pc();
+        state.ResumeTiming();
+
+        if(use_bulk_transfer)
+        {
+            destination_pc->transfer_from(source_pc);
+        }
+        else
+        {
+            for(int box_index = 0; box_index < source_pc->get_num_boxes(); ++box_index)
+            {
+                const pkmn::pokemon_box::sptr& source_box = source_pc->get_box(box_index);
+                const pkmn::pokemon_box::sptr& destination_box = destination_pc->get_box(box_index);
+
+                for(int pokemon_index = 0; pokemon_index < source_box->get_capacity(); ++pokemon_index)
+                {
+                    destination_box->set_pokemon(
+                        pokemon_index,
+                        source_box->get_pokemon(pokemon_index)
+                    );
+                }
+            }
+        }
+    }
+}
+BENCHMARK(BM_pokemon_pc_transfer)->Arg(0)->Arg(1);
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/game_save.hpp>
+#include <pkmn/enums/enum_to_string.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+ * These benchmarks measure heap usage rather than time, so this executable
+ * replaces the global allocation functions to count every live byte. This
+ * includes allocations made inside LibPKMN on platforms where the
+ * executable's replacements apply to shared libraries, such as Linux and
+ * macOS. The counting slows down every allocation, so timing benchmarks are
+ * in a separate executable.
+ */
+
+static std::atomic<size_t> num_live_heap_bytes(0);
+static std::atomic<size_t> num_heap_allocations(0);
+
+// Each allocation is prefixed with its size, padded so that the memory
+// after it is still suitably aligned.
+static const size_t HEADER_SIZE = alignof(std::max_align_t);
+
+static void* counted_malloc(size_t num_bytes)
+{
+    unsigned char* p_block = static_cast<unsigned char*>(
+                                 std::malloc(HEADER_SIZE + num_bytes)
+                             );
+    if(!p_block)
+    {
+        return nullptr;
+    }
+
+    *reinterpret_cast<size_t*>(p_block) = num_bytes;
+    num_live_heap_bytes += num_bytes;
+    ++num_heap_allocations;
+
+    return p_block + HEADER_SIZE;
+}
+
+static void counted_free(void* p_memory)
+{
+    if(p_memory)
+    {
+        unsigned char* p_block = static_cast<unsigned char*>(p_memory) - HEADER_SIZE;
+        num_live_heap_bytes -= *reinterpret_cast<size_t*>(p_block);
+
+        std::free(p_block);
+    }
+}
+
+void* operator new(size_t num_bytes)
+{
+    void* p_ret = counted_malloc(num_bytes);
+    if(!p_ret)
+    {
+        throw std::bad_alloc();
+    }
+
+    return p_ret;
+}
+
+void* operator new[](size_t num_bytes)
+{
+    return operator new(num_bytes);
+}
+
+void* operator new(size_t num_bytes, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(num_bytes);
+}
+
+void* operator new[](size_t num_bytes, const std::nothrow_t&) noexcept
+{
+    return counted_malloc(num_bytes);
+}
+
+void operator delete(void* p_memory) noexcept
+{
+    counted_free(p_memory);
+}
+
+void operator delete[](void* p_memory) noexcept
+{
+    counted_free(p_memory);
+}
+
+void operator delete(void* p_memory, size_t) noexcept
+{
+    counted_free(p_memory);
+}
+
+void operator delete[](void* p_memory, size_t) noexcept
+{
+    counted_free(p_memory);
+}
+
+void operator delete(void* p_memory, const std::nothrow_t&) noexcept
+{
+    counted_free(p_memory);
+}
+
+void operator delete[](void* p_memory, const std::nothrow_t&) noexcept
+{
+    counted_free(p_memory);
+}
+
+// Each of these is registered with DenseRange(), so the argument is an
+// index into get_save_fixtures().
+static const save_fixture& get_save_fixture(
+    benchmark::State& state
+)
+{
+    const save_fixture& ret = get_save_fixtures().at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(ret.game));
+
+    return ret;
+}
+
+// Creates every Pokémon in the given PC.
+static void read_pc(
+    const pkmn::pokemon_pc::sptr& pokemon_pc
+)
+{
+    for(const pkmn::pokemon_box::sptr& box: pokemon_pc->as_vector())
+    {
+        benchmark::DoNotOptimize(box->as_vector());
+    }
+}
+
+// The heap used by a save once every Pokémon in its PC has been read.
+static void BM_game_save_heap_footprint(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    size_t num_bytes = 0;
+    size_t num_allocations = 0;
+    for(auto _: state)
+    {
+        const size_t num_bytes_before = num_live_heap_bytes;
+        const size_t num_allocations_before = num_heap_allocations;
+
+        pkmn::game_save::sptr save = pkmn::game_save::from_file(fixture.filepath);
+        read_pc(save->get_pokemon_pc());
+
+        num_bytes = num_live_heap_bytes - num_bytes_before;
+        num_allocations = num_heap_allocations - num_allocations_before;
+    }
+
+    state.counters["heap_bytes"] = double(num_bytes);
+    state.counters["heap_allocations"] = double(num_allocations);
+}
+BENCHMARK(BM_game_save_heap_footprint)->DenseRange(0, get_num_save_fixtures()-1);
+
+/*
+ * How much a save's heap usage grows each time the Pokémon in its PC are
+ * replaced. Memory freed by the replaced Pokémon should be reused, so this
+ * should stay near zero no matter how long the save is kept open.
+ */
+static void BM_pokemon_pc_heap_growth(benchmark::State& state)
+{
+    const save_fixture& fixture = get_save_fixture(state);
+    if(!check_fixture(state, fixture.filepath))
+    {
+        return;
+    }
+
+    pkmn::game_save::sptr save = pkmn::game_save::from_file(fixture.filepath);
+    const pkmn::pokemon_pc::sptr pokemon_pc = save->get_pokemon_pc();
+    const pkmn::pokemon_pc::sptr source_pc = pkmn::game_save::from_file(fixture.filepath)->get_pokemon_pc();
+
+    // Let the first round allocate whatever it keeps for later rounds.
+    pokemon_pc->transfer_from(source_pc);
+    read_pc(pokemon_pc);
+
+    const size_t num_bytes_before = num_live_heap_bytes;
+    for(auto _: state)
+    {
+        pokemon_pc->transfer_from(source_pc);
+        read_pc(pokemon_pc);
+    }
+    const size_t num_bytes_after = num_live_heap_bytes;
+
+    state.counters["heap_growth_bytes"] = benchmark::Counter(
+                                              double(num_bytes_after) - double(num_bytes_before),
+                                              benchmark::Counter::kAvgIterations
+                                          );
+}
+BENCHMARK(BM_pokemon_pc_heap_growth)->DenseRange(0, get_num_save_fixtures()-1);
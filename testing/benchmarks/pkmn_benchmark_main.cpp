@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pkmn/config.hpp>
+#include <pkmn/database/in_memory.hpp>
+#include <pkmn/database/lists.hpp>
+#include <pkmn/utils/random.hpp>
+
+#include <benchmark/benchmark.h>
+
+#if !defined(PKMN_PLATFORM_WIN32) && !defined(PKMN_PLATFORM_MINGW)
+#include <sys/resource.h>
+#endif
+
+#include <chrono>
+#include <cstring>
+
+// Fixed so that runs are comparable.
+static const uint64_t RNG_SEED = 0x504B4D4E;
+
+// Set in main() before any benchmark runs.
+static double database_startup_seconds = 0.0;
+
+/*
+ * Startup only happens once per process, so it's measured in main() and
+ * reported here. Compare the results of running with and without
+ * --pkmn_in_memory_database to see what loading the database into memory
+ * costs up front.
+ */
+static void BM_database_startup(benchmark::State& state)
+{
+    for(auto _: state)
+    {
+        state.SetIterationTime(database_startup_seconds);
+    }
+}
+
+// Registered last, so this covers every benchmark before it.
+static void BM_peak_rss(benchmark::State& state)
+{
+#if defined(PKMN_PLATFORM_WIN32) || defined(PKMN_PLATFORM_MINGW)
+    state.SkipWithError("Peak RSS is only measured on POSIX platforms.");
+#else
+    struct rusage resource_usage;
+    for(auto _: state)
+    {
+        getrusage(RUSAGE_SELF, &resource_usage);
+    }
+
+    // macOS reports bytes, everything else reports kilobytes.
+#ifdef PKMN_PLATFORM_MACOS
+    const double peak_rss_bytes = double(resource_usage.ru_maxrss);
+#else
+    const double peak_rss_bytes = double(resource_usage.ru_maxrss) * 1024.0;
+#endif
+    state.counters["peak_rss_bytes"] = peak_rss_bytes;
+#endif
+}
+
+int main(int argc, char** argv)
+{
+    // Our own options must be removed before Benchmark sees them.
+    bool use_in_memory_database = false;
+    int num_args = 0;
+    for(int arg_index = 0; arg_index < argc; ++arg_index)
+    {
+        if(!std::strcmp(argv[arg_index], "--pkmn_in_memory_database"))
+        {
+            use_in_memory_database = true;
+        }
+        else
+        {
+            argv[num_args++] = argv[arg_index];
+        }
+    }
+    argc = num_args;
+
+    benchmark::Initialize(&argc, argv);
+    if(benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // The first lookup opens the database, which also keeps that out of
+    // the first benchmark.
+    const auto startup_begin = std::chrono::steady_clock::now();
+    if(use_in_memory_database)
+    {
+        pkmn::database::load_into_memory();
+    }
+    benchmark::DoNotOptimize(pkmn::database::get_game_list(6, true));
+    database_startup_seconds = std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - startup_begin
+                               ).count();
+
+    pkmn::seed_rng(RNG_SEED);
+
+    benchmark::RegisterBenchmark("BM_database_startup", BM_database_startup)
+        ->Iterations(1)
+        ->UseManualTime();
+    benchmark::RegisterBenchmark("BM_peak_rss", BM_peak_rss)
+        ->Iterations(1);
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "benchmark_common.hpp"
+
+#include <pkmn/pokemon.hpp>
+#include <pkmn/enums/enum_to_string.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+namespace fs = boost::filesystem;
+
+static void BM_pokemon_make(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(
+            pkmn::pokemon::make(pkmn::e_species::PIKACHU, game, "", 50)
+        );
+    }
+}
+BENCHMARK(BM_pokemon_make)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+static void BM_pokemon_to_game(
+    benchmark::State& state,
+    pkmn::e_game source_game,
+    pkmn::e_game destination_game
+)
+{
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(
+                                      pkmn::e_species::PIKACHU,
+                                      source_game,
+                                      "",
+                                      50
+                                  );
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pokemon->to_game(destination_game));
+    }
+}
+BENCHMARK_CAPTURE(BM_pokemon_to_game, red_to_yellow, pkmn::e_game::RED, pkmn::e_game::YELLOW);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, red_to_gold, pkmn::e_game::RED, pkmn::e_game::GOLD);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, gold_to_red, pkmn::e_game::GOLD, pkmn::e_game::RED);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, ruby_to_firered, pkmn::e_game::RUBY, pkmn::e_game::FIRERED);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, ruby_to_colosseum, pkmn::e_game::RUBY, pkmn::e_game::COLOSSEUM);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, colosseum_to_ruby, pkmn::e_game::COLOSSEUM, pkmn::e_game::RUBY);
+BENCHMARK_CAPTURE(BM_pokemon_to_game, colosseum_to_xd, pkmn::e_game::COLOSSEUM, pkmn::e_game::XD);
+
+static void BM_pokemon_set_move_pp(benchmark::State& state)
+{
+    const pkmn::e_game game = GENERATION_GAMES.at(size_t(state.range(0)));
+    state.SetLabel(pkmn::game_to_string(game));
+
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(pkmn::e_species::PIKACHU, game, "", 50);
+    pokemon->set_move(pkmn::e_move::THUNDERBOLT, 0);
+
+    int pp = 0;
+    for(auto _: state)
+    {
+        pokemon->set_move_pp(0, pp);
+        pp = (pp + 1) % 16;
+    }
+}
+BENCHMARK(BM_pokemon_set_move_pp)->DenseRange(0, int(GENERATION_GAMES.size())-1);
+
+// The same Pokémon read from many threads, both through its normal locking
+// getters and through a snapshot.
+static void BM_pokemon_getters(benchmark::State& state)
+{
+    const bool use_snapshot = (state.range(0) != 0);
+    state.SetLabel(use_snapshot ? "snapshot" : "locked");
+
+    static const pkmn::pokemon::sptr POKEMON = pkmn::pokemon::make(
+                                                   pkmn::e_species::PIKACHU,
+                                                   pkmn::e_game::RUBY,
+                                                   "",
+                                                   50
+                                               );
+    static const pkmn::pokemon::sptr SNAPSHOT = POKEMON->snapshot();
+
+    const pkmn::pokemon::sptr& pokemon = use_snapshot ? SNAPSHOT : POKEMON;
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pokemon->get_level());
+        benchmark::DoNotOptimize(pokemon->get_held_item());
+        benchmark::DoNotOptimize(pokemon->get_stats());
+        benchmark::DoNotOptimize(pokemon->get_moves());
+    }
+}
+BENCHMARK(BM_pokemon_getters)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+static void BM_pokemon_snapshot(benchmark::State& state)
+{
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(
+                                      pkmn::e_species::PIKACHU,
+                                      pkmn::e_game::RUBY,
+                                      "",
+                                      50
+                                  );
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pokemon->snapshot());
+    }
+}
+BENCHMARK(BM_pokemon_snapshot);
+
+static void BM_pokemon_from_file(benchmark::State& state)
+{
+    const std::string filepath = get_libpkmn_test_files_filepath("3gpkm/MIGHTYENA.3gpkm");
+    if(!check_fixture(state, filepath))
+    {
+        return;
+    }
+
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::pokemon::from_file(filepath));
+    }
+}
+BENCHMARK(BM_pokemon_from_file);
+
+// Junk input should be rejected cheaply, especially without exceptions.
+static std::string write_junk_pokemon()
+{
+    const std::string ret = get_tmp_filepath("");
+
+    // The size of a Generation III party Pokémon, so validation gets as
+    // far as checking the species.
+    std::vector<char> junk(100, char(0xFF));
+    std::ofstream ofile(ret.c_str(), std::ios::binary);
+    ofile.write(junk.data(), junk.size());
+    ofile.close();
+
+    return ret;
+}
+
+static void BM_pokemon_from_file_junk(benchmark::State& state)
+{
+    const std::string junk_filepath = write_junk_pokemon();
+
+    for(auto _: state)
+    {
+        try
+        {
+            benchmark::DoNotOptimize(pkmn::pokemon::from_file(junk_filepath));
+        }
+        catch(const std::exception&) {}
+    }
+
+    fs::remove(junk_filepath);
+}
+BENCHMARK(BM_pokemon_from_file_junk);
+
+static void BM_pokemon_try_from_file_junk(benchmark::State& state)
+{
+    const std::string junk_filepath = write_junk_pokemon();
+
+    pkmn::pokemon::sptr pokemon;
+    for(auto _: state)
+    {
+        benchmark::DoNotOptimize(pkmn::pokemon::try_from_file(junk_filepath, pokemon));
+    }
+
+    fs::remove(junk_filepath);
+}
+BENCHMARK(BM_pokemon_try_from_file_junk);
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "c_test_common.h"
+
+#include <pkmn-c/database.h>
+
+#include <string.h>
+
+static void reset_query_instrumentation()
+{
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_callback(NULL, NULL)
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_reset_query_stats()
+    );
+}
+
+// Each entry's fields are read from the database when it is created.
+static void make_move_entry_queries()
+{
+    struct pkmn_database_move_entry move_entry =
+    {
+        .move = PKMN_MOVE_NONE,
+        .p_name = NULL,
+        .game = PKMN_GAME_NONE,
+        .type = PKMN_TYPE_NONE,
+        .p_description = NULL,
+        .target = PKMN_MOVE_TARGET_NONE,
+        .damage_class = PKMN_MOVE_DAMAGE_CLASS_NONE,
+        .base_power = 0,
+        .pp = {0,0,0,0},
+        .accuracy = 0.0f,
+        .p_effect = NULL,
+        .contest_type = PKMN_CONTEST_STAT_NONE,
+        .p_contest_effect = NULL,
+        .p_super_contest_effect = NULL
+    };
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_get_move_entry(
+            PKMN_MOVE_TACKLE,
+            PKMN_GAME_RED,
+            &move_entry
+        )
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_move_entry_free(&move_entry)
+    );
+}
+
+static void query_instrumentation_enabled_test()
+{
+    bool enabled = false;
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(true)
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_is_query_instrumentation_enabled(&enabled)
+    );
+    TEST_ASSERT_TRUE(enabled);
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(false)
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_is_query_instrumentation_enabled(&enabled)
+    );
+    TEST_ASSERT_FALSE(enabled);
+
+    TEST_ASSERT_EQUAL(
+        PKMN_ERROR_NULL_POINTER,
+        pkmn_database_is_query_instrumentation_enabled(NULL)
+    );
+}
+
+static void query_stats_test()
+{
+    struct pkmn_database_query_stats_list query_stats_list =
+    {
+        .p_query_stats = NULL,
+        .length = 0
+    };
+
+    reset_query_instrumentation();
+
+    // Nothing should be recorded while instrumentation is disabled.
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(false)
+    );
+    make_move_entry_queries();
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_get_query_stats(&query_stats_list)
+    );
+    TEST_ASSERT_NULL(query_stats_list.p_query_stats);
+    TEST_ASSERT_EQUAL(0, query_stats_list.length);
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(true)
+    );
+    make_move_entry_queries();
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_get_query_stats(&query_stats_list)
+    );
+    TEST_ASSERT_NOT_NULL(query_stats_list.p_query_stats);
+    TEST_ASSERT_TRUE(query_stats_list.length > 0);
+
+    bool found_description_query = false;
+    for(size_t stats_index = 0; stats_index < query_stats_list.length; ++stats_index)
+    {
+        const struct pkmn_database_query_stats* p_query_stats =
+            &query_stats_list.p_query_stats[stats_index];
+
+        TEST_ASSERT_NOT_NULL(p_query_stats->p_query);
+        TEST_ASSERT_NOT_NULL(p_query_stats->p_entry_point);
+        TEST_ASSERT_TRUE(p_query_stats->num_queries > 0);
+        TEST_ASSERT_TRUE(p_query_stats->median_duration_ns <= p_query_stats->p90_duration_ns);
+        TEST_ASSERT_TRUE(p_query_stats->p90_duration_ns <= p_query_stats->p99_duration_ns);
+        TEST_ASSERT_TRUE(p_query_stats->p99_duration_ns <= p_query_stats->max_duration_ns);
+        TEST_ASSERT_TRUE(p_query_stats->max_duration_ns <= p_query_stats->total_duration_ns);
+
+        if(strstr(p_query_stats->p_query, "move_flavor_text") != NULL)
+        {
+            found_description_query = true;
+        }
+    }
+    TEST_ASSERT_TRUE(found_description_query);
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_query_stats_list_free(&query_stats_list)
+    );
+    TEST_ASSERT_NULL(query_stats_list.p_query_stats);
+    TEST_ASSERT_EQUAL(0, query_stats_list.length);
+
+    TEST_ASSERT_EQUAL(
+        PKMN_ERROR_NULL_POINTER,
+        pkmn_database_get_query_stats(NULL)
+    );
+    TEST_ASSERT_EQUAL(
+        PKMN_ERROR_NULL_POINTER,
+        pkmn_database_query_stats_list_free(NULL)
+    );
+
+    // Resetting should clear everything recorded so far.
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(false)
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_reset_query_stats()
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_get_query_stats(&query_stats_list)
+    );
+    TEST_ASSERT_NULL(query_stats_list.p_query_stats);
+    TEST_ASSERT_EQUAL(0, query_stats_list.length);
+}
+
+struct query_callback_data
+{
+    size_t num_calls;
+    bool all_events_valid;
+};
+
+static void query_callback(
+    const struct pkmn_database_query_event* p_query_event,
+    void* p_user_data
+)
+{
+    struct query_callback_data* p_callback_data =
+        (struct query_callback_data*)p_user_data;
+
+    ++p_callback_data->num_calls;
+    if(!p_query_event || !p_query_event->p_query || !p_query_event->p_entry_point ||
+       (strlen(p_query_event->p_query) == 0))
+    {
+        p_callback_data->all_events_valid = false;
+    }
+}
+
+static void query_callback_test()
+{
+    struct query_callback_data callback_data =
+    {
+        .num_calls = 0,
+        .all_events_valid = true
+    };
+
+    reset_query_instrumentation();
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(true)
+    );
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_callback(
+            query_callback,
+            &callback_data
+        )
+    );
+
+    make_move_entry_queries();
+    TEST_ASSERT_TRUE(callback_data.num_calls > 0);
+    TEST_ASSERT_TRUE(callback_data.all_events_valid);
+
+    // Once removed, the callback should no longer be called.
+    size_t num_calls = callback_data.num_calls;
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_callback(NULL, NULL)
+    );
+    make_move_entry_queries();
+    TEST_ASSERT_EQUAL(num_calls, callback_data.num_calls);
+
+    PKMN_TEST_ASSERT_SUCCESS(
+        pkmn_database_set_query_instrumentation_enabled(false)
+    );
+    reset_query_instrumentation();
+}
+
+PKMN_C_TEST_MAIN(
+    PKMN_C_TEST(query_instrumentation_enabled_test)
+    PKMN_C_TEST(query_stats_test)
+    PKMN_C_TEST(query_callback_test)
+)
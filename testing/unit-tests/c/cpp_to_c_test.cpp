@@ -26,8 +26,10 @@ extern "C" {
 #include <boost/assign.hpp>
 #include <boost/thread/mutex.hpp>
 
+#include <atomic>
 #include <stdexcept>
 #include <string>
+#include <thread>
 
 class pkmn_test_exception: public std::exception {
     public:
@@ -178,6 +180,7 @@ TEST(cpp_to_c_test, exception_to_error_code_test) {
 typedef struct {
     boost::mutex error_mutex;
     std::string last_error;
+    std::atomic<bool> has_error;
 } pkmn_test_handle_t;
 
 enum pkmn_error throw_nothing_with_handle(
@@ -238,6 +241,7 @@ enum pkmn_error throw_pkmn_unimplemented_error_with_handle(
 TEST(cpp_to_c_test, exception_to_error_code_with_handle_test) {
     enum pkmn_error error = PKMN_ERROR_NONE;
     pkmn_test_handle_t test_handle;
+    test_handle.has_error = false;
 
     error = throw_nothing_with_handle(&test_handle);
     EXPECT_EQ(PKMN_ERROR_NONE, error);
@@ -352,6 +356,46 @@ TEST(cpp_to_c_test, exception_to_error_code_with_handle_test) {
     EXPECT_STREQ("Unknown error", pkmn_strerror());
 }
 
+// Clearing an error should reset the handle's error message.
+TEST(cpp_to_c_test, clear_handle_error_test) {
+    enum pkmn_error error = PKMN_ERROR_NONE;
+    pkmn_test_handle_t test_handle;
+    test_handle.has_error = false;
+
+    error = throw_exception_with_handle<std::runtime_error>(
+        "runtime_error", &test_handle
+    );
+    EXPECT_EQ(PKMN_ERROR_RUNTIME_ERROR, error);
+    EXPECT_TRUE(test_handle.has_error);
+    EXPECT_EQ("runtime_error", test_handle.last_error);
+
+    error = throw_nothing_with_handle(&test_handle);
+    EXPECT_EQ(PKMN_ERROR_NONE, error);
+    EXPECT_FALSE(test_handle.has_error);
+    EXPECT_EQ("None", test_handle.last_error);
+}
+
+// Errors set on one thread shouldn't be visible from another.
+TEST(cpp_to_c_test, thread_error_test) {
+    static const std::string THREAD_ERROR = "thread_error";
+
+    enum pkmn_error error = throw_nothing();
+    EXPECT_EQ(PKMN_ERROR_NONE, error);
+
+    std::string error_in_thread;
+    std::thread error_thread(
+        [&error_in_thread]()
+        {
+            (void)throw_exception<std::runtime_error>(THREAD_ERROR);
+            error_in_thread = pkmn_strerror();
+        }
+    );
+    error_thread.join();
+
+    EXPECT_EQ(THREAD_ERROR, error_in_thread);
+    EXPECT_STREQ("None", pkmn_strerror());
+}
+
 /*
  * Converting C++ types to C types
  */
@@ -9,7 +9,7 @@
 
 #include <gtest/gtest.h>
 
-#include <functional>
+#include <string>
 
 class attribute_test_class: public pkmn::class_with_attributes
 {
@@ -99,55 +99,75 @@ class attribute_test_class: public pkmn::class_with_attributes
 
         void _register_attributes()
         {
-            using namespace std::placeholders;
-
-            _numeric_attribute_engine.register_attribute_fcns(
-                "int1",
-                std::bind(&attribute_test_class::_get_int1, this),
-                std::bind(&attribute_test_class::_set_int1, this, _1)
-            );
-            _numeric_attribute_engine.register_attribute_fcns(
-                "int2",
-                std::bind(&attribute_test_class::_get_int2, this),
-                nullptr
-            );
-            _numeric_attribute_engine.register_attribute_fcns(
-                "int3",
-                nullptr,
-                std::bind(&attribute_test_class::_set_int3, this, _1)
-            );
-
-            _string_attribute_engine.register_attribute_fcns(
-                "string1",
-                std::bind(&attribute_test_class::_get_string1, this),
-                std::bind(&attribute_test_class::_set_string1, this, _1)
-            );
-            _string_attribute_engine.register_attribute_fcns(
-                "string2",
-                std::bind(&attribute_test_class::_get_string2, this),
-                nullptr
-            );
-            _string_attribute_engine.register_attribute_fcns(
-                "string3",
-                nullptr,
-                std::bind(&attribute_test_class::_set_string3, this, _1)
-            );
-
-            _boolean_attribute_engine.register_attribute_fcns(
-                "bool1",
-                std::bind(&attribute_test_class::_get_bool1, this),
-                std::bind(&attribute_test_class::_set_bool1, this, _1)
-            );
-            _boolean_attribute_engine.register_attribute_fcns(
-                "bool2",
-                std::bind(&attribute_test_class::_get_bool2, this),
-                nullptr
-            );
-            _boolean_attribute_engine.register_attribute_fcns(
-                "bool3",
-                nullptr,
-                std::bind(&attribute_test_class::_set_bool3, this, _1)
-            );
+            static const pkmn::attribute_registry<int> NUMERIC_ATTRIBUTE_REGISTRY = []()
+            {
+                pkmn::attribute_registry<int> registry;
+                registry.register_attribute_fcns(
+                    "int1",
+                    &attribute_test_class::_get_int1,
+                    &attribute_test_class::_set_int1
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "int2",
+                    &attribute_test_class::_get_int2,
+                    nullptr
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "int3",
+                    nullptr,
+                    &attribute_test_class::_set_int3
+                );
+
+                return registry;
+            }();
+
+            static const pkmn::attribute_registry<std::string> STRING_ATTRIBUTE_REGISTRY = []()
+            {
+                pkmn::attribute_registry<std::string> registry;
+                registry.register_attribute_fcns(
+                    "string1",
+                    &attribute_test_class::_get_string1,
+                    &attribute_test_class::_set_string1
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "string2",
+                    &attribute_test_class::_get_string2,
+                    nullptr
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "string3",
+                    nullptr,
+                    &attribute_test_class::_set_string3
+                );
+
+                return registry;
+            }();
+
+            static const pkmn::attribute_registry<bool> BOOLEAN_ATTRIBUTE_REGISTRY = []()
+            {
+                pkmn::attribute_registry<bool> registry;
+                registry.register_attribute_fcns(
+                    "bool1",
+                    &attribute_test_class::_get_bool1,
+                    &attribute_test_class::_set_bool1
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "bool2",
+                    &attribute_test_class::_get_bool2,
+                    nullptr
+                );
+                registry.register_attribute_fcns<attribute_test_class>(
+                    "bool3",
+                    nullptr,
+                    &attribute_test_class::_set_bool3
+                );
+
+                return registry;
+            }();
+
+            _p_numeric_attribute_registry = &NUMERIC_ATTRIBUTE_REGISTRY;
+            _p_string_attribute_registry = &STRING_ATTRIBUTE_REGISTRY;
+            _p_boolean_attribute_registry = &BOOLEAN_ATTRIBUTE_REGISTRY;
         }
 };
 
@@ -222,3 +242,63 @@ TEST(cpp_attribute_test, test_attribute_engine)
     EXPECT_EQ(expected_string_attribute_names, test_class.get_string_attribute_names());
     EXPECT_EQ(expected_boolean_attribute_names, test_class.get_boolean_attribute_names());
 }
+
+TEST(cpp_attribute_test, test_attribute_handles)
+{
+    attribute_test_class test_class1;
+    attribute_test_class test_class2;
+
+    pkmn::numeric_attribute_handle int1_handle = test_class1.get_numeric_attribute_handle("int1");
+    pkmn::string_attribute_handle string2_handle = test_class1.get_string_attribute_handle("string2");
+    pkmn::boolean_attribute_handle bool3_handle = test_class1.get_boolean_attribute_handle("bool3");
+
+    EXPECT_TRUE(int1_handle.is_valid());
+    EXPECT_EQ("int1", int1_handle.get_name());
+    EXPECT_EQ("string2", string2_handle.get_name());
+    EXPECT_EQ("bool3", bool3_handle.get_name());
+
+    // Handles can be used with any instance of the class that created them.
+    test_class1.set_numeric_attribute(int1_handle, 101);
+    test_class2.set_numeric_attribute(int1_handle, 201);
+    EXPECT_EQ(101, test_class1.get_numeric_attribute(int1_handle));
+    EXPECT_EQ(201, test_class2.get_numeric_attribute(int1_handle));
+    EXPECT_EQ(201, test_class2.get_numeric_attribute("int1"));
+
+    // Handles follow the same read/write rules as names.
+    EXPECT_EQ("Two", test_class2.get_string_attribute(string2_handle));
+    EXPECT_THROW(
+        test_class2.set_string_attribute(string2_handle, "202");
+    , std::invalid_argument);
+    EXPECT_THROW(
+        test_class2.get_boolean_attribute(bool3_handle);
+    , std::invalid_argument);
+
+    // Attempt to resolve invalid attributes.
+    EXPECT_THROW(
+        test_class1.get_numeric_attribute_handle("Not an attribute");
+    , std::invalid_argument);
+    EXPECT_THROW(
+        test_class1.get_string_attribute_handle("Not an attribute");
+    , std::invalid_argument);
+    EXPECT_THROW(
+        test_class1.get_boolean_attribute_handle("Not an attribute");
+    , std::invalid_argument);
+
+    // Default-constructed handles don't refer to anything.
+    pkmn::numeric_attribute_handle invalid_handle;
+    EXPECT_FALSE(invalid_handle.is_valid());
+    EXPECT_THROW(
+        invalid_handle.get_name();
+    , std::runtime_error);
+    EXPECT_THROW(
+        test_class1.get_numeric_attribute(invalid_handle);
+    , std::invalid_argument);
+
+    // Handles can't be used with other classes.
+    class other_class: public pkmn::class_with_attributes {};
+    other_class other;
+    EXPECT_THROW(
+        other.get_numeric_attribute(int1_handle);
+    , std::invalid_argument);
+    EXPECT_TRUE(other.get_numeric_attribute_names().empty());
+}
@@ -32,6 +32,8 @@
 #include <pkmn/exception.hpp>
 #include <pkmn/pokemon.hpp>
 
+#include <pkmn/utils/random.hpp>
+
 #include <boost/assign.hpp>
 
 #include <gtest/gtest.h>
@@ -1013,6 +1015,136 @@ TEST(cpp_calculations_test, damage_test)
     EXPECT_EQ(200, damage);
 }
 
+TEST(cpp_calculations_test, damage_ranges_test)
+{
+    // Same example as damage_test, plus a dual-type defender the move is
+    // neutral against and without STAB, and a Generation I matchup.
+    static const pkmn::calculations::damage_matchup glaceon_vs_garchomp =
+    {
+        75,
+        pkmn::type_pair_t(pkmn::e_type::ICE, pkmn::e_type::NONE),
+        123,
+        pkmn::type_pair_t(pkmn::e_type::DRAGON, pkmn::e_type::GROUND),
+        163,
+        pkmn::e_type::ICE,
+        65
+    };
+    static const pkmn::calculations::damage_matchup glaceon_vs_charizard =
+    {
+        75,
+        pkmn::type_pair_t(pkmn::e_type::ICE, pkmn::e_type::NONE),
+        123,
+        pkmn::type_pair_t(pkmn::e_type::FIRE, pkmn::e_type::FLYING),
+        150,
+        pkmn::e_type::NORMAL,
+        70
+    };
+
+    std::vector<pkmn::calculations::damage_range> damage_ranges =
+        pkmn::calculations::damage_ranges(
+            6,
+            {glaceon_vs_garchomp, glaceon_vs_charizard}
+        );
+    ASSERT_EQ(size_t(2), damage_ranges.size());
+
+    EXPECT_FLOAT_EQ(4.0f, damage_ranges[0].type_modifier);
+    EXPECT_TRUE(damage_ranges[0].has_STAB);
+    EXPECT_EQ(200, damage_ranges[0].rolls.back());
+
+    EXPECT_FLOAT_EQ(1.0f, damage_ranges[1].type_modifier);
+    EXPECT_FALSE(damage_ranges[1].has_STAB);
+
+    // Each roll should match calculating that roll alone.
+    static const std::vector<pkmn::calculations::damage_matchup> matchups =
+    {
+        glaceon_vs_garchomp, glaceon_vs_charizard
+    };
+    for(size_t matchup_index = 0; matchup_index < matchups.size(); ++matchup_index)
+    {
+        const pkmn::calculations::damage_matchup& matchup = matchups[matchup_index];
+        const pkmn::calculations::damage_range& damage_range = damage_ranges[matchup_index];
+
+        const float modifier = damage_range.type_modifier *
+                               (damage_range.has_STAB ? pkmn::calculations::STAB_MODIFIER : 1.0f);
+        const float critical_hit_modifier = modifier * pkmn::calculations::critical_hit_modifier(6);
+
+        for(int roll_index = 0; roll_index < pkmn::calculations::NUM_DAMAGE_ROLLS; ++roll_index)
+        {
+            const float roll_modifier = float(85 + roll_index) / 100.0f;
+
+            EXPECT_EQ(
+                pkmn::calculations::damage(
+                    matchup.attacker_level,
+                    matchup.move_base_power,
+                    matchup.attack_stat,
+                    matchup.defense_stat,
+                    modifier * roll_modifier
+                ),
+                damage_range.rolls[roll_index]
+            );
+            EXPECT_EQ(
+                pkmn::calculations::damage(
+                    matchup.attacker_level,
+                    matchup.move_base_power,
+                    matchup.attack_stat,
+                    matchup.defense_stat,
+                    critical_hit_modifier * roll_modifier
+                ),
+                damage_range.critical_hit_rolls[roll_index]
+            );
+        }
+    }
+
+    // The type chart matches the single-matchup function.
+    EXPECT_FLOAT_EQ(
+        pkmn::calculations::type_damage_modifier(1, pkmn::e_type::GHOST, pkmn::e_type::PSYCHIC),
+        pkmn::calculations::damage_ranges(
+            1,
+            {{
+                50,
+                pkmn::type_pair_t(pkmn::e_type::GHOST, pkmn::e_type::NONE),
+                100,
+                pkmn::type_pair_t(pkmn::e_type::PSYCHIC, pkmn::e_type::NONE),
+                100,
+                pkmn::e_type::GHOST,
+                30
+            }}
+        ).at(0).type_modifier
+    );
+
+    // Types not in the given generation
+    EXPECT_THROW(
+        pkmn::calculations::damage_ranges(
+            1,
+            {{
+                50,
+                pkmn::type_pair_t(pkmn::e_type::DARK, pkmn::e_type::NONE),
+                100,
+                pkmn::type_pair_t(pkmn::e_type::PSYCHIC, pkmn::e_type::NONE),
+                100,
+                pkmn::e_type::DARK,
+                80
+            }}
+        );
+    , std::invalid_argument);
+
+    // Invalid level
+    EXPECT_THROW(
+        pkmn::calculations::damage_ranges(
+            6,
+            {{
+                0,
+                pkmn::type_pair_t(pkmn::e_type::ICE, pkmn::e_type::NONE),
+                123,
+                pkmn::type_pair_t(pkmn::e_type::DRAGON, pkmn::e_type::GROUND),
+                163,
+                pkmn::e_type::ICE,
+                65
+            }}
+        );
+    , std::out_of_range);
+}
+
 TEST(cpp_calculations_test, type_damage_modifier_test)
 {
     // Test invalid inputs.
@@ -1930,6 +2062,87 @@ TEST(cpp_calculations_test, personality_test)
     personality_test(test_values);
 }
 
+TEST(cpp_calculations_test, personalities_test)
+{
+    static const size_t NUM_PERSONALITIES = 1000;
+
+    // Make sure the batch version validates its inputs the same way.
+    EXPECT_THROW(
+        (void)pkmn::calculations::generate_personalities(
+                  pkmn::e_species::NIDORINO,
+                  pkmn::pokemon::DEFAULT_TRAINER_ID,
+                  true,
+                  pkmn::e_ability::POISON_POINT,
+                  pkmn::e_gender::FEMALE,
+                  pkmn::e_nature::QUIET,
+                  NUM_PERSONALITIES
+              );
+    , std::invalid_argument);
+
+    for(bool bool_val: bools)
+    {
+        std::vector<uint32_t> personalities = pkmn::calculations::generate_personalities(
+                                                  pkmn::e_species::CHARMANDER,
+                                                  pkmn::pokemon::DEFAULT_TRAINER_ID,
+                                                  bool_val,
+                                                  pkmn::e_ability::BLAZE,
+                                                  pkmn::e_gender::FEMALE,
+                                                  pkmn::e_nature::QUIET,
+                                                  NUM_PERSONALITIES
+                                              );
+        ASSERT_EQ(NUM_PERSONALITIES, personalities.size());
+
+        for(uint32_t personality: personalities)
+        {
+            EXPECT_EQ(
+                bool_val,
+                pkmn::calculations::modern_shiny(
+                    personality,
+                    pkmn::pokemon::DEFAULT_TRAINER_ID
+                )
+            );
+            EXPECT_EQ(
+                pkmn::e_gender::FEMALE,
+                pkmn::calculations::modern_pokemon_gender(
+                    pkmn::e_species::CHARMANDER,
+                    personality
+                )
+            );
+            EXPECT_EQ(
+               pkmn::e_nature::QUIET,
+               pkmn::calculations::nature(personality)
+            );
+            EXPECT_EQ(0U, (personality % 2));
+        }
+    }
+}
+
+// Seeding the RNG should make generated values reproducible.
+TEST(cpp_calculations_test, seeded_personality_test)
+{
+    static const size_t NUM_PERSONALITIES = 100;
+    static const uint64_t SEED = 1351;
+
+    std::vector<std::vector<uint32_t>> personality_lists;
+    for(size_t list_index = 0; list_index < 2; ++list_index)
+    {
+        pkmn::seed_rng(SEED);
+        personality_lists.emplace_back(
+            pkmn::calculations::generate_personalities(
+                pkmn::e_species::CHARMANDER,
+                pkmn::pokemon::DEFAULT_TRAINER_ID,
+                false,
+                pkmn::e_ability::BLAZE,
+                pkmn::e_gender::MALE,
+                pkmn::e_nature::QUIET,
+                NUM_PERSONALITIES
+            )
+        );
+    }
+
+    EXPECT_EQ(personality_lists[0], personality_lists[1]);
+}
+
 TEST(cpp_calculations_test, gen2_shiny_test) {
     /*
      * Make sure expected exceptions are thrown
@@ -2362,3 +2575,102 @@ TEST(cpp_calculations_test, modern_stat_test) {
         ), 172
     );
 }
+
+TEST(cpp_calculations_test, gb_stats_test) {
+    // Mismatched input sizes
+    EXPECT_THROW(
+        pkmn::calculations::get_gb_stats(
+            pkmn::e_stat::ATTACK, {81, 81}, {55}, {23140}, {8}
+        );
+    , std::invalid_argument);
+
+    // Invalid EV in the middle of a batch
+    EXPECT_THROW(
+        pkmn::calculations::get_gb_stats(
+            pkmn::e_stat::ATTACK, {1, 1, 1}, {1, 1, 1}, {1, 123456, 1}, {1, 1, 1}
+        );
+    , std::out_of_range);
+
+    // The batch results should exactly match calculating each stat alone.
+    static const std::vector<pkmn::e_stat> stats =
+    {
+        pkmn::e_stat::HP, pkmn::e_stat::ATTACK, pkmn::e_stat::SPECIAL
+    };
+    static const std::vector<int> levels     = {81, 1, 50, 100, 100};
+    static const std::vector<int> base_stats = {35, 255, 90, 1, 255};
+    static const std::vector<int> EVs        = {22850, 0, 24795, 65535, 65535};
+    static const std::vector<int> IVs        = {7, 0, 5, 15, 15};
+
+    for(pkmn::e_stat stat: stats)
+    {
+        std::vector<int> batch_stats = pkmn::calculations::get_gb_stats(
+                                           stat, levels, base_stats, EVs, IVs
+                                       );
+        ASSERT_EQ(levels.size(), batch_stats.size());
+
+        for(size_t pokemon_index = 0; pokemon_index < levels.size(); ++pokemon_index)
+        {
+            EXPECT_EQ(
+                pkmn::calculations::get_gb_stat(
+                    stat,
+                    levels[pokemon_index],
+                    base_stats[pokemon_index],
+                    EVs[pokemon_index],
+                    IVs[pokemon_index]
+                ),
+                batch_stats[pokemon_index]
+            );
+        }
+    }
+}
+
+TEST(cpp_calculations_test, modern_stats_test) {
+    // Mismatched input sizes
+    EXPECT_THROW(
+        pkmn::calculations::get_modern_stats(
+            pkmn::e_stat::ATTACK, {78}, {1.0f, 1.0f}, {130}, {195}, {12}
+        );
+    , std::invalid_argument);
+
+    // Invalid nature modifier in the middle of a batch
+    EXPECT_THROW(
+        pkmn::calculations::get_modern_stats(
+            pkmn::e_stat::ATTACK, {1, 1}, {1.0f, 0.666f}, {1, 1}, {1, 1}, {1, 1}
+        );
+    , std::domain_error);
+
+    // The batch results should exactly match calculating each stat alone.
+    static const std::vector<pkmn::e_stat> stats =
+    {
+        pkmn::e_stat::HP, pkmn::e_stat::ATTACK, pkmn::e_stat::SPECIAL_DEFENSE
+    };
+    static const std::vector<int> levels             = {78, 1, 50, 100, 100};
+    static const std::vector<float> nature_modifiers = {1.0f, 0.9f, 1.1f, 1.1f, 0.9f};
+    static const std::vector<int> base_stats         = {108, 1, 130, 255, 255};
+    static const std::vector<int> EVs                = {74, 0, 195, 255, 255};
+    static const std::vector<int> IVs                = {24, 0, 12, 31, 31};
+
+    for(pkmn::e_stat stat: stats)
+    {
+        std::vector<int> batch_stats = pkmn::calculations::get_modern_stats(
+                                           stat, levels, nature_modifiers,
+                                           base_stats, EVs, IVs
+                                       );
+        ASSERT_EQ(levels.size(), batch_stats.size());
+
+        for(size_t pokemon_index = 0; pokemon_index < levels.size(); ++pokemon_index)
+        {
+            EXPECT_EQ(
+                pkmn::calculations::get_modern_stat(
+                    stat,
+                    levels[pokemon_index],
+                    nature_modifiers[pokemon_index],
+                    base_stats[pokemon_index],
+                    EVs[pokemon_index],
+                    IVs[pokemon_index]
+                ),
+                batch_stats[pokemon_index]
+            );
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pkmn/pokemon.hpp>
+#include <pkmn/database/move_entry.hpp>
+#include <pkmn/database/query_instrumentation.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class query_instrumentation_test: public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            pkmn::database::set_query_callback(pkmn::database::query_callback_t());
+            pkmn::database::reset_query_stats();
+            pkmn::database::set_query_instrumentation_enabled(true);
+        }
+
+        void TearDown() override
+        {
+            pkmn::database::set_query_instrumentation_enabled(false);
+            pkmn::database::set_query_callback(pkmn::database::query_callback_t());
+            pkmn::database::reset_query_stats();
+        }
+};
+
+TEST_F(query_instrumentation_test, query_stats_test)
+{
+    pkmn::database::move_entry move_entry(pkmn::e_move::TACKLE, pkmn::e_game::RED);
+    for(size_t iteration = 0; iteration < 5; ++iteration)
+    {
+        (void)move_entry.get_description();
+    }
+
+    std::vector<pkmn::database::query_stats> query_stats =
+        pkmn::database::get_query_stats();
+    ASSERT_FALSE(query_stats.empty());
+
+    // This wasn't called from inside any tracked call.
+    auto description_stats_iter = std::find_if(
+        query_stats.begin(),
+        query_stats.end(),
+        [](const pkmn::database::query_stats& stats)
+        {
+            return (stats.query.find("move_flavor_text") != std::string::npos);
+        }
+    );
+    ASSERT_NE(query_stats.end(), description_stats_iter);
+    EXPECT_EQ("", description_stats_iter->entry_point);
+    EXPECT_EQ(5ULL, description_stats_iter->num_queries);
+    EXPECT_LE(description_stats_iter->median_duration_ns, description_stats_iter->p90_duration_ns);
+    EXPECT_LE(description_stats_iter->p90_duration_ns, description_stats_iter->p99_duration_ns);
+    EXPECT_LE(description_stats_iter->p99_duration_ns, description_stats_iter->max_duration_ns);
+    EXPECT_LE(description_stats_iter->max_duration_ns, description_stats_iter->total_duration_ns);
+
+    // The longest total time comes first.
+    for(size_t stats_index = 1; stats_index < query_stats.size(); ++stats_index)
+    {
+        EXPECT_GE(
+            query_stats[stats_index-1].total_duration_ns,
+            query_stats[stats_index].total_duration_ns
+        );
+    }
+
+    pkmn::database::reset_query_stats();
+    EXPECT_TRUE(pkmn::database::get_query_stats().empty());
+
+    pkmn::database::set_query_instrumentation_enabled(false);
+    EXPECT_FALSE(pkmn::database::is_query_instrumentation_enabled());
+    (void)move_entry.get_description();
+    EXPECT_TRUE(pkmn::database::get_query_stats().empty());
+}
+
+TEST_F(query_instrumentation_test, entry_point_test)
+{
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(
+                                      pkmn::e_species::PIKACHU,
+                                      pkmn::e_game::RED,
+                                      "",
+                                      50
+                                  );
+    ASSERT_NE(nullptr, pokemon.get());
+
+    // Queries made while constructing the Pokémon's database entry should
+    // be attributed to the outermost call.
+    std::vector<pkmn::database::query_stats> query_stats =
+        pkmn::database::get_query_stats();
+    ASSERT_FALSE(query_stats.empty());
+    for(const pkmn::database::query_stats& stats: query_stats)
+    {
+        EXPECT_EQ("pkmn::pokemon::make", stats.entry_point) << stats.query;
+    }
+}
+
+TEST_F(query_instrumentation_test, callback_test)
+{
+    std::vector<pkmn::database::query_event> query_events;
+    pkmn::database::set_query_callback(
+        [&query_events](const pkmn::database::query_event& event)
+        {
+            query_events.emplace_back(event);
+
+            // Queries made from the callback shouldn't be recorded.
+            pkmn::database::move_entry move_entry(pkmn::e_move::TACKLE, pkmn::e_game::RED);
+            (void)move_entry.get_description();
+        }
+    );
+
+    pkmn::database::move_entry move_entry(pkmn::e_move::POUND, pkmn::e_game::RED);
+    (void)move_entry.get_description();
+
+    ASSERT_FALSE(query_events.empty());
+
+    uint64_t num_queries = 0;
+    for(const pkmn::database::query_stats& stats: pkmn::database::get_query_stats())
+    {
+        num_queries += stats.num_queries;
+    }
+    EXPECT_EQ(query_events.size(), num_queries);
+
+    // Removing the callback should stop events.
+    pkmn::database::set_query_callback(pkmn::database::query_callback_t());
+    const size_t num_events = query_events.size();
+    (void)move_entry.get_description();
+    EXPECT_EQ(num_events, query_events.size());
+}
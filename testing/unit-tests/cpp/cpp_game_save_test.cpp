@@ -33,6 +33,8 @@
 #include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <fstream>
 #include <map>
 
 static BOOST_CONSTEXPR const char* TOO_LONG_OT_NAME = "LibPKMNLibPKMN";
@@ -1181,9 +1183,360 @@ namespace pkmntest {
         std::remove(temp_save_path.string().c_str());
     }
 
+    // The summary should match what the full save reports.
+    TEST_P(game_save_test, game_save_peek_test) {
+        const pkmn::game_save::sptr& save = get_game_save();
+
+        pkmn::game_save_summary summary = pkmn::game_save::peek(save->get_filepath());
+
+        EXPECT_EQ(std::get<0>(get_params()), summary.save_type);
+        EXPECT_EQ(save->get_game(), summary.game);
+        EXPECT_EQ(save->get_trainer_name(), summary.trainer_name);
+        EXPECT_EQ(save->get_trainer_id(), summary.trainer_id);
+        EXPECT_EQ(save->get_money(), summary.money);
+
+        const pkmn::pokemon_party::sptr& party = save->get_pokemon_party();
+        ASSERT_EQ(size_t(party->get_num_pokemon()), summary.party_species.size());
+        ASSERT_EQ(summary.party_species.size(), summary.party_levels.size());
+        for(size_t party_index = 0;
+            party_index < summary.party_species.size();
+            ++party_index)
+        {
+            const pkmn::pokemon::sptr& pokemon = party->get_pokemon(int(party_index));
+
+            EXPECT_EQ(pokemon->get_species(), summary.party_species[party_index]);
+            EXPECT_EQ(pokemon->get_level(), summary.party_levels[party_index]);
+        }
+
+        // Neither of these is implemented for Gamecube saves.
+        if(!is_gamecube())
+        {
+            EXPECT_EQ(save->get_time_played(), summary.time_played);
+            EXPECT_EQ(save->get_pokedex()->get_num_seen(), summary.num_pokedex_seen);
+            EXPECT_EQ(save->get_pokedex()->get_num_caught(), summary.num_pokedex_caught);
+        }
+    }
+
+    TEST_P(game_save_test, game_save_detection_confidence_test) {
+        pkmn::game_save_detection detection = pkmn::game_save::detect_type_with_confidence(
+                                                  get_game_save()->get_filepath()
+                                              );
+
+        EXPECT_EQ(std::get<0>(get_params()), detection.save_type);
+        EXPECT_EQ(pkmn::e_game_save_detection_confidence::VALIDATED, detection.confidence);
+    }
+
+    // Pokémon taken from the PC share the save's storage, so they must stay
+    // usable after the save is gone.
+    TEST_P(game_save_test, game_save_pc_pokemon_lifetime_test) {
+        pkmn::game_save::sptr save = pkmn::game_save::from_file(
+                                         get_game_save()->get_filepath()
+                                     );
+
+        pkmn::pokemon_list_t box_pokemon = save->get_pokemon_pc()->get_box(0)->as_vector();
+        ASSERT_FALSE(box_pokemon.empty());
+
+        std::vector<pkmn::e_species> species;
+        std::vector<std::map<pkmn::e_stat, int>> EVs;
+        for(const pkmn::pokemon::sptr& pokemon: box_pokemon)
+        {
+            species.emplace_back(pokemon->get_species());
+            EVs.emplace_back(pokemon->get_EVs());
+        }
+
+        save.reset();
+
+        for(size_t pokemon_index = 0; pokemon_index < box_pokemon.size(); ++pokemon_index)
+        {
+            const pkmn::pokemon::sptr& pokemon = box_pokemon[pokemon_index];
+
+            EXPECT_EQ(species[pokemon_index], pokemon->get_species());
+            EXPECT_EQ(EVs[pokemon_index], pokemon->get_EVs());
+        }
+
+        // The map returned by get_EVs() should reflect later changes.
+        const pkmn::pokemon::sptr& pokemon = box_pokemon[0];
+        const std::map<pkmn::e_stat, int>& pokemon_EVs = pokemon->get_EVs();
+
+        pokemon->set_EV(pkmn::e_stat::HP, 123);
+        EXPECT_EQ(123, pokemon_EVs.at(pkmn::e_stat::HP));
+        EXPECT_EQ(EVs[0].size(), pokemon_EVs.size());
+    }
+
+    // Saving only copies what changed since the last save, so changes made
+    // between saves must still be written, and nothing else may be lost.
+    TEST_P(game_save_test, game_save_repeated_save_test) {
+        pkmn::game_save::sptr save = pkmn::game_save::from_file(
+                                         get_game_save()->get_filepath()
+                                     );
+
+        fs::path temp_save_path = TMP_DIR / str(boost::format("%d_%u.sav")
+                                                % int(save->get_game())
+                                                % pkmn::rng<uint32_t>().rand());
+
+        // Nothing has changed.
+        save->save_as(temp_save_path.string());
+        pkmntest::compare_game_saves(
+            save,
+            pkmn::game_save::from_file(temp_save_path.string())
+        );
+
+        // Change a single field in a single party Pokémon.
+        const pkmn::pokemon::sptr& party_pokemon = save->get_pokemon_party()->get_pokemon(0);
+        ASSERT_NE(pkmn::e_species::NONE, party_pokemon->get_species());
+        party_pokemon->set_level((party_pokemon->get_level() == 50) ? 51 : 50);
+
+        save->save_as(temp_save_path.string());
+        pkmntest::compare_game_saves(
+            save,
+            pkmn::game_save::from_file(temp_save_path.string())
+        );
+
+        // Change only a met location, which Generation I doesn't record.
+        if(pkmn::priv::game_enum_to_generation(save->get_game()) >= 2)
+        {
+            const std::string original_location = party_pokemon->get_location_met(false);
+            const std::vector<std::string> location_names =
+                pkmn::database::get_location_name_list(save->get_game(), false);
+            auto location_iter = std::find_if(
+                                     location_names.begin(),
+                                     location_names.end(),
+                                     [&original_location](const std::string& location)
+                                     {
+                                         return !location.empty() && (location != original_location);
+                                     }
+                                 );
+            ASSERT_NE(location_names.end(), location_iter);
+
+            party_pokemon->set_location_met(*location_iter, false);
+            const std::string new_location = party_pokemon->get_location_met(false);
+            ASSERT_NE(original_location, new_location);
+
+            save->save_as(temp_save_path.string());
+
+            pkmn::game_save::sptr saved_save = pkmn::game_save::from_file(temp_save_path.string());
+            EXPECT_EQ(
+                new_location,
+                saved_save->get_pokemon_party()->get_pokemon(0)->get_location_met(false)
+            );
+            pkmntest::compare_game_saves(save, saved_save);
+        }
+
+        // Change a PC Pokémon after the party has been synced.
+        const pkmn::pokemon::sptr& box_pokemon = save->get_pokemon_pc()->get_box(0)->get_pokemon(0);
+        if(box_pokemon->get_species() != pkmn::e_species::NONE)
+        {
+            box_pokemon->set_level((box_pokemon->get_level() == 50) ? 51 : 50);
+        }
+
+        save->save_as(temp_save_path.string());
+        pkmntest::compare_game_saves(
+            save,
+            pkmn::game_save::from_file(temp_save_path.string())
+        );
+
+        std::remove(temp_save_path.string().c_str());
+    }
+
     INSTANTIATE_TEST_CASE_P(
         cpp_game_save_test,
         game_save_test,
         ::testing::ValuesIn(params)
     );
+
+    static pkmn::game_save_detection detect_buffer(
+        const std::vector<uint8_t>& buffer
+    )
+    {
+        fs::path temp_save_path = TMP_DIR / str(boost::format("detection_%u.sav")
+                                                % pkmn::rng<uint32_t>().rand());
+        std::ofstream ofile(temp_save_path.string().c_str(), std::ios::binary);
+        ofile.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        ofile.close();
+
+        pkmn::game_save_detection ret = pkmn::game_save::detect_type_with_confidence(
+                                            temp_save_path.string()
+                                        );
+
+        std::remove(temp_save_path.string().c_str());
+
+        return ret;
+    }
+
+    // Inputs that can't be any supported save shouldn't get past the
+    // signature checks, while inputs that only look like one should.
+    TEST(cpp_game_save_detection_test, test_detection_confidence)
+    {
+        pkmn::rng<uint8_t> byte_rng;
+
+        std::vector<uint8_t> small_buffer(1000);
+        for(uint8_t& r_byte: small_buffer)
+        {
+            r_byte = byte_rng.rand();
+        }
+
+        pkmn::game_save_detection detection = detect_buffer(small_buffer);
+        EXPECT_EQ(pkmn::e_game_save_type::NONE, detection.save_type);
+        EXPECT_EQ(pkmn::e_game_save_detection_confidence::NONE, detection.confidence);
+
+        // The size of a Colosseum GCI, but with no game code.
+        std::vector<uint8_t> colosseum_buffer(0x60040);
+        for(uint8_t& r_byte: colosseum_buffer)
+        {
+            r_byte = byte_rng.rand();
+        }
+        colosseum_buffer[0] = 0;
+
+        detection = detect_buffer(colosseum_buffer);
+        EXPECT_EQ(pkmn::e_game_save_type::NONE, detection.save_type);
+        EXPECT_EQ(pkmn::e_game_save_detection_confidence::NONE, detection.confidence);
+
+        // With the game code, it should be validated and rejected.
+        colosseum_buffer[0] = 'G';
+        colosseum_buffer[1] = 'C';
+        colosseum_buffer[2] = '6';
+
+        detection = detect_buffer(colosseum_buffer);
+        EXPECT_EQ(pkmn::e_game_save_type::NONE, detection.save_type);
+        EXPECT_EQ(pkmn::e_game_save_detection_confidence::SIGNATURE_MATCH, detection.confidence);
+    }
+
+    // Loading many saves at once should give the same results, in the same
+    // order, as loading them one at a time.
+    TEST(cpp_game_save_from_files_test, test_from_files)
+    {
+        std::vector<std::string> filepaths;
+        for(const game_save_test_params_t& test_params: params)
+        {
+            const bool is_gamecube = (std::get<1>(test_params) == pkmn::e_game::COLOSSEUM) ||
+                                     (std::get<1>(test_params) == pkmn::e_game::XD);
+            filepaths.emplace_back(
+                fs::path((is_gamecube ? LIBPKMN_TEST_FILES : PKSAV_TEST_SAVES) / std::get<2>(test_params)).string()
+            );
+        }
+
+        // Errors should be reported without stopping the other files.
+        const std::string invalid_filepath = (TMP_DIR / "nonexistent.sav").string();
+        filepaths.insert(filepaths.begin() + 2, invalid_filepath);
+
+        for(size_t num_workers: {0, 1, 3})
+        {
+            pkmn::game_save_load_options options;
+            options.num_workers = num_workers;
+
+            std::vector<pkmn::game_save_load_result> results =
+                pkmn::game_save::from_files(filepaths, options);
+            ASSERT_EQ(filepaths.size(), results.size());
+
+            for(size_t file_index = 0; file_index < filepaths.size(); ++file_index)
+            {
+                const pkmn::game_save_load_result& result = results[file_index];
+                EXPECT_EQ(filepaths[file_index], result.filepath);
+
+                if(filepaths[file_index] == invalid_filepath)
+                {
+                    EXPECT_EQ(nullptr, result.save.get());
+                    EXPECT_FALSE(result.error.empty());
+                }
+                else
+                {
+                    ASSERT_NE(nullptr, result.save.get()) << result.error;
+                    EXPECT_TRUE(result.error.empty());
+
+                    pkmn::game_save::sptr expected_save =
+                        pkmn::game_save::from_file(filepaths[file_index]);
+                    EXPECT_EQ(expected_save->get_game(), result.save->get_game());
+                    EXPECT_EQ(expected_save->get_trainer_name(), result.save->get_trainer_name());
+                    EXPECT_EQ(expected_save->get_trainer_id(), result.save->get_trainer_id());
+                }
+            }
+        }
+
+        EXPECT_TRUE(pkmn::game_save::from_files({}).empty());
+    }
+
+    // Failures should be reported through the return value, and the output
+    // should only be set on success.
+    TEST(cpp_game_save_try_from_file_test, test_try_from_file)
+    {
+        pkmn::game_save::sptr save;
+
+        EXPECT_EQ(
+            pkmn::e_load_status::FILE_NOT_FOUND,
+            pkmn::game_save::try_from_file(
+                (TMP_DIR / "nonexistent.sav").string(),
+                save
+            )
+        );
+        EXPECT_EQ(nullptr, save.get());
+
+        fs::path invalid_save_path = TMP_DIR / str(boost::format("invalid_%u.sav")
+                                                   % pkmn::rng<uint32_t>().rand());
+        std::vector<uint8_t> invalid_buffer(1024, 0xFF);
+        std::ofstream ofile(invalid_save_path.string().c_str(), std::ios::binary);
+        ofile.write(reinterpret_cast<const char*>(invalid_buffer.data()), invalid_buffer.size());
+        ofile.close();
+
+        EXPECT_EQ(
+            pkmn::e_load_status::INVALID_FILE,
+            pkmn::game_save::try_from_file(invalid_save_path.string(), save)
+        );
+        EXPECT_EQ(nullptr, save.get());
+        EXPECT_THROW(
+            (void)pkmn::game_save::from_file(invalid_save_path.string());
+        , std::invalid_argument);
+
+        std::remove(invalid_save_path.string().c_str());
+
+        const std::string valid_save_path = (PKSAV_TEST_SAVES / "red_blue" / "pokemon_red.sav").string();
+        ASSERT_EQ(
+            pkmn::e_load_status::SUCCESS,
+            pkmn::game_save::try_from_file(valid_save_path, save)
+        );
+        ASSERT_NE(nullptr, save.get());
+        EXPECT_EQ(pkmn::e_game::RED, save->get_game());
+    }
+
+    // Transferring between saves from different games should match what
+    // copying each Pokémon with to_game() would do, including the save's
+    // Pokédex.
+    TEST(cpp_game_save_pc_transfer_test, test_ruby_to_emerald_transfer)
+    {
+        pkmn::game_save::sptr ruby_save = pkmn::game_save::from_file(
+                                              (PKSAV_TEST_SAVES / "ruby_sapphire" / "pokemon_ruby.sav").string()
+                                          );
+        pkmn::game_save::sptr emerald_save = pkmn::game_save::from_file(
+                                                 (PKSAV_TEST_SAVES / "emerald" / "pokemon_emerald.sav").string()
+                                             );
+
+        pkmn::pokemon::sptr ruby_pokemon = pkmn::pokemon::make(
+                                               pkmn::e_species::TORCHIC,
+                                               pkmn::e_game::RUBY,
+                                               "",
+                                               30
+                                           );
+        ruby_pokemon->set_level_met(5);
+        ruby_pokemon->set_original_game(pkmn::e_game::SAPPHIRE);
+        ruby_save->get_pokemon_pc()->get_box(0)->set_pokemon(0, ruby_pokemon);
+
+        const pkmn::pokedex::sptr& emerald_pokedex = emerald_save->get_pokedex();
+        emerald_pokedex->set_has_caught(pkmn::e_species::TORCHIC, false);
+        ASSERT_FALSE(emerald_pokedex->has_caught(pkmn::e_species::TORCHIC));
+
+        emerald_save->get_pokemon_pc()->transfer_from(
+            ruby_save->get_pokemon_pc(),
+            {{0, 0}}
+        );
+
+        const pkmn::pokemon::sptr& emerald_pokemon =
+            emerald_save->get_pokemon_pc()->get_box(0)->get_pokemon(0);
+        ASSERT_EQ(pkmn::e_species::TORCHIC, emerald_pokemon->get_species());
+        EXPECT_EQ(pkmn::e_game::EMERALD, emerald_pokemon->get_game());
+        EXPECT_EQ(30, emerald_pokemon->get_level());
+        EXPECT_EQ(30, emerald_pokemon->get_level_met());
+        EXPECT_EQ(pkmn::e_game::RUBY, emerald_pokemon->get_original_game());
+
+        EXPECT_TRUE(emerald_pokedex->has_seen(pkmn::e_species::TORCHIC));
+        EXPECT_TRUE(emerald_pokedex->has_caught(pkmn::e_species::TORCHIC));
+    }
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pkmn/database/in_memory.hpp>
+#include <pkmn/database/lists.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Loading the database into memory switches the whole process over, so this
+ * is its own executable. That way, every other test still runs against the
+ * on-disk database.
+ */
+
+static void test_multithreaded_lookups()
+{
+    static const size_t NUM_THREADS = 4;
+
+    const std::vector<std::string> expected_move_names =
+        pkmn::database::get_move_name_list(pkmn::e_game::EMERALD);
+    const std::vector<std::string> expected_item_names =
+        pkmn::database::get_item_name_list(pkmn::e_game::XD);
+
+    std::atomic<unsigned long long> num_mismatches(0);
+    std::vector<std::thread> threads;
+    for(size_t thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for(size_t iteration = 0; iteration < 10; ++iteration)
+                {
+                    if((pkmn::database::get_move_name_list(pkmn::e_game::EMERALD) != expected_move_names) ||
+                       (pkmn::database::get_item_name_list(pkmn::e_game::XD) != expected_item_names))
+                    {
+                        ++num_mismatches;
+                    }
+                }
+            }
+        );
+    }
+    for(std::thread& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0ULL, num_mismatches.load());
+}
+
+TEST(cpp_in_memory_database_test, load_into_memory_test)
+{
+    std::vector<std::string> on_disk_move_names =
+        pkmn::database::get_move_name_list(pkmn::e_game::EMERALD);
+    std::vector<std::string> on_disk_item_names =
+        pkmn::database::get_item_name_list(pkmn::e_game::XD);
+
+    pkmn::database::load_into_memory();
+    ASSERT_TRUE(pkmn::database::is_loaded_into_memory());
+
+    // Calling this again should do nothing.
+    pkmn::database::load_into_memory();
+    ASSERT_TRUE(pkmn::database::is_loaded_into_memory());
+
+    EXPECT_EQ(
+        on_disk_move_names,
+        pkmn::database::get_move_name_list(pkmn::e_game::EMERALD)
+    );
+    EXPECT_EQ(
+        on_disk_item_names,
+        pkmn::database::get_item_name_list(pkmn::e_game::XD)
+    );
+
+    test_multithreaded_lookups();
+}
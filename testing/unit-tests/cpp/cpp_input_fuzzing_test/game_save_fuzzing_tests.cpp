@@ -68,6 +68,16 @@ TEST(input_fuzzing_test, test_fuzzing_game_save_static_fcns)
         }
         catch(...) {}
 
+        pkmn::game_save::sptr save;
+        if(pkmn::game_save::try_from_file(tmp_filepath, save) == pkmn::e_load_status::SUCCESS)
+        {
+            EXPECT_NE(nullptr, save.get());
+        }
+        else
+        {
+            EXPECT_EQ(nullptr, save.get());
+        }
+
         fs::remove(tmp_filepath.c_str());
     }
 }
@@ -81,6 +81,17 @@ TEST_P(pokemon_fuzzing_test, test_fuzzing_pokemon_io)
             }
             catch(...) {}
 
+            // The non-throwing version should agree.
+            pkmn::pokemon::sptr pokemon;
+            if(pkmn::pokemon::try_from_file(tmp_filepath, pokemon) == pkmn::e_load_status::SUCCESS)
+            {
+                EXPECT_NE(nullptr, pokemon.get());
+            }
+            else
+            {
+                EXPECT_EQ(nullptr, pokemon.get());
+            }
+
             fs::remove(tmp_filepath.c_str());
         }
     }
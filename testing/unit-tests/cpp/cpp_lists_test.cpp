@@ -8,6 +8,7 @@
 #include <pkmntest/util.hpp>
 
 #include <pkmn/exception.hpp>
+#include <pkmn/database/list_snapshots.hpp>
 #include <pkmn/database/lists.hpp>
 #include <pkmn/enums/enum_to_string.hpp>
 
@@ -16,7 +17,9 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <thread>
 #include <tuple>
 
 static inline bool string_in_vector(
@@ -1871,3 +1874,93 @@ TEST(cpp_lists_test, test_machine_special_cases)
         , pkmn::feature_not_in_game_error);
     }
 }
+
+TEST(cpp_lists_test, list_snapshots_test)
+{
+    pkmn::database::warm_list_snapshots();
+
+    // Snapshots should match the uncached lists.
+    pkmn::database::list_snapshot<std::string> item_names =
+        pkmn::database::get_item_name_list_snapshot(pkmn::e_game::EMERALD);
+    ASSERT_TRUE(item_names.get() != nullptr);
+    EXPECT_EQ(
+        pkmn::database::get_item_name_list(pkmn::e_game::EMERALD),
+        *item_names
+    );
+    EXPECT_EQ(
+        pkmn::database::get_pokemon_list(3, true),
+        *pkmn::database::get_pokemon_list_snapshot(3, true)
+    );
+    EXPECT_EQ(
+        pkmn::database::get_location_name_list(pkmn::e_game::XD, true),
+        *pkmn::database::get_location_name_list_snapshot(pkmn::e_game::XD, true)
+    );
+
+    // Later calls should return the same snapshot, and different arguments
+    // should return different ones.
+    EXPECT_EQ(
+        item_names.get(),
+        pkmn::database::get_item_name_list_snapshot(pkmn::e_game::EMERALD).get()
+    );
+    EXPECT_NE(
+        item_names.get(),
+        pkmn::database::get_item_name_list_snapshot(pkmn::e_game::RUBY).get()
+    );
+    EXPECT_NE(
+        pkmn::database::get_pokemon_name_list_snapshot(3, false).get(),
+        pkmn::database::get_pokemon_name_list_snapshot(3, true).get()
+    );
+
+    // Invalid inputs should fail the same way as the uncached lists.
+    EXPECT_THROW(
+        pkmn::database::get_item_name_list_snapshot(pkmn::e_game::NONE);
+    , std::invalid_argument);
+    EXPECT_THROW(
+        pkmn::database::get_pokemon_list_snapshot(7, true);
+    , std::out_of_range);
+    EXPECT_THROW(
+        pkmn::database::get_hm_move_list_snapshot(pkmn::e_game::XD);
+    , pkmn::feature_not_in_game_error);
+}
+
+// Each thread uses its own connection, so lookups made from several threads
+// at once should match the same lookups made from one.
+static void test_multithreaded_lookups()
+{
+    static const size_t NUM_THREADS = 4;
+
+    const std::vector<std::string> expected_move_names =
+        pkmn::database::get_move_name_list(pkmn::e_game::EMERALD);
+    const std::vector<std::string> expected_item_names =
+        pkmn::database::get_item_name_list(pkmn::e_game::XD);
+
+    std::atomic<unsigned long long> num_mismatches(0);
+    std::vector<std::thread> threads;
+    for(size_t thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for(size_t iteration = 0; iteration < 10; ++iteration)
+                {
+                    if((pkmn::database::get_move_name_list(pkmn::e_game::EMERALD) != expected_move_names) ||
+                       (pkmn::database::get_item_name_list(pkmn::e_game::XD) != expected_item_names))
+                    {
+                        ++num_mismatches;
+                    }
+                }
+            }
+        );
+    }
+    for(std::thread& thread: threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0ULL, num_mismatches.load());
+}
+
+TEST(cpp_lists_test, multithreaded_lookup_test)
+{
+    test_multithreaded_lookups();
+}
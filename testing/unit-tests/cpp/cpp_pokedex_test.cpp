@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <string>
 
 class pokedex_test: public ::testing::TestWithParam<pkmn::e_game> {};
@@ -200,6 +201,12 @@ TEST_P(pokedex_test, pokedex_test)
             break;
     }
 
+    // The sets should match the lists, and everything caught must also
+    // have been seen.
+    EXPECT_EQ(pokedex->get_all_seen(), pokedex->get_seen_set().as_vector());
+    EXPECT_EQ(pokedex->get_all_caught(), pokedex->get_caught_set().as_vector());
+    EXPECT_TRUE((pokedex->get_caught_set() - pokedex->get_seen_set()).empty());
+
     // Remove all entries. Do this in reverse because adding a Pokémon as
     // having been caught also makes it having been seen.
 
@@ -257,6 +264,78 @@ TEST_P(pokedex_test, pokedex_test)
     }
 }
 
+TEST_P(pokedex_test, pokedex_set_test)
+{
+    pkmn::e_game game = GetParam();
+
+    pkmn::pokedex::sptr pokedex1 = pkmn::pokedex::make(game);
+    pkmn::pokedex::sptr pokedex2 = pkmn::pokedex::make(game);
+
+    // Include both ends of the first 64-species word (#1 and #64) and the
+    // start of the second (#65).
+    static const std::vector<pkmn::e_species> pokedex1_caught =
+    {
+        pkmn::e_species::BULBASAUR,
+        pkmn::e_species::IVYSAUR,
+        pkmn::e_species::KADABRA,
+        pkmn::e_species::ALAKAZAM,
+        pkmn::e_species::MEW
+    };
+    static const std::vector<pkmn::e_species> pokedex2_caught =
+    {
+        pkmn::e_species::IVYSAUR,
+        pkmn::e_species::ALAKAZAM,
+        pkmn::e_species::MEWTWO
+    };
+
+    for(pkmn::e_species species: pokedex1_caught)
+    {
+        pokedex1->set_has_caught(species, true);
+    }
+    for(pkmn::e_species species: pokedex2_caught)
+    {
+        pokedex2->set_has_caught(species, true);
+    }
+
+    pkmn::species_set caught1 = pokedex1->get_caught_set();
+    pkmn::species_set caught2 = pokedex2->get_caught_set();
+
+    EXPECT_EQ(pokedex1_caught.size(), caught1.size());
+    EXPECT_TRUE(caught1.contains(pkmn::e_species::KADABRA));
+    EXPECT_FALSE(caught1.contains(pkmn::e_species::MEWTWO));
+
+    const std::vector<pkmn::e_species> expected_caught_only_in_1 =
+    {
+        pkmn::e_species::BULBASAUR,
+        pkmn::e_species::KADABRA,
+        pkmn::e_species::MEW
+    };
+    EXPECT_EQ(expected_caught_only_in_1, (caught1 - caught2).as_vector());
+
+    const std::vector<pkmn::e_species> expected_caught_in_both =
+    {
+        pkmn::e_species::IVYSAUR,
+        pkmn::e_species::ALAKAZAM
+    };
+    EXPECT_EQ(expected_caught_in_both, (caught1 & caught2).as_vector());
+
+    pkmn::species_set caught_in_either = caught1 | caught2;
+    EXPECT_EQ(size_t(6), caught_in_either.size());
+
+    std::vector<pkmn::e_species> iterated_species;
+    for(pkmn::e_species species: caught_in_either)
+    {
+        iterated_species.emplace_back(species);
+    }
+    EXPECT_EQ(caught_in_either.as_vector(), iterated_species);
+    EXPECT_TRUE(std::is_sorted(iterated_species.begin(), iterated_species.end()));
+
+    // Sets are values, so later changes to the Pokédex don't affect them.
+    pokedex1->set_has_caught(pkmn::e_species::MEWTWO, true);
+    EXPECT_FALSE(caught1.contains(pkmn::e_species::MEWTWO));
+    EXPECT_EQ(caught1 | caught2, pokedex1->get_caught_set());
+}
+
 static const std::vector<pkmn::e_game> PARAMS =
 {
     pkmn::e_game::RED,
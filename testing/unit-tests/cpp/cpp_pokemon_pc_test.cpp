@@ -25,6 +25,9 @@
 
 #include <gtest/gtest.h>
 
+#include <map>
+#include <utility>
+
 struct test_params_t
 {
     pkmn::e_game box_game;
@@ -725,6 +728,28 @@ TEST_P(pokemon_box_test, pokemon_box_test)
     pokemon_box_test_common(get_pokemon_box(), test_params);
 }
 
+// Pokémon are created on first access, so make sure later accesses
+// return the same instance.
+TEST_P(pokemon_box_test, pokemon_box_lazy_access_test)
+{
+    const pkmn::pokemon_box::sptr& box = get_pokemon_box();
+    const int capacity = box->get_capacity();
+
+    pkmn::pokemon::sptr last_pokemon = box->get_pokemon(capacity-1);
+    ASSERT_NE(nullptr, last_pokemon.get());
+    EXPECT_EQ(pkmn::e_species::NONE, last_pokemon->get_species());
+    EXPECT_EQ(last_pokemon, box->get_pokemon(capacity-1));
+
+    const pkmn::pokemon_list_t& pokemon_list = box->as_vector();
+    ASSERT_EQ(size_t(capacity), pokemon_list.size());
+    for(int pokemon_index = 0; pokemon_index < capacity; ++pokemon_index)
+    {
+        ASSERT_NE(nullptr, pokemon_list[pokemon_index].get());
+        EXPECT_EQ(pokemon_list[pokemon_index], box->get_pokemon(pokemon_index));
+    }
+    EXPECT_EQ(last_pokemon, pokemon_list.back());
+}
+
 INSTANTIATE_TEST_CASE_P(
     cpp_pokemon_box_test,
     pokemon_box_test,
@@ -742,4 +767,106 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::ValuesIn(PARAMS)
 );
 
+class pokemon_pc_transfer_test: public ::testing::TestWithParam<std::pair<pkmn::e_game, pkmn::e_game>> {};
+
+TEST_P(pokemon_pc_transfer_test, pokemon_pc_transfer_test)
+{
+    const pkmn::e_game source_game = GetParam().first;
+    const pkmn::e_game game = GetParam().second;
+
+    pkmn::pokemon_pc::sptr source_pc = pkmn::pokemon_pc::make(source_game);
+    pkmn::pokemon_pc::sptr pc = pkmn::pokemon_pc::make(game);
+
+    const pkmn::pokemon_box::sptr& source_box0 = source_pc->get_box(0);
+    const pkmn::pokemon_box::sptr& source_box1 = source_pc->get_box(1);
+    source_box0->set_pokemon(
+        0,
+        pkmn::pokemon::make(pkmn::e_species::PIKACHU, source_game, "", 20)
+    );
+    source_box0->set_pokemon(
+        1,
+        pkmn::pokemon::make(pkmn::e_species::BULBASAUR, source_game, "", 5)
+    );
+    source_box1->set_pokemon(
+        0,
+        pkmn::pokemon::make(pkmn::e_species::SQUIRTLE, source_game, "", 10)
+    );
+
+    // Swap the first two boxes on the way over.
+    std::map<int, int> box_mapping = {{0, 1}, {1, 0}};
+    pc->transfer_from(source_pc, box_mapping);
+
+    const pkmn::pokemon_box::sptr& box0 = pc->get_box(0);
+    const pkmn::pokemon_box::sptr& box1 = pc->get_box(1);
+    ASSERT_EQ(2, box1->get_num_pokemon());
+    ASSERT_EQ(1, box0->get_num_pokemon());
+
+    EXPECT_EQ(pkmn::e_species::PIKACHU, box1->get_pokemon(0)->get_species());
+    EXPECT_EQ(game, box1->get_pokemon(0)->get_game());
+    EXPECT_EQ(20, box1->get_pokemon(0)->get_level());
+    EXPECT_EQ(pkmn::e_species::BULBASAUR, box1->get_pokemon(1)->get_species());
+    EXPECT_EQ(pkmn::e_species::NONE, box1->get_pokemon(2)->get_species());
+    EXPECT_EQ(pkmn::e_species::SQUIRTLE, box0->get_pokemon(0)->get_species());
+    EXPECT_EQ(pkmn::e_species::NONE, box0->get_pokemon(1)->get_species());
+
+    // The source PC is left as-is.
+    EXPECT_EQ(2, source_box0->get_num_pokemon());
+    EXPECT_EQ(source_game, source_box0->get_pokemon(0)->get_game());
+
+    // Invalid mappings
+    EXPECT_THROW(
+        pc->transfer_from(source_pc, {{0, pc->get_num_boxes()}});
+    , std::out_of_range);
+    EXPECT_THROW(
+        pc->transfer_from(source_pc, {{source_pc->get_num_boxes(), 0}});
+    , std::out_of_range);
+    EXPECT_THROW(
+        pc->transfer_from(source_pc, {{0, 0}, {1, 0}});
+    , std::invalid_argument);
+    EXPECT_THROW(
+        pc->transfer_from(pc, {{0, 1}});
+    , std::invalid_argument);
+
+    // A whole PC can only be transferred if every box has somewhere to go.
+    if(source_pc->get_num_boxes() > pc->get_num_boxes())
+    {
+        EXPECT_THROW(
+            pc->transfer_from(source_pc);
+        , std::invalid_argument);
+    }
+    else
+    {
+        pc->transfer_from(source_pc);
+        EXPECT_EQ(pkmn::e_species::PIKACHU, box0->get_pokemon(0)->get_species());
+        EXPECT_EQ(pkmn::e_species::SQUIRTLE, box1->get_pokemon(0)->get_species());
+    }
+}
+
+static const std::pair<pkmn::e_game, pkmn::e_game> TRANSFER_PARAMS[] =
+{
+    {pkmn::e_game::RED, pkmn::e_game::YELLOW},
+    {pkmn::e_game::RED, pkmn::e_game::GOLD},
+    {pkmn::e_game::GOLD, pkmn::e_game::CRYSTAL},
+    {pkmn::e_game::RUBY, pkmn::e_game::EMERALD},
+    {pkmn::e_game::RUBY, pkmn::e_game::COLOSSEUM},
+    {pkmn::e_game::COLOSSEUM, pkmn::e_game::XD},
+    {pkmn::e_game::XD, pkmn::e_game::FIRERED},
+};
+
+INSTANTIATE_TEST_CASE_P(
+    cpp_pokemon_pc_transfer_test,
+    pokemon_pc_transfer_test,
+    ::testing::ValuesIn(TRANSFER_PARAMS)
+);
+
+TEST(cpp_pokemon_pc_transfer_test, incompatible_game_test)
+{
+    EXPECT_THROW(
+        pkmn::pokemon_pc::make(pkmn::e_game::RED)->transfer_from(
+            pkmn::pokemon_pc::make(pkmn::e_game::RUBY),
+            {{0, 0}}
+        );
+    , std::invalid_argument);
+}
+
 }
@@ -21,6 +21,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdlib>
+#include <fstream>
 
 namespace fs = boost::filesystem;
 
@@ -296,6 +297,60 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::ValuesIn(TEST_PARAMS)
 );
 
+// Failures should be reported through the return value, and the output
+// should only be set on success.
+TEST(pokemon_io_test, test_try_from_file)
+{
+    const fs::path mightyena_path = LIBPKMN_TEST_FILES / "3gpkm" / "MIGHTYENA.3gpkm";
+    pkmn::pokemon::sptr pokemon;
+
+    EXPECT_EQ(
+        pkmn::e_load_status::FILE_NOT_FOUND,
+        pkmn::pokemon::try_from_file((TMP_DIR / "nonexistent.pk1").string(), pokemon)
+    );
+    EXPECT_EQ(nullptr, pokemon.get());
+
+    fs::path invalid_path = TMP_DIR / str(boost::format("%u.pk1")
+                                          % pkmn::rng<uint32_t>().rand());
+    std::ofstream ofile(invalid_path.string().c_str(), std::ios::binary);
+    ofile << "Not a Pokémon";
+    ofile.close();
+
+    EXPECT_EQ(
+        pkmn::e_load_status::INVALID_FILE,
+        pkmn::pokemon::try_from_file(invalid_path.string(), pokemon)
+    );
+    EXPECT_EQ(nullptr, pokemon.get());
+    EXPECT_THROW(
+        (void)pkmn::pokemon::from_file(invalid_path.string());
+    , std::runtime_error);
+
+    fs::remove(invalid_path);
+
+    ASSERT_EQ(
+        pkmn::e_load_status::SUCCESS,
+        pkmn::pokemon::try_from_file(mightyena_path.string(), pokemon)
+    );
+    ASSERT_NE(nullptr, pokemon.get());
+    EXPECT_EQ(pkmn::e_species::MIGHTYENA, pokemon->get_species());
+
+    // Without an extension, the format should be detected from the contents.
+    fs::path extensionless_path = TMP_DIR / str(boost::format("%u")
+                                                % pkmn::rng<uint32_t>().rand());
+    fs::copy_file(mightyena_path, extensionless_path);
+
+    pkmn::pokemon::sptr extensionless_pokemon;
+    ASSERT_EQ(
+        pkmn::e_load_status::SUCCESS,
+        pkmn::pokemon::try_from_file(extensionless_path.string(), extensionless_pokemon)
+    );
+    ASSERT_NE(nullptr, extensionless_pokemon.get());
+    EXPECT_EQ(pkmn::e_species::MIGHTYENA, extensionless_pokemon->get_species());
+    EXPECT_EQ(pokemon->get_personality(), extensionless_pokemon->get_personality());
+
+    fs::remove(extensionless_path);
+}
+
 // Test loading a known .3gpkm file from outside LibPKMN.
 TEST(pokemon_io_test, test_outside_3gpkm) {
     const fs::path _3GPKM_DIR = LIBPKMN_TEST_FILES / "3gpkm";
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2018 Nicholas Corgan (n.corgan@gmail.com)
+ *
+ * Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+ * or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <pkmn/pokemon.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+class snapshot_test: public ::testing::TestWithParam<pkmn::e_game> {};
+
+static void compare_pokemon(
+    const pkmn::pokemon::sptr& pokemon1,
+    const pkmn::pokemon::sptr& pokemon2
+)
+{
+    EXPECT_EQ(pokemon1->get_species(), pokemon2->get_species());
+    EXPECT_EQ(pokemon1->get_form(), pokemon2->get_form());
+    EXPECT_EQ(pokemon1->get_game(), pokemon2->get_game());
+    EXPECT_EQ(pokemon1->get_nickname(), pokemon2->get_nickname());
+    EXPECT_EQ(pokemon1->get_original_trainer_name(), pokemon2->get_original_trainer_name());
+    EXPECT_EQ(pokemon1->get_original_trainer_id(), pokemon2->get_original_trainer_id());
+    EXPECT_EQ(pokemon1->get_held_item(), pokemon2->get_held_item());
+    EXPECT_EQ(pokemon1->get_experience(), pokemon2->get_experience());
+    EXPECT_EQ(pokemon1->get_level(), pokemon2->get_level());
+    EXPECT_EQ(pokemon1->get_EVs(), pokemon2->get_EVs());
+    EXPECT_EQ(pokemon1->get_IVs(), pokemon2->get_IVs());
+    EXPECT_EQ(pokemon1->get_stats(), pokemon2->get_stats());
+
+    const pkmn::move_slots_t& moves1 = pokemon1->get_moves();
+    const pkmn::move_slots_t& moves2 = pokemon2->get_moves();
+    ASSERT_EQ(moves1.size(), moves2.size());
+    for(size_t move_index = 0; move_index < moves1.size(); ++move_index)
+    {
+        EXPECT_EQ(moves1[move_index].move, moves2[move_index].move);
+        EXPECT_EQ(moves1[move_index].pp, moves2[move_index].pp);
+    }
+}
+
+TEST_P(snapshot_test, snapshot_test)
+{
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(
+                                      pkmn::e_species::UNOWN,
+                                      GetParam(),
+                                      "C",
+                                      30
+                                  );
+    pokemon->set_nickname("SNAPSHOT");
+    pokemon->set_original_trainer_name("LIBPKMN");
+    pokemon->set_EV(pkmn::e_stat::ATTACK, 100);
+    pokemon->set_move(pkmn::e_move::SWIFT, 1);
+    EXPECT_FALSE(pokemon->is_snapshot());
+
+    pkmn::pokemon::sptr snapshot = pokemon->snapshot();
+    ASSERT_NE(pokemon, snapshot);
+    EXPECT_TRUE(snapshot->is_snapshot());
+    compare_pokemon(pokemon, snapshot);
+
+    // A snapshot can't be changed.
+    EXPECT_THROW(
+        snapshot->set_level(50);
+    , std::runtime_error);
+    EXPECT_THROW(
+        snapshot->set_nickname("CHANGED");
+    , std::runtime_error);
+    EXPECT_THROW(
+        snapshot->set_EV(pkmn::e_stat::ATTACK, 0);
+    , std::runtime_error);
+    EXPECT_EQ(30, snapshot->get_level());
+
+    // Changes to the original don't affect the snapshot.
+    pokemon->set_level(50);
+    EXPECT_EQ(50, pokemon->get_level());
+    EXPECT_EQ(30, snapshot->get_level());
+
+    // Snapshots of snapshots are also read-only.
+    pkmn::pokemon::sptr snapshot2 = snapshot->snapshot();
+    EXPECT_TRUE(snapshot2->is_snapshot());
+    compare_pokemon(snapshot, snapshot2);
+
+    // Reading the same snapshot from many threads needs no synchronization.
+    static const size_t NUM_THREADS = 4;
+    std::atomic<unsigned long long> num_mismatches(0);
+    std::vector<std::thread> threads;
+    for(size_t thread_index = 0; thread_index < NUM_THREADS; ++thread_index)
+    {
+        threads.emplace_back(
+            [&snapshot, &num_mismatches]()
+            {
+                for(size_t iteration = 0; iteration < 1000; ++iteration)
+                {
+                    if((snapshot->get_level() != 30) ||
+                       (snapshot->get_EVs().at(pkmn::e_stat::ATTACK) != 100) ||
+                       (snapshot->get_moves().at(1).move != pkmn::e_move::SWIFT))
+                    {
+                        ++num_mismatches;
+                    }
+                }
+            }
+        );
+    }
+    for(std::thread& thread: threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(0ULL, num_mismatches.load());
+}
+
+static const std::vector<pkmn::e_game> params =
+{
+    pkmn::e_game::GOLD,
+    pkmn::e_game::RUBY,
+    pkmn::e_game::COLOSSEUM
+};
+
+INSTANTIATE_TEST_CASE_P(
+    cpp_snapshot_test,
+    snapshot_test,
+    ::testing::ValuesIn(params)
+);
+
+// Generation I has no Unown, so test it separately.
+TEST(cpp_snapshot_test, gen1_snapshot_test)
+{
+    pkmn::pokemon::sptr pokemon = pkmn::pokemon::make(
+                                      pkmn::e_species::PIKACHU,
+                                      pkmn::e_game::YELLOW,
+                                      "",
+                                      30
+                                  );
+    pokemon->set_nickname("SNAPSHOT");
+
+    pkmn::pokemon::sptr snapshot = pokemon->snapshot();
+    EXPECT_TRUE(snapshot->is_snapshot());
+    compare_pokemon(pokemon, snapshot);
+
+    EXPECT_THROW(
+        snapshot->set_level(50);
+    , std::runtime_error);
+}